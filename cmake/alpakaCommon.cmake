@@ -51,9 +51,11 @@ endif()
 option(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE "Enable the serial CPU back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE "Enable the threads CPU block thread back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE "Enable the fibers CPU block thread back-end" OFF)
+option(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE "Enable the fibers CPU block thread back-end distributing the blocks over a persistent thread pool" OFF)
 option(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE "Enable the TBB CPU grid block back-end" OFF)
 option(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE "Enable the OpenMP 2.0 CPU grid block back-end" OFF)
 option(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE "Enable the OpenMP 2.0 CPU block thread back-end" OFF)
+option(ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLE "Enable the OpenMP 2.0 CPU grid block back-end executing the threads of a block as SIMD lanes" OFF)
 option(ALPAKA_ACC_ANY_BT_OMP5_ENABLE "Enable the OpenMP 5.0 CPU block and block thread back-end" OFF)
 
 option(ALPAKA_EMU_MEMCPY3D "Emulate internal used hip/cuda-Memcpy3D(async) with a kernel" ${ALPAKA_EMU_MEMCPY3D_DEFAULT})
@@ -63,9 +65,11 @@ if((ALPAKA_ACC_GPU_CUDA_ONLY_MODE OR ALPAKA_ACC_GPU_HIP_ONLY_MODE)
     (ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR
+    ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE OR
     ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR
     ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE OR
+    ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLE OR
     ALPAKA_ACC_ANY_BT_OMP5_ENABLE))
     if(ALPAKA_ACC_GPU_CUDA_ONLY_MODE)
         message(FATAL_ERROR "If ALPAKA_ACC_GPU_CUDA_ONLY_MODE is enabled, only back-ends using CUDA can be enabled! This allows to mix alpaka code with native CUDA code. However, this prevents any non-CUDA back-ends from being enabled.")
@@ -107,7 +111,12 @@ endif()
 
 set(ALPAKA_OFFLOAD_MAX_BLOCK_SIZE "256" CACHE STRING "Maximum number threads per block to be suggested by any target offloading backends ANY_BT_OMP5 and ANY_BT_OACC.")
 option(ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST "Allow host-only contructs like assert in offload code in debug mode." ON)
-set(ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB "30" CACHE STRING "Kibibytes (1024B) of memory to allocate for block shared memory for backends requiring static allocation (includes CPU_B_OMP2_T_SEQ, CPU_B_TBB_T_SEQ, CPU_B_SEQ_T_SEQ)")
+option(ALPAKA_TRACE "Enable the tracing layer recording all CPU queue tasks into a Chrome trace event JSON file (activated at run time with ALPAKA_TRACE_FILE)." OFF)
+option(ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS "Execute multiple blocks of a CPU_B_SEQ_T_OMP2 kernel concurrently within a single nested parallel region per kernel launch (requires OpenMP 3.0)." OFF)
+set(ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB "0" CACHE STRING "Mebibytes (1024KiB) from which on CPU buffers are allocated 2 MiB aligned on huge pages (0 disables huge pages).")
+option(ALPAKA_CPU_HUGE_PAGE_HUGETLB "Try to map CPU buffers above ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB onto reserved huge pages (MAP_HUGETLB) before falling back to transparent huge pages." OFF)
+option(ALPAKA_CPU_HUGE_PAGE_PREFAULT "Touch all pages of CPU buffers above ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB in parallel directly after their allocation." OFF)
+set(ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB "30" CACHE STRING "Kibibytes (1024B) of memory reserved for static block shared memory for backends without native block shared memory (includes CPU_B_OMP2_T_SEQ, CPU_B_TBB_T_SEQ, CPU_B_SEQ_T_SEQ). The dynamic block shared memory of these CPU backends is sized at kernel launch. For ANY_BT_OMP5 it is the size of the static and dynamic block shared memory together.")
 
 #-------------------------------------------------------------------------------
 # Debug output of common variables.
@@ -125,7 +134,7 @@ if(CMAKE_CXX_COMPILER_ID MATCHES "Clang" AND CMAKE_CXX_COMPILER_VERSION VERSION_
     message(FATAL_ERROR "Clang versions < 4.0 are not supported!")
 endif()
 
-if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE AND (ALPAKA_ACC_GPU_CUDA_ENABLE OR ALPAKA_ACC_GPU_HIP_ENABLE))
+if((ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE) AND (ALPAKA_ACC_GPU_CUDA_ENABLE OR ALPAKA_ACC_GPU_HIP_ENABLE))
     message(FATAL_ERROR "Fibers and CUDA or HIP back-end can not be enabled both at the same time.")
 endif()
 
@@ -164,7 +173,7 @@ find_package(Boost ${_ALPAKA_BOOST_MIN_VER} REQUIRED
 
 target_link_libraries(alpaka INTERFACE Boost::headers)
 
-if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
+if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE)
     if(NOT Boost_FIBER_FOUND)
         message(FATAL_ERROR "Optional alpaka dependency Boost.Fiber could not be found!")
     endif()
@@ -235,7 +244,7 @@ endif()
 
 #-------------------------------------------------------------------------------
 # Find OpenMP.
-if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE OR ALPAKA_ACC_ANY_BT_OMP5_ENABLE)
+if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE OR ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLE OR ALPAKA_ACC_ANY_BT_OMP5_ENABLE)
     find_package(OpenMP)
 
     if(OpenMP_CXX_FOUND)
@@ -317,10 +326,10 @@ if(ALPAKA_ACC_GPU_CUDA_ENABLE)
                     endif()
                 endif()
 
-                if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
+                if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE)
                     message(FATAL_ERROR "Clang as a CUDA compiler does not support boost.fiber!")
                 endif()
-                if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE)
+                if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE OR ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE OR ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLE)
                     message(FATAL_ERROR "Clang as a CUDA compiler does not support OpenMP 2!")
                 endif()
                 if(ALPAKA_ACC_ANY_BT_OMP5_ENABLE)
@@ -415,7 +424,7 @@ if(ALPAKA_ACC_GPU_CUDA_ENABLE)
                     endif()
                 endif()
 
-                if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
+                if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE)
                     message(FATAL_ERROR "NVCC does not support boost.fiber!")
                 endif()
 
@@ -714,15 +723,19 @@ if(ALPAKA_ACC_CPU_B_SEQ_T_THREADS_ENABLE)
 endif()
 if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED")
-
+    message(STATUS ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
+endif()
+if(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE)
+    target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED")
+    message(STATUS ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
+endif()
+if(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE OR ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE)
     if(MSVC AND (${CMAKE_SIZEOF_VOID_P} EQUAL 4))
         # On Win32 boost context triggers:
         # libboost_context-vc141-mt-gd-1_64.lib(jump_i386_ms_pe_masm.obj) : error LNK2026: module unsafe for SAFESEH image.
         target_link_options(Boost::fiber INTERFACE "/SAFESEH:NO")
     endif()
     target_link_libraries(alpaka INTERFACE Boost::fiber)
-
-    message(STATUS ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED)
 endif()
 if(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLE)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED")
@@ -736,6 +749,10 @@ if(ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED")
     message(STATUS ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLED)
 endif()
+if(ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLE)
+    target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED")
+    message(STATUS ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED)
+endif()
 if(ALPAKA_ACC_ANY_BT_OMP5_ENABLE)
     target_compile_definitions(alpaka INTERFACE "ALPAKA_ACC_ANY_BT_OMP5_ENABLED")
     message(STATUS ALPAKA_ACC_ANY_BT_OMP5_ENABLED)
@@ -757,7 +774,20 @@ target_compile_definitions(alpaka INTERFACE "ALPAKA_DEBUG=${ALPAKA_DEBUG}")
 if(ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST)
    target_compile_definitions(alpaka INTERFACE "ALPAKA_DEBUG_OFFLOAD_ASSUME_HOST")
 endif()
+if(ALPAKA_TRACE)
+   target_compile_definitions(alpaka INTERFACE "ALPAKA_TRACE_ENABLED")
+endif()
+if(ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS)
+   target_compile_definitions(alpaka INTERFACE "ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS_ENABLED")
+endif()
+if(ALPAKA_CPU_HUGE_PAGE_HUGETLB)
+   target_compile_definitions(alpaka INTERFACE "ALPAKA_CPU_HUGE_PAGE_HUGETLB_ENABLED")
+endif()
+if(ALPAKA_CPU_HUGE_PAGE_PREFAULT)
+   target_compile_definitions(alpaka INTERFACE "ALPAKA_CPU_HUGE_PAGE_PREFAULT_ENABLED")
+endif()
 target_compile_definitions(alpaka INTERFACE "ALPAKA_OFFLOAD_MAX_BLOCK_SIZE=${ALPAKA_OFFLOAD_MAX_BLOCK_SIZE}")
+target_compile_definitions(alpaka INTERFACE "ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB=${ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB}")
 target_compile_definitions(alpaka INTERFACE "ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB=${ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB}")
 
 if(ALPAKA_CI)
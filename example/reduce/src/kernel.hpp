@@ -19,6 +19,8 @@
 
 #include <alpaka/alpaka.hpp>
 
+#include <utility>
+
 //#############################################################################
 //! A cheap wrapper around a C-style array in heap memory.
 template <typename T, uint64_t size>
@@ -90,9 +92,18 @@ struct ReduceKernel
         const uint32_t gridDimension(static_cast<uint32_t>(
             alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(acc)[0]));
 
+        // the block size is a compile time constant, so the index
+        // computation multiplies by a constant:
         // equivalent to blockIndex * TBlockSize + threadIndex
+        using Idx = alpaka::Idx<TAcc>;
+        using WorkDiv = alpaka::WorkDivStatic<
+            alpaka::Dim<TAcc>,
+            Idx,
+            std::integer_sequence<Idx, static_cast<Idx>(TBlockSize)>,
+            std::integer_sequence<Idx, static_cast<Idx>(1u)>>;
+        const WorkDiv workDiv(acc);
         const uint32_t linearizedIndex(static_cast<uint32_t>(
-            alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0]));
+            alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc, workDiv)[0]));
 
         typename GetIterator<T, TElem, TAcc>::Iterator it(
             acc, source, linearizedIndex, gridDimension * TBlockSize, n);
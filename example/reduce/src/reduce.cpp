@@ -18,6 +18,7 @@
 #include "alpakaConfig.hpp"
 #include "kernel.hpp"
 #include <alpaka/alpaka.hpp>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 
@@ -110,8 +111,15 @@ T reduce(DevHost devHost, DevAcc devAcc, QueueAcc queue, uint64_t n, alpaka::Buf
         func));
 
     // enqueue both kernel execution tasks
+    alpaka::wait(queue);
+    auto const start(std::chrono::high_resolution_clock::now());
     alpaka::enqueue(queue, taskKernelReduceMain);
     alpaka::enqueue(queue, taskKernelReduceLastBlock);
+    alpaka::wait(queue);
+    auto const end(std::chrono::high_resolution_clock::now());
+    std::cout << "ReduceKernel: "
+              << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms\n";
 
     //  download result from GPU
     T resultGpuHost;
@@ -124,6 +132,55 @@ T reduce(DevHost devHost, DevAcc devAcc, QueueAcc queue, uint64_t n, alpaka::Buf
     return resultGpuHost;
 }
 
+//-----------------------------------------------------------------------------
+//! Reduces the numbers 1 to n with the library algorithm for comparison.
+//!
+//! \tparam T The data type.
+//! \tparam TFunc The data type of the reduction functor.
+//!
+//! \param devHost The host device.
+//! \param devAcc The accelerator object.
+//! \param queue The device queue.
+//! \param n The problem size.
+//! \param hostMemory The buffer containing the input data.
+//! \param func The reduction function.
+//!
+//! Returns the result of the reduction.
+template<typename T, typename DevHost, typename DevAcc, typename TFunc>
+T reduceAlgorithm(DevHost devHost, DevAcc devAcc, QueueAcc queue, uint64_t n, alpaka::Buf<DevHost, T, Dim, Idx> hostMemory, TFunc func)
+{
+    alpaka::Buf<DevAcc, T, Dim, Extent> sourceDeviceMemory =
+        alpaka::allocBuf<T, Idx>(devAcc, n);
+    alpaka::Buf<DevAcc, T, Dim, Extent> destinationDeviceMemory =
+        alpaka::allocBuf<T, Idx>(devAcc, static_cast<Extent>(1));
+
+    alpaka::view::copy(queue, sourceDeviceMemory, hostMemory, n);
+    alpaka::wait(queue);
+
+    auto const start(std::chrono::high_resolution_clock::now());
+    alpaka::algorithm::reduce<Acc>(
+        queue,
+        sourceDeviceMemory,
+        destinationDeviceMemory,
+        static_cast<T>(0),
+        func);
+    alpaka::wait(queue);
+    auto const end(std::chrono::high_resolution_clock::now());
+    std::cout << "alpaka::algorithm::reduce: "
+              << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms\n";
+
+    T resultGpuHost;
+    auto resultGpuDevice =
+        alpaka::view::ViewPlainPtr<DevHost, T, Dim, Idx>(
+            &resultGpuHost, devHost, static_cast<Extent>(1));
+
+    alpaka::view::copy(queue, resultGpuDevice, destinationDeviceMemory, 1);
+    alpaka::wait(queue);
+
+    return resultGpuHost;
+}
+
 int main()
 {
     // select device and problem size
@@ -173,6 +230,15 @@ int main()
         return EXIT_FAILURE;
     }
 
+    // compare with the library algorithm
+    T resultAlgorithm = reduceAlgorithm<T>(devHost, devAcc, queue, n, hostMemory, addFn);
+    if (resultAlgorithm != expectedResult)
+    {
+        std::cerr << "Results of alpaka::algorithm::reduce don't match: " << resultAlgorithm
+                  << " != " << expectedResult << "\n";
+        return EXIT_FAILURE;
+    }
+
     std::cout << "Results match.\n";
 
     return EXIT_SUCCESS;
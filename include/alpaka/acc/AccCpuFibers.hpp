@@ -12,37 +12,20 @@
 #ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
 
 // Base classes.
-#include <alpaka/workdiv/WorkDivMembers.hpp>
-#include <alpaka/idx/gb/IdxGbRef.hpp>
-#include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
-#include <alpaka/atomic/AtomicNoOp.hpp>
-#include <alpaka/atomic/AtomicStdLibLock.hpp>
-#include <alpaka/atomic/AtomicHierarchy.hpp>
-#include <alpaka/math/MathStdLib.hpp>
-#include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
-#include <alpaka/block/shared/st/BlockSharedMemStMasterSync.hpp>
-#include <alpaka/block/sync/BlockSyncBarrierFiber.hpp>
-#include <alpaka/intrinsic/IntrinsicCpu.hpp>
-#include <alpaka/rand/RandStdLib.hpp>
-#include <alpaka/time/TimeStdLib.hpp>
-#include <alpaka/warp/WarpSingleThread.hpp>
+#include <alpaka/acc/AccCpuFibersBase.hpp>
 
 // Specialized traits.
 #include <alpaka/acc/Traits.hpp>
 #include <alpaka/dev/Traits.hpp>
+#include <alpaka/kernel/TaskKernelCooperativeSingleBlock.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/pltf/Traits.hpp>
 #include <alpaka/idx/Traits.hpp>
 
 // Implementation details.
-#include <alpaka/core/ClipCast.hpp>
 #include <alpaka/core/Concepts.hpp>
-#include <alpaka/core/Fibers.hpp>
-#include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 
-#include <memory>
-#include <thread>
 #include <typeinfo>
 
 namespace alpaka
@@ -65,25 +48,9 @@ namespace alpaka
         typename TDim,
         typename TIdx>
     class AccCpuFibers final :
-        public WorkDivMembers<TDim, TIdx>,
-        public gb::IdxGbRef<TDim, TIdx>,
-        public bt::IdxBtRefFiberIdMap<TDim, TIdx>,
-        public AtomicHierarchy<
-            AtomicStdLibLock<16>, // grid atomics
-            AtomicStdLibLock<16>, // block atomics
-            AtomicNoOp         // thread atomics
-        >,
-        public math::MathStdLib,
-        public block::dyn::BlockSharedMemDynAlignedAlloc,
-        public block::st::BlockSharedMemStMasterSync,
-        public block::BlockSyncBarrierFiber<TIdx>,
-        public IntrinsicCpu,
-        public rand::RandStdLib,
-        public TimeStdLib,
-        public warp::WarpSingleThread,
+        public detail::AccCpuFibersBase<TDim, TIdx>,
         public concepts::Implements<ConceptAcc, AccCpuFibers<TDim, TIdx>>
     {
-        static_assert(sizeof(TIdx) >= sizeof(int), "Index type is not supported, consider using int or a larger type.");
     public:
         // Partial specialization with the correct TDim and TIdx is not allowed.
         template<
@@ -91,7 +58,7 @@ namespace alpaka
             typename TIdx2,
             typename TKernelFnObj,
             typename... TArgs>
-        friend class ::alpaka::TaskKernelCpuFibers;
+        friend class ::alpaka::detail::TaskKernelCpuFibersBase;
 
     private:
         //-----------------------------------------------------------------------------
@@ -100,24 +67,7 @@ namespace alpaka
         ALPAKA_FN_HOST AccCpuFibers(
             TWorkDiv const & workDiv,
             std::size_t const & blockSharedMemDynSizeBytes) :
-                WorkDivMembers<TDim, TIdx>(workDiv),
-                gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
-                bt::IdxBtRefFiberIdMap<TDim, TIdx>(m_fibersToIndices),
-                AtomicHierarchy<
-                    AtomicStdLibLock<16>, // atomics between grids
-                    AtomicStdLibLock<16>, // atomics between blocks
-                    AtomicNoOp         // atomics between threads
-                >(),
-                math::MathStdLib(),
-                block::dyn::BlockSharedMemDynAlignedAlloc(blockSharedMemDynSizeBytes),
-                block::st::BlockSharedMemStMasterSync(
-                    [this](){block::syncBlockThreads(*this);},
-                    [this](){return (m_masterFiberId == boost::this_fiber::get_id());}),
-                block::BlockSyncBarrierFiber<TIdx>(
-                    getWorkDiv<Block, Threads>(workDiv).prod()),
-                rand::RandStdLib(),
-                TimeStdLib(),
-                m_gridBlockIdx(Vec<TDim, TIdx>::zeros())
+                detail::AccCpuFibersBase<TDim, TIdx>(workDiv, blockSharedMemDynSizeBytes)
         {}
 
     public:
@@ -131,14 +81,6 @@ namespace alpaka
         ALPAKA_FN_HOST auto operator=(AccCpuFibers &&) -> AccCpuFibers & = delete;
         //-----------------------------------------------------------------------------
         /*virtual*/ ~AccCpuFibers() = default;
-
-    private:
-        // getIdx
-        typename bt::IdxBtRefFiberIdMap<TDim, TIdx>::FiberIdToIdxMap mutable m_fibersToIndices;  //!< The mapping of fibers id's to indices.
-        Vec<TDim, TIdx> mutable m_gridBlockIdx;                    //!< The index of the currently executed block.
-
-        // allocBlockSharedArr
-        boost::fibers::fiber::id mutable m_masterFiberId;           //!< The id of the master fiber.
     };
 
     namespace traits
@@ -159,37 +101,9 @@ namespace alpaka
             typename TDim,
             typename TIdx>
         struct GetAccDevProps<
-            AccCpuFibers<TDim, TIdx>>
-        {
-            //-----------------------------------------------------------------------------
-            ALPAKA_FN_HOST static auto getAccDevProps(
-                DevCpu const & dev)
-            -> alpaka::AccDevProps<TDim, TIdx>
-            {
-#ifdef ALPAKA_CI
-                auto const blockThreadCountMax(static_cast<TIdx>(3));
-#else
-                auto const blockThreadCountMax(static_cast<TIdx>(4));  // \TODO: What is the maximum? Just set a reasonable value?
-#endif
-                return {
-                    // m_multiProcessorCount
-                    std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(std::thread::hardware_concurrency())),   // \TODO: This may be inaccurate.
-                    // m_gridBlockExtentMax
-                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
-                    // m_gridBlockCountMax
-                    std::numeric_limits<TIdx>::max(),
-                    // m_blockThreadExtentMax
-                    Vec<TDim, TIdx>::all(blockThreadCountMax),
-                    // m_blockThreadCountMax
-                    blockThreadCountMax,
-                    // m_threadElemExtentMax
-                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
-                    // m_threadElemCountMax
-                    std::numeric_limits<TIdx>::max(),
-                    // m_sharedMemSizeBytes
-                    getMemBytes( dev )};
-            }
-        };
+            AccCpuFibers<TDim, TIdx>> :
+                detail::GetAccDevPropsCpuFibers<TDim, TIdx>
+        {};
         //#############################################################################
         //! The CPU fibers accelerator name trait specialization.
         template<
@@ -260,6 +174,38 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU fibers accelerator cooperative execution task type trait specialization.
+        //!
+        //! The blocks are executed one after another so only grids consisting of a single block can be synchronized.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuFibers<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...> :
+                detail::CreateTaskKernelCooperativeSingleBlock<
+                    TaskKernelCpuFibers<TDim, TIdx, TKernelFnObj, TArgs...>,
+                    TWorkDiv,
+                    TKernelFnObj,
+                    TArgs...>
+        {};
+
+        //#############################################################################
+        //! The CPU fibers accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuFibers<TDim, TIdx>> :
+                detail::GetCooperativeGridBlockCountMaxSingleBlock<TIdx>
+        {};
+
         //#############################################################################
         //! The CPU fibers execution task platform type trait specialization.
         template<
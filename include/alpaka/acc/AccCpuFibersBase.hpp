@@ -0,0 +1,191 @@
+/* Copyright 2020 Axel Huebl, Benjamin Worpitz, René Widera
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) || defined(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
+
+// Base classes.
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
+#include <alpaka/idx/gb/IdxGbRef.hpp>
+#include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
+#include <alpaka/atomic/AtomicNoOp.hpp>
+#include <alpaka/atomic/AtomicStdLibLock.hpp>
+#include <alpaka/atomic/AtomicHierarchy.hpp>
+#include <alpaka/math/MathStdLib.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
+#include <alpaka/block/shared/st/BlockSharedMemStMasterSync.hpp>
+#include <alpaka/block/sync/BlockSyncBarrierFiber.hpp>
+#include <alpaka/grid/sync/GridSyncBlockSync.hpp>
+#include <alpaka/intrinsic/IntrinsicCpu.hpp>
+#include <alpaka/rand/RandStdLib.hpp>
+#include <alpaka/time/TimeStdLib.hpp>
+#include <alpaka/warp/WarpSingleThread.hpp>
+
+// Implementation details.
+#include <alpaka/acc/AccDevProps.hpp>
+#include <alpaka/core/ClipCast.hpp>
+#include <alpaka/core/Fibers.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace alpaka
+{
+    namespace detail
+    {
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class TaskKernelCpuFibersBase;
+
+        //#############################################################################
+        //! The implementation shared by the CPU fibers accelerators.
+        //!
+        //! It uses boost::fibers to implement the cooperative parallelism of the threads of a block.
+        //! All fibers of a block are executed by the same operating system thread.
+        //! Therefore block synchronization is a cheap context switch, the shared memory can reside in the closest memory/cache available
+        //! and there is no false sharing between neighboring threads as it is the case in real multi-threading.
+        template<
+            typename TDim,
+            typename TIdx>
+        class AccCpuFibersBase :
+            public WorkDivMembers<TDim, TIdx>,
+            public gb::IdxGbRef<TDim, TIdx>,
+            public batch::IdxBatchRef<TIdx>,
+            public bt::IdxBtRefFiberIdMap<TDim, TIdx>,
+            public AtomicHierarchy<
+                AtomicStdLibLock<16>, // grid atomics
+                AtomicStdLibLock<16>, // block atomics
+                AtomicNoOp         // thread atomics
+            >,
+            public math::MathStdLib,
+            public block::dyn::BlockSharedMemDynAlignedAlloc,
+            public block::st::BlockSharedMemStMasterSync,
+            public block::BlockSyncBarrierFiber<TIdx>,
+            public grid::GridSyncBlockSync<block::BlockSyncBarrierFiber<TIdx>>,
+            public IntrinsicCpu,
+            public rand::RandStdLib,
+            public TimeStdLib,
+            public warp::WarpSingleThread
+        {
+            static_assert(sizeof(TIdx) >= sizeof(int), "Index type is not supported, consider using int or a larger type.");
+        public:
+            // Partial specialization with the correct TDim and TIdx is not allowed.
+            template<
+                typename TDim2,
+                typename TIdx2,
+                typename TKernelFnObj,
+                typename... TArgs>
+            friend class ::alpaka::detail::TaskKernelCpuFibersBase;
+
+        protected:
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST AccCpuFibersBase(
+                TWorkDiv const & workDiv,
+                std::size_t const & blockSharedMemDynSizeBytes) :
+                    WorkDivMembers<TDim, TIdx>(workDiv),
+                    gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                    batch::IdxBatchRef<TIdx>(m_batchIdx),
+                    bt::IdxBtRefFiberIdMap<TDim, TIdx>(m_fibersToIndices),
+                    AtomicHierarchy<
+                        AtomicStdLibLock<16>, // atomics between grids
+                        AtomicStdLibLock<16>, // atomics between blocks
+                        AtomicNoOp         // atomics between threads
+                    >(),
+                    math::MathStdLib(),
+                    block::dyn::BlockSharedMemDynAlignedAlloc(blockSharedMemDynSizeBytes),
+                    block::st::BlockSharedMemStMasterSync(
+                        [this](){block::syncBlockThreads(*this);},
+                        [this](){return (m_masterFiberId == boost::this_fiber::get_id());}),
+                    block::BlockSyncBarrierFiber<TIdx>(
+                        getWorkDiv<Block, Threads>(workDiv).prod()),
+                    grid::GridSyncBlockSync<block::BlockSyncBarrierFiber<TIdx>>(static_cast<block::BlockSyncBarrierFiber<TIdx> const &>(*this), m_bCooperative),
+                    rand::RandStdLib(),
+                    TimeStdLib(),
+                    m_gridBlockIdx(Vec<TDim, TIdx>::zeros()),
+                    m_batchIdx(static_cast<TIdx>(0u)),
+                    m_bCooperative(false)
+            {}
+
+        public:
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST AccCpuFibersBase(AccCpuFibersBase const &) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST AccCpuFibersBase(AccCpuFibersBase &&) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(AccCpuFibersBase const &) -> AccCpuFibersBase & = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(AccCpuFibersBase &&) -> AccCpuFibersBase & = delete;
+
+        protected:
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~AccCpuFibersBase() = default;
+
+        private:
+            // getIdx
+            typename bt::IdxBtRefFiberIdMap<TDim, TIdx>::FiberIdToIdxMap mutable m_fibersToIndices;  //!< The mapping of fibers id's to indices.
+            Vec<TDim, TIdx> mutable m_gridBlockIdx;                    //!< The index of the currently executed block.
+            TIdx mutable m_batchIdx;                                   //!< The index of the currently executed problem instance of a batch.
+            bool m_bCooperative;                                       //!< If the kernel is executed by a cooperative launch.
+
+            // allocBlockSharedArr
+            boost::fibers::fiber::id mutable m_masterFiberId;           //!< The id of the master fiber.
+        };
+
+        //#############################################################################
+        //! The device properties of the CPU fibers accelerators.
+        //!
+        //! The accelerators specialize traits::GetAccDevProps by deriving from it.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetAccDevPropsCpuFibers
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getAccDevProps(
+                DevCpu const & dev)
+            -> alpaka::AccDevProps<TDim, TIdx>
+            {
+                // All fibers of a block are executed by a single operating system thread.
+                // More fibers per block would not execute more work in parallel but only add stacks and context switches at each block synchronization.
+#ifdef ALPAKA_CI
+                auto const blockThreadCountMax(static_cast<TIdx>(3));
+#else
+                auto const blockThreadCountMax(static_cast<TIdx>(4));
+#endif
+                return {
+                    // m_multiProcessorCount
+                    std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(getTopology(dev).m_logicalCoreCount)),
+                    // m_gridBlockExtentMax
+                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                    // m_gridBlockCountMax
+                    std::numeric_limits<TIdx>::max(),
+                    // m_blockThreadExtentMax
+                    Vec<TDim, TIdx>::all(blockThreadCountMax),
+                    // m_blockThreadCountMax
+                    blockThreadCountMax,
+                    // m_threadElemExtentMax
+                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                    // m_threadElemCountMax
+                    std::numeric_limits<TIdx>::max(),
+                    // m_sharedMemSizeBytes
+                    getMemBytes( dev )};
+            }
+        };
+    }
+}
+
+#endif
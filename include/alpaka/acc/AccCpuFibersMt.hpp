@@ -0,0 +1,234 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED
+
+// Base classes.
+#include <alpaka/acc/AccCpuFibersBase.hpp>
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/kernel/TaskKernelCooperativeSingleBlock.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+
+#include <typeinfo>
+
+namespace alpaka
+{
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TKernelFnObj,
+        typename... TArgs>
+    class TaskKernelCpuFibersMt;
+
+    //#############################################################################
+    //! The CPU multi-threaded fibers accelerator.
+    //!
+    //! This accelerator allows parallel kernel execution on a CPU device.
+    //! The blocks are distributed over a persistent pool of operating system threads.
+    //! Each worker executes the threads of its current block as boost::fibers on pooled stacks.
+    //! All fibers of a block stay on the same worker, so block synchronization is a cheap context switch
+    //! and the block shared memory stays in the cache of the core executing the block.
+    template<
+        typename TDim,
+        typename TIdx>
+    class AccCpuFibersMt final :
+        public detail::AccCpuFibersBase<TDim, TIdx>,
+        public concepts::Implements<ConceptAcc, AccCpuFibersMt<TDim, TIdx>>
+    {
+    public:
+        // Partial specialization with the correct TDim and TIdx is not allowed.
+        template<
+            typename TDim2,
+            typename TIdx2,
+            typename TKernelFnObj,
+            typename... TArgs>
+        friend class ::alpaka::detail::TaskKernelCpuFibersBase;
+
+    private:
+        //-----------------------------------------------------------------------------
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST AccCpuFibersMt(
+            TWorkDiv const & workDiv,
+            std::size_t const & blockSharedMemDynSizeBytes) :
+                detail::AccCpuFibersBase<TDim, TIdx>(workDiv, blockSharedMemDynSizeBytes)
+        {}
+
+    public:
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST AccCpuFibersMt(AccCpuFibersMt const &) = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST AccCpuFibersMt(AccCpuFibersMt &&) = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST auto operator=(AccCpuFibersMt const &) -> AccCpuFibersMt & = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST auto operator=(AccCpuFibersMt &&) -> AccCpuFibersMt & = delete;
+        //-----------------------------------------------------------------------------
+        /*virtual*/ ~AccCpuFibersMt() = default;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator accelerator type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct AccType<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            using type = AccCpuFibersMt<TDim, TIdx>;
+        };
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator device properties get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetAccDevProps<
+            AccCpuFibersMt<TDim, TIdx>> :
+                detail::GetAccDevPropsCpuFibers<TDim, TIdx>
+        {};
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator name trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetAccName<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getAccName()
+            -> std::string
+            {
+                return "AccCpuFibersMt<" + std::to_string(TDim::value) + "," + typeid(TIdx).name() + ">";
+            }
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator device type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DevType<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            using type = DevCpu;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator dimension getter trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DimType<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator execution task type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernel<
+            AccCpuFibersMt<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto createTaskKernel(
+                TWorkDiv const & workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args)
+            {
+                return
+                    TaskKernelCpuFibersMt<
+                        TDim,
+                        TIdx,
+                        TKernelFnObj,
+                        TArgs...>(
+                            workDiv,
+                            kernelFnObj,
+                            std::forward<TArgs>(args)...);
+            }
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator cooperative execution task type trait specialization.
+        //!
+        //! Blocks waiting at a grid barrier would block their worker, so only grids consisting of a single block can be synchronized.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuFibersMt<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...> :
+                detail::CreateTaskKernelCooperativeSingleBlock<
+                    TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>,
+                    TWorkDiv,
+                    TKernelFnObj,
+                    TArgs...>
+        {};
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuFibersMt<TDim, TIdx>> :
+                detail::GetCooperativeGridBlockCountMaxSingleBlock<TIdx>
+        {};
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task platform type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct PltfType<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            using type = PltfCpu;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers accelerator idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct IdxType<
+            AccCpuFibersMt<TDim, TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
 #include <alpaka/idx/bt/IdxBtZero.hpp>
 #include <alpaka/atomic/AtomicNoOp.hpp>
@@ -24,9 +25,10 @@
 #include <alpaka/atomic/AtomicOmpBuiltIn.hpp>
 #include <alpaka/atomic/AtomicHierarchy.hpp>
 #include <alpaka/math/MathStdLib.hpp>
-#include <alpaka/block/shared/dyn/BlockSharedMemDynMember.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynArena.hpp>
 #include <alpaka/block/shared/st/BlockSharedMemStMember.hpp>
 #include <alpaka/block/sync/BlockSyncNoOp.hpp>
+#include <alpaka/grid/sync/GridSyncBarrierOmp.hpp>
 #include <alpaka/intrinsic/IntrinsicCpu.hpp>
 #include <alpaka/rand/RandStdLib.hpp>
 #include <alpaka/time/TimeOmp.hpp>
@@ -40,11 +42,16 @@
 #include <alpaka/idx/Traits.hpp>
 
 // Implementation details.
+#include <alpaka/core/ClipCast.hpp>
 #include <alpaka/core/Concepts.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 
+#include <omp.h>
+
+#include <algorithm>
 #include <limits>
+#include <stdexcept>
 #include <typeinfo>
 
 namespace alpaka
@@ -68,6 +75,7 @@ namespace alpaka
     class AccCpuOmp2Blocks final :
         public WorkDivMembers<TDim, TIdx>,
         public gb::IdxGbRef<TDim, TIdx>,
+        public batch::IdxBatchRef<TIdx>,
         public bt::IdxBtZero<TDim, TIdx>,
         public AtomicHierarchy<
             AtomicStdLibLock<16>,   // grid atomics
@@ -75,9 +83,10 @@ namespace alpaka
             AtomicNoOp           // thread atomics
         >,
         public math::MathStdLib,
-        public block::dyn::BlockSharedMemDynMember<>,
+        public block::dyn::BlockSharedMemDynArena<>,
         public block::st::BlockSharedMemStMember<>,
         public block::BlockSyncNoOp,
+        public grid::GridSyncBarrierOmp,
         public IntrinsicCpu,
         public rand::RandStdLib,
         public TimeOmp,
@@ -103,6 +112,7 @@ namespace alpaka
             std::size_t const & blockSharedMemDynSizeBytes) :
                 WorkDivMembers<TDim, TIdx>(workDiv),
                 gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                batch::IdxBatchRef<TIdx>(m_batchIdx),
                 bt::IdxBtZero<TDim, TIdx>(),
                 AtomicHierarchy<
                     AtomicStdLibLock<16>,// atomics between grids
@@ -110,12 +120,15 @@ namespace alpaka
                     AtomicNoOp        // atomics between threads
                 >(),
                 math::MathStdLib(),
-                block::dyn::BlockSharedMemDynMember<>(blockSharedMemDynSizeBytes),
+                block::dyn::BlockSharedMemDynArena<>(blockSharedMemDynSizeBytes),
                 block::st::BlockSharedMemStMember<>(staticMemBegin(), staticMemCapacity()),
                 block::BlockSyncNoOp(),
+                grid::GridSyncBarrierOmp(m_bCooperative),
                 rand::RandStdLib(),
                 TimeOmp(),
-                m_gridBlockIdx(Vec<TDim, TIdx>::zeros())
+                m_gridBlockIdx(Vec<TDim, TIdx>::zeros()),
+                m_batchIdx(static_cast<TIdx>(0u)),
+                m_bCooperative(false)
         {}
 
     public:
@@ -133,6 +146,8 @@ namespace alpaka
     private:
         // getIdx
         Vec<TDim, TIdx> mutable m_gridBlockIdx;   //!< The index of the currently executed block.
+        TIdx mutable m_batchIdx;                  //!< The index of the currently executed problem instance of a batch.
+        bool m_bCooperative;                      //!< If the kernel is executed by a cooperative launch.
     };
 
     namespace traits
@@ -160,11 +175,9 @@ namespace alpaka
                 DevCpu const & dev)
             -> alpaka::AccDevProps<TDim, TIdx>
             {
-                alpaka::ignore_unused(dev);
-
                 return {
                     // m_multiProcessorCount
-                    static_cast<TIdx>(1),
+                    std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(getTopology(dev).m_logicalCoreCount)),
                     // m_gridBlockExtentMax
                     Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
                     // m_gridBlockCountMax
@@ -178,7 +191,7 @@ namespace alpaka
                     // m_threadElemCountMax
                     std::numeric_limits<TIdx>::max(),
                     // m_sharedMemSizeBytes
-                    static_cast<size_t>( AccCpuOmp2Blocks<TDim, TIdx>::staticAllocBytes() )};
+                    getMemBytes( dev )};
             }
         };
         //#############################################################################
@@ -251,6 +264,66 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU OpenMP 2.0 block accelerator cooperative execution task type trait specialization.
+        //!
+        //! Each block is executed by its own thread of an OpenMP team.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuOmp2Blocks<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto createTaskKernelCooperative(
+                TWorkDiv const & workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args)
+            {
+                if(getWorkDiv<Grid, Blocks>(workDiv).prod() > static_cast<TIdx>(::omp_get_max_threads()))
+                {
+                    throw std::runtime_error("The cooperative launch of the AccCpuOmp2Blocks accelerator is limited to omp_get_max_threads() blocks!");
+                }
+
+                return
+                    TaskKernelCpuOmp2Blocks<
+                        TDim,
+                        TIdx,
+                        TKernelFnObj,
+                        TArgs...>(
+                            detail::TaskKernelCooperative(),
+                            workDiv,
+                            kernelFnObj,
+                            std::forward<TArgs>(args)...);
+            }
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 block accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuOmp2Blocks<TDim, TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getCooperativeGridBlockCountMax(
+                DevCpu const & dev)
+            -> TIdx
+            {
+                alpaka::ignore_unused(dev);
+
+                // Only as many blocks as the team of a parallel region can contain threads are resident at the same time.
+                return static_cast<TIdx>(::omp_get_max_threads());
+            }
+        };
+
         //#############################################################################
         //! The CPU OpenMP 2.0 block execution task platform type trait specialization.
         template<
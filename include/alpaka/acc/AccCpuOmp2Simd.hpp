@@ -0,0 +1,291 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED
+
+#if _OPENMP < 200203
+    #error If ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED is set, the compiler has to support OpenMP 2.0 or higher!
+#endif
+
+// Base classes.
+#include <alpaka/workdiv/WorkDivRef.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
+#include <alpaka/idx/gb/IdxGbRef.hpp>
+#include <alpaka/idx/bt/IdxBtLinear.hpp>
+#include <alpaka/atomic/AtomicStdLibLock.hpp>
+#include <alpaka/atomic/AtomicOmpBuiltIn.hpp>
+#include <alpaka/atomic/AtomicHierarchy.hpp>
+#include <alpaka/math/MathStdLib.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynArena.hpp>
+#include <alpaka/block/shared/st/BlockSharedMemStMember.hpp>
+#include <alpaka/intrinsic/IntrinsicCpu.hpp>
+#include <alpaka/rand/RandStdLib.hpp>
+#include <alpaka/time/TimeOmp.hpp>
+#include <alpaka/warp/WarpSingleThread.hpp>
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/core/ClipCast.hpp>
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+
+#include <omp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <typeinfo>
+
+namespace alpaka
+{
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TKernelFnObj,
+        typename... TArgs>
+    class TaskKernelCpuOmp2Simd;
+
+    //#############################################################################
+    //! The CPU OpenMP 2.0 SIMD block thread accelerator.
+    //!
+    //! This accelerator allows parallel kernel execution on a CPU device.
+    //! It uses OpenMP 2.0 to implement the grid block parallelism and executes the threads of a block
+    //! as the iterations of a single loop without dependencies between them, so that the compiler can vectorize
+    //! kernels written for many threads per block.
+    //! One accelerator object is created for each block thread.
+    //! There is no block synchronization, so only kernels declaring traits::IsBlockSyncFree can be executed.
+    template<
+        typename TDim,
+        typename TIdx>
+    class AccCpuOmp2Simd final :
+        public WorkDivRef<TDim, TIdx>,
+        public gb::IdxGbRef<TDim, TIdx>,
+        public batch::IdxBatchRef<TIdx>,
+        public bt::IdxBtLinear<TDim, TIdx>,
+        public AtomicHierarchy<
+            AtomicStdLibLock<16>,   // grid atomics
+            AtomicOmpBuiltIn,    // block atomics
+            AtomicOmpBuiltIn     // thread atomics
+        >,
+        public math::MathStdLib,
+        public block::dyn::BlockSharedMemDynArena<>,
+        public block::st::BlockSharedMemStMember<>,
+        public IntrinsicCpu,
+        public rand::RandStdLib,
+        public TimeOmp,
+        public warp::WarpSingleThread,
+        public concepts::Implements<ConceptAcc, AccCpuOmp2Simd<TDim, TIdx>>
+    {
+        static_assert(sizeof(TIdx) >= sizeof(int), "Index type is not supported, consider using int or a larger type.");
+    public:
+        // Partial specialization with the correct TDim and TIdx is not allowed.
+        template<
+            typename TDim2,
+            typename TIdx2,
+            typename TKernelFnObj,
+            typename... TArgs>
+        friend class ::alpaka::TaskKernelCpuOmp2Simd;
+
+    private:
+        //-----------------------------------------------------------------------------
+        //! \param workDiv The work division shared by all threads of the grid.
+        //! \param gridBlockIdx The index of the block shared by all threads of the block.
+        //! \param batchIdx The index of the problem instance shared by all threads of the block.
+        //! \param blockThreadIdx1d The linearized index of the thread in the block.
+        //! \param blockSharedMem The block shared memory taken from the arena of the executing thread.
+        //! \param blockSharedMemDynPitch The rounded up size of the dynamic block shared memory.
+        ALPAKA_FN_HOST AccCpuOmp2Simd(
+            WorkDivMembers<TDim, TIdx> const & workDiv,
+            Vec<TDim, TIdx> const & gridBlockIdx,
+            TIdx const & batchIdx,
+            TIdx const & blockThreadIdx1d,
+            std::uint8_t * const blockSharedMem,
+            std::size_t const & blockSharedMemDynPitch) :
+                WorkDivRef<TDim, TIdx>(workDiv),
+                gb::IdxGbRef<TDim, TIdx>(gridBlockIdx),
+                batch::IdxBatchRef<TIdx>(batchIdx),
+                bt::IdxBtLinear<TDim, TIdx>(blockThreadIdx1d),
+                AtomicHierarchy<
+                    AtomicStdLibLock<16>,// atomics between grids
+                    AtomicOmpBuiltIn, // atomics between blocks
+                    AtomicOmpBuiltIn  // atomics between threads
+                >(),
+                math::MathStdLib(),
+                block::dyn::BlockSharedMemDynArena<>(blockSharedMem, blockSharedMemDynPitch),
+                // Each thread allocates the static variables of the block in the same order, so all of them get the same addresses.
+                block::st::BlockSharedMemStMember<>(staticMemBegin(), staticMemCapacity()),
+                rand::RandStdLib(),
+                TimeOmp()
+        {}
+
+    public:
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST AccCpuOmp2Simd(AccCpuOmp2Simd const &) = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST AccCpuOmp2Simd(AccCpuOmp2Simd &&) = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST auto operator=(AccCpuOmp2Simd const &) -> AccCpuOmp2Simd & = delete;
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST auto operator=(AccCpuOmp2Simd &&) -> AccCpuOmp2Simd & = delete;
+        //-----------------------------------------------------------------------------
+        /*virtual*/ ~AccCpuOmp2Simd() = default;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator accelerator type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct AccType<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            using type = AccCpuOmp2Simd<TDim, TIdx>;
+        };
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator device properties get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetAccDevProps<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getAccDevProps(
+                DevCpu const & dev)
+            -> alpaka::AccDevProps<TDim, TIdx>
+            {
+                return {
+                    // m_multiProcessorCount
+                    std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(getTopology(dev).m_logicalCoreCount)),
+                    // m_gridBlockExtentMax
+                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                    // m_gridBlockCountMax
+                    std::numeric_limits<TIdx>::max(),
+                    // m_blockThreadExtentMax
+                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                    // m_blockThreadCountMax
+                    std::numeric_limits<TIdx>::max(),
+                    // m_threadElemExtentMax
+                    Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
+                    // m_threadElemCountMax
+                    std::numeric_limits<TIdx>::max(),
+                    // m_sharedMemSizeBytes
+                    getMemBytes( dev )};
+            }
+        };
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator name trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetAccName<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getAccName()
+            -> std::string
+            {
+                return "AccCpuOmp2Simd<" + std::to_string(TDim::value) + "," + typeid(TIdx).name() + ">";
+            }
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator device type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DevType<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            using type = DevCpu;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator dimension getter trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DimType<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator execution task type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernel<
+            AccCpuOmp2Simd<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto createTaskKernel(
+                TWorkDiv const & workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args)
+            {
+                static_assert(
+                    isBlockSyncFree<TKernelFnObj>(),
+                    "The AccCpuOmp2Simd accelerator executes the threads of a block as SIMD lanes and can only execute kernels declaring traits::IsBlockSyncFree!");
+
+                return
+                    TaskKernelCpuOmp2Simd<
+                        TDim,
+                        TIdx,
+                        TKernelFnObj,
+                        TArgs...>(
+                            workDiv,
+                            kernelFnObj,
+                            std::forward<TArgs>(args)...);
+            }
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task platform type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct PltfType<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            using type = PltfCpu;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread accelerator idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct IdxType<
+            AccCpuOmp2Simd<TDim, TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
 #include <alpaka/idx/bt/IdxBtOmp.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
@@ -26,6 +27,7 @@
 #include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
 #include <alpaka/block/shared/st/BlockSharedMemStMasterSync.hpp>
 #include <alpaka/block/sync/BlockSyncBarrierOmp.hpp>
+#include <alpaka/grid/sync/GridSyncBlockSync.hpp>
 #include <alpaka/intrinsic/IntrinsicCpu.hpp>
 #include <alpaka/rand/RandStdLib.hpp>
 #include <alpaka/time/TimeOmp.hpp>
@@ -33,6 +35,7 @@
 
 // Specialized traits.
 #include <alpaka/acc/Traits.hpp>
+#include <alpaka/kernel/TaskKernelCooperativeSingleBlock.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/dev/Traits.hpp>
 #include <alpaka/pltf/Traits.hpp>
@@ -69,6 +72,7 @@ namespace alpaka
     class AccCpuOmp2Threads final :
         public WorkDivMembers<TDim, TIdx>,
         public gb::IdxGbRef<TDim, TIdx>,
+        public batch::IdxBatchRef<TIdx>,
         public bt::IdxBtOmp<TDim, TIdx>,
         public AtomicHierarchy<
             AtomicStdLibLock<16>,   // grid atomics
@@ -79,6 +83,7 @@ namespace alpaka
         public block::dyn::BlockSharedMemDynAlignedAlloc,
         public block::st::BlockSharedMemStMasterSync,
         public block::BlockSyncBarrierOmp,
+        public grid::GridSyncBlockSync<block::BlockSyncBarrierOmp>,
         public IntrinsicCpu,
         public rand::RandStdLib,
         public TimeOmp,
@@ -104,6 +109,7 @@ namespace alpaka
             std::size_t const & blockSharedMemDynSizeBytes) :
                 WorkDivMembers<TDim, TIdx>(workDiv),
                 gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                batch::IdxBatchRef<TIdx>(m_batchIdx),
                 bt::IdxBtOmp<TDim, TIdx>(),
                 AtomicHierarchy<
                     AtomicStdLibLock<16>,// atomics between grids
@@ -116,9 +122,12 @@ namespace alpaka
                     [this](){block::syncBlockThreads(*this);},
                     [](){return (::omp_get_thread_num() == 0);}),
                 block::BlockSyncBarrierOmp(),
+                grid::GridSyncBlockSync<block::BlockSyncBarrierOmp>(static_cast<block::BlockSyncBarrierOmp const &>(*this), m_bCooperative),
                 rand::RandStdLib(),
                 TimeOmp(),
-                m_gridBlockIdx(Vec<TDim, TIdx>::zeros())
+                m_gridBlockIdx(Vec<TDim, TIdx>::zeros()),
+                m_batchIdx(static_cast<TIdx>(0u)),
+                m_bCooperative(false)
         {}
 
     public:
@@ -136,6 +145,8 @@ namespace alpaka
     private:
         // getIdx
         Vec<TDim, TIdx> mutable m_gridBlockIdx;  //!< The index of the currently executed block.
+        TIdx mutable m_batchIdx;                 //!< The index of the currently executed problem instance of a batch.
+        bool m_bCooperative;                     //!< If the kernel is executed by a cooperative launch.
     };
 
     namespace traits
@@ -257,6 +268,38 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU OpenMP 2.0 thread accelerator cooperative execution task type trait specialization.
+        //!
+        //! The blocks are executed one after another so only grids consisting of a single block can be synchronized.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuOmp2Threads<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...> :
+                detail::CreateTaskKernelCooperativeSingleBlock<
+                    TaskKernelCpuOmp2Threads<TDim, TIdx, TKernelFnObj, TArgs...>,
+                    TWorkDiv,
+                    TKernelFnObj,
+                    TArgs...>
+        {};
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 thread accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuOmp2Threads<TDim, TIdx>> :
+                detail::GetCooperativeGridBlockCountMaxSingleBlock<TIdx>
+        {};
+
         //#############################################################################
         //! The CPU OpenMP 2.0 thread execution task platform type trait specialization.
         template<
@@ -13,15 +13,17 @@
 
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
 #include <alpaka/idx/bt/IdxBtZero.hpp>
 #include <alpaka/atomic/AtomicNoOp.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
 #include <alpaka/atomic/AtomicHierarchy.hpp>
 #include <alpaka/math/MathStdLib.hpp>
-#include <alpaka/block/shared/dyn/BlockSharedMemDynMember.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynArena.hpp>
 #include <alpaka/block/shared/st/BlockSharedMemStMember.hpp>
 #include <alpaka/block/sync/BlockSyncNoOp.hpp>
+#include <alpaka/grid/sync/GridSyncBlockSync.hpp>
 #include <alpaka/intrinsic/IntrinsicCpu.hpp>
 #include <alpaka/rand/RandStdLib.hpp>
 #include <alpaka/time/TimeStdLib.hpp>
@@ -29,16 +31,19 @@
 
 // Specialized traits.
 #include <alpaka/acc/Traits.hpp>
+#include <alpaka/kernel/TaskKernelCooperativeSingleBlock.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/dev/Traits.hpp>
 #include <alpaka/pltf/Traits.hpp>
 #include <alpaka/idx/Traits.hpp>
 
 // Implementation details.
+#include <alpaka/core/ClipCast.hpp>
 #include <alpaka/core/Concepts.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <typeinfo>
 
@@ -59,6 +64,7 @@ namespace alpaka
     class AccCpuTbbBlocks final :
         public WorkDivMembers<TDim, TIdx>,
         public gb::IdxGbRef<TDim, TIdx>,
+        public batch::IdxBatchRef<TIdx>,
         public bt::IdxBtZero<TDim, TIdx>,
         public AtomicHierarchy<
             AtomicStdLibLock<16>, // grid atomics
@@ -66,9 +72,10 @@ namespace alpaka
             AtomicNoOp         // thread atomics
         >,
         public math::MathStdLib,
-        public block::dyn::BlockSharedMemDynMember<>,
+        public block::dyn::BlockSharedMemDynArena<>,
         public block::st::BlockSharedMemStMember<>,
         public block::BlockSyncNoOp,
+        public grid::GridSyncBlockSync<block::BlockSyncNoOp>,
         public IntrinsicCpu,
         public rand::RandStdLib,
         public TimeStdLib,
@@ -94,6 +101,7 @@ namespace alpaka
             std::size_t const & blockSharedMemDynSizeBytes) :
                 WorkDivMembers<TDim, TIdx>(workDiv),
                 gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                batch::IdxBatchRef<TIdx>(m_batchIdx),
                 bt::IdxBtZero<TDim, TIdx>(),
                 AtomicHierarchy<
                     AtomicStdLibLock<16>, // atomics between grids
@@ -101,12 +109,15 @@ namespace alpaka
                     AtomicNoOp         // atomics between threads
                 >(),
                 math::MathStdLib(),
-                block::dyn::BlockSharedMemDynMember<>(blockSharedMemDynSizeBytes),
+                block::dyn::BlockSharedMemDynArena<>(blockSharedMemDynSizeBytes),
                 block::st::BlockSharedMemStMember<>(staticMemBegin(), staticMemCapacity()),
                 block::BlockSyncNoOp(),
+                grid::GridSyncBlockSync<block::BlockSyncNoOp>(static_cast<block::BlockSyncNoOp const &>(*this), m_bCooperative),
                 rand::RandStdLib(),
                 TimeStdLib(),
-                m_gridBlockIdx(Vec<TDim, TIdx>::zeros())
+                m_gridBlockIdx(Vec<TDim, TIdx>::zeros()),
+                m_batchIdx(static_cast<TIdx>(0u)),
+                m_bCooperative(false)
         {}
 
     public:
@@ -124,6 +135,8 @@ namespace alpaka
     private:
         // getIdx
         Vec<TDim, TIdx> mutable m_gridBlockIdx;  //!< The index of the currently executed block.
+        TIdx mutable m_batchIdx;                 //!< The index of the currently executed problem instance of a batch.
+        bool m_bCooperative;                     //!< If the kernel is executed by a cooperative launch.
     };
 
     namespace traits
@@ -151,11 +164,9 @@ namespace alpaka
                 DevCpu const & dev)
             -> AccDevProps<TDim, TIdx>
             {
-                alpaka::ignore_unused(dev);
-
                 return {
                     // m_multiProcessorCount
-                    static_cast<TIdx>(1),
+                    std::max(static_cast<TIdx>(1), alpaka::core::clipCast<TIdx>(getTopology(dev).m_logicalCoreCount)),
                     // m_gridBlockExtentMax
                     Vec<TDim, TIdx>::all(std::numeric_limits<TIdx>::max()),
                     // m_gridBlockCountMax
@@ -169,7 +180,7 @@ namespace alpaka
                     // m_threadElemCountMax
                     std::numeric_limits<TIdx>::max(),
                     // m_sharedMemSizeBytes
-                    static_cast< size_t >( AccCpuTbbBlocks<TDim, TIdx>::staticAllocBytes() )};
+                    getMemBytes( dev )};
             }
 
         };
@@ -243,6 +254,38 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU TBB block accelerator cooperative execution task type trait specialization.
+        //!
+        //! The TBB scheduler does not guarantee that all blocks are resident at the same time so only grids consisting of a single block can be synchronized.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuTbbBlocks<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...> :
+                detail::CreateTaskKernelCooperativeSingleBlock<
+                    TaskKernelCpuTbbBlocks<TDim, TIdx, TKernelFnObj, TArgs...>,
+                    TWorkDiv,
+                    TKernelFnObj,
+                    TArgs...>
+        {};
+
+        //#############################################################################
+        //! The CPU TBB block accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuTbbBlocks<TDim, TIdx>> :
+                detail::GetCooperativeGridBlockCountMaxSingleBlock<TIdx>
+        {};
+
         //#############################################################################
         //! The CPU TBB block execution task platform type trait specialization.
         template<
@@ -13,6 +13,7 @@
 
 // Base classes.
 #include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
 #include <alpaka/idx/gb/IdxGbRef.hpp>
 #include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>
 #include <alpaka/atomic/AtomicStdLibLock.hpp>
@@ -21,6 +22,7 @@
 #include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
 #include <alpaka/block/shared/st/BlockSharedMemStMasterSync.hpp>
 #include <alpaka/block/sync/BlockSyncBarrierThread.hpp>
+#include <alpaka/grid/sync/GridSyncBlockSync.hpp>
 #include <alpaka/intrinsic/IntrinsicCpu.hpp>
 #include <alpaka/rand/RandStdLib.hpp>
 #include <alpaka/time/TimeStdLib.hpp>
@@ -29,6 +31,7 @@
 // Specialized traits.
 #include <alpaka/acc/Traits.hpp>
 #include <alpaka/dev/Traits.hpp>
+#include <alpaka/kernel/TaskKernelCooperativeSingleBlock.hpp>
 #include <alpaka/kernel/Traits.hpp>
 #include <alpaka/pltf/Traits.hpp>
 #include <alpaka/idx/Traits.hpp>
@@ -64,6 +67,7 @@ namespace alpaka
     class AccCpuThreads final :
         public WorkDivMembers<TDim, TIdx>,
         public gb::IdxGbRef<TDim, TIdx>,
+        public batch::IdxBatchRef<TIdx>,
         public bt::IdxBtRefThreadIdMap<TDim, TIdx>,
         public AtomicHierarchy<
             AtomicStdLibLock<16>, // grid atomics
@@ -74,6 +78,7 @@ namespace alpaka
         public block::dyn::BlockSharedMemDynAlignedAlloc,
         public block::st::BlockSharedMemStMasterSync,
         public block::BlockSyncBarrierThread<TIdx>,
+        public grid::GridSyncBlockSync<block::BlockSyncBarrierThread<TIdx>>,
         public IntrinsicCpu,
         public rand::RandStdLib,
         public TimeStdLib,
@@ -99,6 +104,7 @@ namespace alpaka
             std::size_t const & blockSharedMemDynSizeBytes) :
                 WorkDivMembers<TDim, TIdx>(workDiv),
                 gb::IdxGbRef<TDim, TIdx>(m_gridBlockIdx),
+                batch::IdxBatchRef<TIdx>(m_batchIdx),
                 bt::IdxBtRefThreadIdMap<TDim, TIdx>(m_threadToIndexMap),
                 AtomicHierarchy<
                     AtomicStdLibLock<16>, // atomics between grids
@@ -112,9 +118,12 @@ namespace alpaka
                     [this](){return (m_idMasterThread == std::this_thread::get_id());}),
                 block::BlockSyncBarrierThread<TIdx>(
                     getWorkDiv<Block, Threads>(workDiv).prod()),
+                grid::GridSyncBlockSync<block::BlockSyncBarrierThread<TIdx>>(static_cast<block::BlockSyncBarrierThread<TIdx> const &>(*this), m_bCooperative),
                 rand::RandStdLib(),
                 TimeStdLib(),
-                m_gridBlockIdx(Vec<TDim, TIdx>::zeros())
+                m_gridBlockIdx(Vec<TDim, TIdx>::zeros()),
+                m_batchIdx(static_cast<TIdx>(0u)),
+                m_bCooperative(false)
         {}
 
     public:
@@ -134,6 +143,8 @@ namespace alpaka
         std::mutex mutable m_mtxMapInsert;                              //!< The mutex used to secure insertion into the ThreadIdToIdxMap.
         typename bt::IdxBtRefThreadIdMap<TDim, TIdx>::ThreadIdToIdxMap mutable m_threadToIndexMap;    //!< The mapping of thread id's to indices.
         Vec<TDim, TIdx> mutable m_gridBlockIdx;                   //!< The index of the currently executed block.
+        TIdx mutable m_batchIdx;                                  //!< The index of the currently executed problem instance of a batch.
+        bool m_bCooperative;                                      //!< If the kernel is executed by a cooperative launch.
 
         // allocBlockSharedArr
         std::thread::id mutable m_idMasterThread;                       //!< The id of the master thread.
@@ -260,6 +271,38 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU threads accelerator cooperative execution task type trait specialization.
+        //!
+        //! The blocks are executed one after another so only grids consisting of a single block can be synchronized.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative<
+            AccCpuThreads<TDim, TIdx>,
+            TWorkDiv,
+            TKernelFnObj,
+            TArgs...> :
+                detail::CreateTaskKernelCooperativeSingleBlock<
+                    TaskKernelCpuThreads<TDim, TIdx, TKernelFnObj, TArgs...>,
+                    TWorkDiv,
+                    TKernelFnObj,
+                    TArgs...>
+        {};
+
+        //#############################################################################
+        //! The CPU threads accelerator cooperative grid block count trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMax<
+            AccCpuThreads<TDim, TIdx>> :
+                detail::GetCooperativeGridBlockCountMaxSingleBlock<TIdx>
+        {};
+
         //#############################################################################
         //! The CPU threads execution task platform type trait specialization.
         template<
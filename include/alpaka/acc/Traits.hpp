@@ -63,6 +63,15 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The trait for getting the maximum number of blocks of a cooperative launch.
+        //!
+        //! All blocks of a cooperative launch have to be resident at the same time.
+        template<
+            typename TAcc,
+            typename TSfinae = void>
+        struct GetCooperativeGridBlockCountMax;
+
         //#############################################################################
         //! The GPU CUDA accelerator device properties get trait specialization.
         template<typename TAcc>
@@ -106,6 +115,25 @@ namespace alpaka
                 dev);
     }
 
+    //-----------------------------------------------------------------------------
+    //! \return The maximum number of blocks of a cooperative launch on the given device.
+    //!
+    //! All blocks of a cooperative launch are resident at the same time so they can be synchronized by grid::syncGridThreads.
+    //! The grid of a kernel executed by execCooperative must not contain more blocks.
+    template<
+        typename TAcc,
+        typename TDev>
+    ALPAKA_FN_HOST auto getCooperativeGridBlockCountMax(
+        TDev const & dev)
+    -> Idx<TAcc>
+    {
+        return
+            traits::GetCooperativeGridBlockCountMax<
+                TAcc>
+            ::getCooperativeGridBlockCountMax(
+                dev);
+    }
+
     //-----------------------------------------------------------------------------
     //! \return The accelerator name
     //!
@@ -0,0 +1,347 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/idx/Accessors.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+    #include <alpaka/queue/QueueUniformCudaHipRtBlocking.hpp>
+    #include <alpaka/queue/QueueUniformCudaHipRtNonBlocking.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace alpaka
+{
+    //-----------------------------------------------------------------------------
+    //! The parallel algorithms.
+    //!
+    //! All algorithms are enqueued into the given queue and operate on one-dimensional views.
+    //! They are executed by kernels of the accelerator given as first template parameter.
+    //! The operations have to be callable on the accelerator (ALPAKA_FN_HOST_ACC).
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //! The maximum number of threads per block used by the algorithms.
+            constexpr std::size_t blockThreadCountMax = 256u;
+            //! The minimal number of elements each thread should process to amortize the block synchronization.
+            constexpr std::size_t threadElemCountMin = 16u;
+            //! The number of blocks per multiprocessor.
+            constexpr std::size_t blocksPerMultiProcessor = 8u;
+
+            //#############################################################################
+            //! If the threads of a block process contiguous ranges instead of interleaved elements.
+            //!
+            //! Contiguous ranges allow SIMD inner loops on CPUs while interleaved elements result in coalesced accesses on GPUs.
+            template<
+                typename TAcc>
+            struct IsContiguousThreadRange : std::is_same<Dev<TAcc>, DevCpu>
+            {};
+
+            //#############################################################################
+            //! The range of elements processed by a single thread.
+            template<
+                typename TIdx>
+            struct ThreadRange
+            {
+                TIdx m_begin;
+                TIdx m_end;
+                TIdx m_stride;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The work division used by the algorithms to process elementCount elements.
+            //!
+            //! The elements are split into contiguous chunks, one per block.
+            //! The block count is chosen so that none of the blocks is empty.
+            //!
+            //! \param blockThreadCountLimit The maximum number of threads per block.
+            template<
+                typename TAcc,
+                typename TDev>
+            ALPAKA_FN_HOST auto createWorkDiv(
+                TDev const & dev,
+                Idx<TAcc> const & elementCount,
+                std::size_t const blockThreadCountLimit = blockThreadCountMax)
+            -> WorkDivMembers<DimInt<1u>, Idx<TAcc>>
+            {
+                using TIdx = Idx<TAcc>;
+                static_assert(
+                    Dim<TAcc>::value == 1u,
+                    "The algorithms require a one-dimensional accelerator!");
+
+                auto const props(getAccDevProps<TAcc>(dev));
+
+                TIdx const blockThreadCount(
+                    std::max(
+                        std::min(props.m_blockThreadCountMax, static_cast<TIdx>(blockThreadCountLimit)),
+                        static_cast<TIdx>(1u)));
+                TIdx const blockElemCountMin(static_cast<TIdx>(blockThreadCount * static_cast<TIdx>(threadElemCountMin)));
+                TIdx blockCount(
+                    std::min(
+                        std::min(
+                            static_cast<TIdx>((elementCount + blockElemCountMin - 1u) / blockElemCountMin),
+                            static_cast<TIdx>(props.m_multiProcessorCount * static_cast<TIdx>(blocksPerMultiProcessor))),
+                        props.m_gridBlockCountMax));
+                blockCount = std::max(blockCount, static_cast<TIdx>(1u));
+
+                // Remove the blocks that would be empty because of the rounding of the chunk size.
+                if(elementCount > 0u)
+                {
+                    TIdx const blockElemCount(static_cast<TIdx>((elementCount + blockCount - 1u) / blockCount));
+                    blockCount = static_cast<TIdx>((elementCount + blockElemCount - 1u) / blockElemCount);
+                }
+
+                return
+                    WorkDivMembers<DimInt<1u>, TIdx>(
+                        Vec<DimInt<1u>, TIdx>(blockCount),
+                        Vec<DimInt<1u>, TIdx>(blockThreadCount),
+                        Vec<DimInt<1u>, TIdx>(static_cast<TIdx>(1u)));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The range of the elementCount elements processed by the current block.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc>
+            ALPAKA_FN_HOST_ACC auto getBlockRange(
+                TAcc const & acc,
+                Idx<TAcc> const & elementCount)
+            -> ThreadRange<Idx<TAcc>>
+            {
+                using TIdx = Idx<TAcc>;
+
+                TIdx const gridBlockIdx(getIdx<Grid, Blocks>(acc)[0u]);
+                TIdx const gridBlockCount(alpaka::getWorkDiv<Grid, Blocks>(acc)[0u]);
+                TIdx const blockElemCount(static_cast<TIdx>((elementCount + gridBlockCount - 1u) / gridBlockCount));
+
+                TIdx const begin(std::min(static_cast<TIdx>(gridBlockIdx * blockElemCount), elementCount));
+                return {begin, std::min(static_cast<TIdx>(begin + blockElemCount), elementCount), static_cast<TIdx>(1u)};
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \tparam TContiguous If the threads should process contiguous ranges. Otherwise the elements are interleaved.
+            //! \return The range of the elements of the current block processed by the current thread.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                bool TContiguous,
+                typename TAcc>
+            ALPAKA_FN_HOST_ACC auto getThreadRange(
+                TAcc const & acc,
+                ThreadRange<Idx<TAcc>> const & blockRange)
+            -> ThreadRange<Idx<TAcc>>
+            {
+                using TIdx = Idx<TAcc>;
+
+                TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+
+                if(TContiguous)
+                {
+                    TIdx const blockElemCount(static_cast<TIdx>(blockRange.m_end - blockRange.m_begin));
+                    TIdx const threadElemCount(static_cast<TIdx>((blockElemCount + blockThreadCount - 1u) / blockThreadCount));
+                    TIdx const begin(static_cast<TIdx>(blockRange.m_begin + std::min(static_cast<TIdx>(blockThreadIdx * threadElemCount), blockElemCount)));
+                    return {begin, std::min(static_cast<TIdx>(begin + threadElemCount), blockRange.m_end), static_cast<TIdx>(1u)};
+                }
+                else
+                {
+                    return {static_cast<TIdx>(blockRange.m_begin + blockThreadIdx), blockRange.m_end, blockThreadCount};
+                }
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Reduces the transformed elements of the given range.
+            //!
+            //! Contiguous ranges are reduced into four independent partial results which allows to overlap the operations and to vectorize the loop.
+            //! Therefore the reduction operation has to be associative and commutative.
+            //!
+            //! \return If the range contained any element. Only then result is set.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TElem,
+                typename TIdx,
+                typename TReduceOp,
+                typename TTransformOp>
+            ALPAKA_FN_HOST_ACC auto reduceRange(
+                TElem const * const pSrc,
+                ThreadRange<TIdx> const & range,
+                TReduceOp const & reduceOp,
+                TTransformOp const & transformOp,
+                T & result)
+            -> bool
+            {
+                TIdx i(range.m_begin);
+                if(i >= range.m_end)
+                {
+                    return false;
+                }
+
+                if((range.m_stride == 1u) && ((range.m_end - i) >= 8u))
+                {
+                    T r0(transformOp(pSrc[i]));
+                    T r1(transformOp(pSrc[i + 1u]));
+                    T r2(transformOp(pSrc[i + 2u]));
+                    T r3(transformOp(pSrc[i + 3u]));
+                    for(i += 4u; i + 4u <= range.m_end; i += 4u)
+                    {
+                        r0 = reduceOp(r0, transformOp(pSrc[i]));
+                        r1 = reduceOp(r1, transformOp(pSrc[i + 1u]));
+                        r2 = reduceOp(r2, transformOp(pSrc[i + 2u]));
+                        r3 = reduceOp(r3, transformOp(pSrc[i + 3u]));
+                    }
+                    result = reduceOp(reduceOp(r0, r1), reduceOp(r2, r3));
+                }
+                else
+                {
+                    result = transformOp(pSrc[i]);
+                    i += range.m_stride;
+                }
+
+                for(; i < range.m_end; i += range.m_stride)
+                {
+                    result = reduceOp(result, transformOp(pSrc[i]));
+                }
+                return true;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Reduces the values of all threads of the block.
+            //!
+            //! The reduction operation has to be associative and commutative.
+            //! pShared and pHasShared have to point to block shared memory for one value and one flag per thread.
+            //!
+            //! \return If any thread of the block had a value. Only then the result is set. Only valid for the first thread of the block.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc,
+                typename T,
+                typename TReduceOp>
+            ALPAKA_FN_HOST_ACC auto blockReduce(
+                TAcc const & acc,
+                T * const pShared,
+                bool * const pHasShared,
+                T const & value,
+                bool const bHasValue,
+                TReduceOp const & reduceOp,
+                T & result)
+            -> bool
+            {
+                using TIdx = Idx<TAcc>;
+
+                TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+
+                if(bHasValue)
+                {
+                    pShared[blockThreadIdx] = value;
+                }
+                pHasShared[blockThreadIdx] = bHasValue;
+                block::syncBlockThreads(acc);
+
+                TIdx blockThreadCountPow2(1u);
+                while(blockThreadCountPow2 < blockThreadCount)
+                {
+                    blockThreadCountPow2 = static_cast<TIdx>(blockThreadCountPow2 * 2u);
+                }
+
+                for(TIdx s(static_cast<TIdx>(blockThreadCountPow2 / 2u)); s > 0u; s = static_cast<TIdx>(s / 2u))
+                {
+                    if((blockThreadIdx < s) && (blockThreadIdx + s < blockThreadCount) && pHasShared[blockThreadIdx + s])
+                    {
+                        pShared[blockThreadIdx] =
+                            pHasShared[blockThreadIdx]
+                            ? reduceOp(pShared[blockThreadIdx], pShared[blockThreadIdx + s])
+                            : pShared[blockThreadIdx + s];
+                        pHasShared[blockThreadIdx] = true;
+                    }
+                    block::syncBlockThreads(acc);
+                }
+
+                if(pHasShared[0u])
+                {
+                    result = pShared[0u];
+                }
+                return pHasShared[0u];
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The size of the block shared memory required for one value and one flag per thread.
+            template<
+                typename T,
+                typename TIdx>
+            ALPAKA_FN_HOST_ACC auto getBlockSharedMemBytesPerThreadValue(
+                TIdx const & blockThreadCount)
+            -> std::size_t
+            {
+                return static_cast<std::size_t>(blockThreadCount) * (sizeof(T) + sizeof(bool));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Keeps the given temporary buffer alive until all tasks enqueued into the queue up to now have been finished.
+            template<
+                typename TQueue,
+                typename TBuf>
+            ALPAKA_FN_HOST auto keepAlive(
+                TQueue & queue,
+                TBuf const & buf)
+            -> void
+            {
+                alpaka::enqueue(
+                    queue,
+                    [buf]()
+                    {
+                        alpaka::ignore_unused(buf);
+                    });
+            }
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+            //-----------------------------------------------------------------------------
+            //! Device memory must not be freed within a stream callback so the queue is waited for instead.
+            template<
+                typename TBuf>
+            ALPAKA_FN_HOST auto keepAlive(
+                QueueUniformCudaHipRtNonBlocking & queue,
+                TBuf const & buf)
+            -> void
+            {
+                alpaka::ignore_unused(buf);
+                wait(queue);
+            }
+            //-----------------------------------------------------------------------------
+            template<
+                typename TBuf>
+            ALPAKA_FN_HOST auto keepAlive(
+                QueueUniformCudaHipRtBlocking & queue,
+                TBuf const & buf)
+            -> void
+            {
+                alpaka::ignore_unused(queue);
+                alpaka::ignore_unused(buf);
+            }
+#endif
+        }
+    }
+}
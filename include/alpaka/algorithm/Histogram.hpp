@@ -0,0 +1,236 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/algorithm/Common.hpp>
+
+#include <alpaka/atomic/Op.hpp>
+#include <alpaka/atomic/Traits.hpp>
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Positioning.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //! The maximum size of a histogram privatized within block shared memory.
+            constexpr std::size_t histogramSharedBytesMax = 8u * 1024u;
+
+            //#############################################################################
+            //! The kernel counting the elements per bin.
+            //!
+            //! \tparam TCount The type of the counters.
+            //! \tparam TPrivatized If each block counts into its own histogram within block shared memory which is added to the global one afterwards.
+            //! Otherwise all threads count directly into the global histogram.
+            template<
+                typename TCount,
+                bool TPrivatized>
+            struct HistogramKernel
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TElem,
+                    typename TBinOp>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TElem const * const pSrc,
+                    Idx<TAcc> const & elementCount,
+                    TCount * const pHist,
+                    Idx<TAcc> const & binCount,
+                    TBinOp const & binOp) const
+                -> void
+                {
+                    using TIdx = Idx<TAcc>;
+
+                    auto const threadRange(
+                        getThreadRange<IsContiguousThreadRange<TAcc>::value>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+                    TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                    TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+
+                    TCount * const pCounts(TPrivatized ? block::dyn::getMem<TCount>(acc) : pHist);
+                    if(TPrivatized)
+                    {
+                        for(TIdx b(blockThreadIdx); b < binCount; b += blockThreadCount)
+                        {
+                            pCounts[b] = static_cast<TCount>(0);
+                        }
+                        block::syncBlockThreads(acc);
+                    }
+
+                    for(auto i(threadRange.m_begin); i < threadRange.m_end; i += threadRange.m_stride)
+                    {
+                        // Negative bins are converted to large unsigned values so they are ignored by the single comparison.
+                        auto const bin(static_cast<std::uint64_t>(binOp(pSrc[i])));
+                        if(bin < static_cast<std::uint64_t>(binCount))
+                        {
+                            if(TPrivatized)
+                            {
+                                atomicOp<op::Add>(acc, &pCounts[bin], static_cast<TCount>(1), hierarchy::Threads());
+                            }
+                            else
+                            {
+                                atomicOp<op::Add>(acc, &pCounts[bin], static_cast<TCount>(1), hierarchy::Blocks());
+                            }
+                        }
+                    }
+
+                    if(TPrivatized)
+                    {
+                        block::syncBlockThreads(acc);
+                        for(TIdx b(blockThreadIdx); b < binCount; b += blockThreadCount)
+                        {
+                            if(pCounts[b] != static_cast<TCount>(0))
+                            {
+                                atomicOp<op::Add>(acc, &pHist[b], pCounts[b], hierarchy::Blocks());
+                            }
+                        }
+                    }
+                }
+            };
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The block shared dynamic memory size of the histogram kernel holds the privatized histogram.
+        template<
+            typename TCount,
+            bool TPrivatized,
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::HistogramKernel<TCount, TPrivatized>,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename TElem,
+                typename TBinOp>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::HistogramKernel<TCount, TPrivatized> const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TElem const * const & pSrc,
+                Idx<TAcc> const & elementCount,
+                TCount * const & pHist,
+                Idx<TAcc> const & binCount,
+                TBinOp const & binOp)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(blockThreadExtent);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(pSrc);
+                alpaka::ignore_unused(elementCount);
+                alpaka::ignore_unused(pHist);
+                alpaka::ignore_unused(binOp);
+
+                return TPrivatized ? static_cast<std::size_t>(binCount) * sizeof(TCount) : 0u;
+            }
+        };
+    }
+
+    namespace algorithm
+    {
+        //-----------------------------------------------------------------------------
+        //! Counts the number of source elements per bin.
+        //!
+        //! Small histograms are privatized per block within block shared memory to reduce the contention of the atomic operations on the global histogram.
+        //! The counter type has to be supported by the atomic operations of the accelerator.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewHist The one-dimensional histogram. It is overwritten. Its extent is the number of bins.
+        //! \param binOp The unary operation returning the integral bin index of an element. Elements outside of [0, bin count) are ignored.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewHist,
+            typename TBinOp>
+        ALPAKA_FN_HOST auto histogram(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewHist & viewHist,
+            TBinOp const & binOp)
+        -> void
+        {
+            static_assert(
+                Dim<TViewSrc>::value == 1u && Dim<TViewHist>::value == 1u,
+                "The histogram algorithm requires one-dimensional views!");
+
+            using TIdx = Idx<TAcc>;
+            using TCount = Elem<TViewHist>;
+            static_assert(
+                std::is_arithmetic<TCount>::value,
+                "The histogram requires arithmetic counters!");
+
+            auto const binCount(static_cast<TIdx>(extent::getExtentProduct(viewHist)));
+            view::fill(queue, viewHist, static_cast<TCount>(0));
+
+            auto const elementCount(static_cast<TIdx>(extent::getExtentProduct(viewSrc)));
+            if((elementCount == 0u) || (binCount == 0u))
+            {
+                return;
+            }
+
+            auto const workDiv(detail::createWorkDiv<TAcc>(getDev(viewHist), elementCount));
+
+            using ElemSrc = typename std::remove_pointer<decltype(view::getPtrNative(viewSrc))>::type;
+            ElemSrc const * const pSrc(view::getPtrNative(viewSrc));
+            TCount * const pHist(view::getPtrNative(viewHist));
+
+            if(static_cast<std::size_t>(binCount) * sizeof(TCount) <= detail::histogramSharedBytesMax)
+            {
+                alpaka::exec<TAcc>(
+                    queue,
+                    workDiv,
+                    detail::HistogramKernel<TCount, true>(),
+                    pSrc,
+                    elementCount,
+                    pHist,
+                    binCount,
+                    binOp);
+            }
+            else
+            {
+                alpaka::exec<TAcc>(
+                    queue,
+                    workDiv,
+                    detail::HistogramKernel<TCount, false>(),
+                    pSrc,
+                    elementCount,
+                    pHist,
+                    binCount,
+                    binOp);
+            }
+        }
+    }
+}
@@ -0,0 +1,278 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/algorithm/Common.hpp>
+
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! The identity operation.
+            struct Identity
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    T const & value) const
+                -> T
+                {
+                    return value;
+                }
+            };
+
+            //#############################################################################
+            //! The kernel reducing the transformed elements of each block.
+            //!
+            //! Each thread reduces its range within registers, afterwards the thread results are reduced within block shared memory.
+            //! If the result is final, the kernel has to be executed by a single block and combines its result with the initial value.
+            //! Otherwise each block writes its partial result to pDst[gridBlockIdx].
+            //!
+            //! \tparam T The type of the result.
+            template<
+                typename T>
+            struct TransformReduceKernel
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TElem,
+                    typename TReduceOp,
+                    typename TTransformOp>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TElem const * const pSrc,
+                    Idx<TAcc> const & elementCount,
+                    T * const pDst,
+                    bool const & bFinal,
+                    T const & init,
+                    TReduceOp const & reduceOp,
+                    TTransformOp const & transformOp) const
+                -> void
+                {
+                    auto const threadRange(
+                        getThreadRange<IsContiguousThreadRange<TAcc>::value>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    T threadResult(init);
+                    bool const bHasThreadResult(reduceRange(pSrc, threadRange, reduceOp, transformOp, threadResult));
+
+                    T * const pShared(block::dyn::getMem<T>(acc));
+                    bool * const pHasShared(
+                        static_cast<bool *>(
+                            static_cast<void *>(
+                                pShared + alpaka::getWorkDiv<Block, Threads>(acc)[0u])));
+
+                    T blockResult(init);
+                    bool const bHasBlockResult(blockReduce(acc, pShared, pHasShared, threadResult, bHasThreadResult, reduceOp, blockResult));
+
+                    if(getIdx<Block, Threads>(acc)[0u] == 0u)
+                    {
+                        if(bFinal)
+                        {
+                            pDst[0u] = bHasBlockResult ? reduceOp(init, blockResult) : init;
+                        }
+                        else
+                        {
+                            pDst[getIdx<Grid, Blocks>(acc)[0u]] = blockResult;
+                        }
+                    }
+                }
+            };
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The block shared dynamic memory size of the transform reduce kernel holds one value and one flag per thread.
+        template<
+            typename T,
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::TransformReduceKernel<T>,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::TransformReduceKernel<T> const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TArgs const & ... args)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(args...);
+
+                return algorithm::detail::getBlockSharedMemBytesPerThreadValue<T>(blockThreadExtent.prod());
+            }
+        };
+    }
+
+    namespace algorithm
+    {
+        //-----------------------------------------------------------------------------
+        //! Reduces the transformed elements of the source and stores the result in the first element of the destination.
+        //!
+        //! The elements are first reduced by all blocks in parallel, the partial results of the blocks are reduced by a second kernel.
+        //! The order of the operations is unspecified so the reduction operation has to be associative and commutative.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewDst The destination whose first element receives the result.
+        //! \param init The initial value. It is the result for empty sources.
+        //! \param reduceOp The binary reduction operation.
+        //! \param transformOp The unary operation applied to each source element before the reduction.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewDst,
+            typename T,
+            typename TReduceOp,
+            typename TTransformOp>
+        ALPAKA_FN_HOST auto transformReduce(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewDst & viewDst,
+            T const & init,
+            TReduceOp const & reduceOp,
+            TTransformOp const & transformOp)
+        -> void
+        {
+            static_assert(
+                Dim<TViewSrc>::value == 1u,
+                "The reduce algorithms require a one-dimensional source!");
+            static_assert(
+                std::is_same<Elem<TViewDst>, T>::value,
+                "The destination element type has to be the type of the initial value!");
+
+            using TIdx = Idx<TAcc>;
+
+            auto const & dev(getDev(viewDst));
+            auto const elementCount(static_cast<TIdx>(extent::getExtentProduct(viewSrc)));
+            auto const workDiv(detail::createWorkDiv<TAcc>(dev, elementCount));
+            auto const blockCount(workDiv.m_gridBlockExtent[0u]);
+
+            using ElemSrc = typename std::remove_pointer<decltype(view::getPtrNative(viewSrc))>::type;
+            ElemSrc const * const pSrc(view::getPtrNative(viewSrc));
+            T * const pDst(view::getPtrNative(viewDst));
+
+            if(blockCount == 1u)
+            {
+                alpaka::exec<TAcc>(
+                    queue,
+                    workDiv,
+                    detail::TransformReduceKernel<T>(),
+                    pSrc,
+                    elementCount,
+                    pDst,
+                    true,
+                    init,
+                    reduceOp,
+                    transformOp);
+                return;
+            }
+
+            auto bufPartial(allocBuf<T, TIdx>(dev, blockCount));
+            T * const pPartial(view::getPtrNative(bufPartial));
+            T const * const pPartialConst(pPartial);
+
+            alpaka::exec<TAcc>(
+                queue,
+                workDiv,
+                detail::TransformReduceKernel<T>(),
+                pSrc,
+                elementCount,
+                pPartial,
+                false,
+                init,
+                reduceOp,
+                transformOp);
+
+            // The partial results of the blocks are reduced by a single block.
+            auto workDivFinal(detail::createWorkDiv<TAcc>(dev, blockCount));
+            workDivFinal.m_gridBlockExtent[0u] = static_cast<TIdx>(1u);
+            alpaka::exec<TAcc>(
+                queue,
+                workDivFinal,
+                detail::TransformReduceKernel<T>(),
+                pPartialConst,
+                blockCount,
+                pDst,
+                true,
+                init,
+                reduceOp,
+                detail::Identity());
+
+            detail::keepAlive(queue, bufPartial);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Reduces the elements of the source and stores the result in the first element of the destination.
+        //!
+        //! The reduction operation has to be associative and commutative.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewDst The destination whose first element receives the result.
+        //! \param init The initial value. It is the result for empty sources.
+        //! \param reduceOp The binary reduction operation.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewDst,
+            typename T,
+            typename TReduceOp>
+        ALPAKA_FN_HOST auto reduce(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewDst & viewDst,
+            T const & init,
+            TReduceOp const & reduceOp)
+        -> void
+        {
+            algorithm::transformReduce<TAcc>(
+                queue,
+                viewSrc,
+                viewDst,
+                init,
+                reduceOp,
+                detail::Identity());
+        }
+    }
+}
@@ -0,0 +1,509 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/algorithm/Common.hpp>
+
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! Combines the values of all threads of the block in the order of the thread indices.
+            //!
+            //! Afterwards pShared[i] holds the combination of prefix and the values of all threads before thread i.
+            //! pHasShared[i] tells if this combination contains any value.
+            //!
+            //! \return If the combination of all values of the block contains any value. Only then total is set by the first thread of the block.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc,
+                typename T,
+                typename TOp>
+            ALPAKA_FN_HOST_ACC auto blockExclusiveScan(
+                TAcc const & acc,
+                T * const pShared,
+                bool * const pHasShared,
+                T const & value,
+                bool const bHasValue,
+                T const & prefix,
+                bool const bHasPrefix,
+                TOp const & op,
+                T & total)
+            -> bool
+            {
+                using TIdx = Idx<TAcc>;
+
+                TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+
+                if(bHasValue)
+                {
+                    pShared[blockThreadIdx] = value;
+                }
+                pHasShared[blockThreadIdx] = bHasValue;
+                block::syncBlockThreads(acc);
+
+                // The block size is small compared to the number of elements per block so a sequential scan is sufficient.
+                if(blockThreadIdx == 0u)
+                {
+                    T running(prefix);
+                    bool bHasRunning(bHasPrefix);
+                    for(TIdx t(0u); t < blockThreadCount; ++t)
+                    {
+                        bool const bHasCurrent(pHasShared[t]);
+                        pHasShared[t] = bHasRunning;
+                        if(bHasCurrent)
+                        {
+                            T const current(pShared[t]);
+                            if(bHasRunning)
+                            {
+                                pShared[t] = running;
+                                running = op(running, current);
+                            }
+                            else
+                            {
+                                running = current;
+                                bHasRunning = true;
+                            }
+                        }
+                        else if(bHasRunning)
+                        {
+                            pShared[t] = running;
+                        }
+                    }
+                    if(bHasRunning)
+                    {
+                        total = running;
+                    }
+                    // The total is passed to the other threads by the flag behind the last one.
+                    pHasShared[blockThreadCount] = bHasRunning;
+                }
+                block::syncBlockThreads(acc);
+
+                return pHasShared[blockThreadCount];
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Combines the elements of the range in order.
+            //!
+            //! \return If the range contained any element. Only then result is set.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TElem,
+                typename TIdx,
+                typename TOp>
+            ALPAKA_FN_HOST_ACC auto reduceRangeOrdered(
+                TElem const * const pSrc,
+                ThreadRange<TIdx> const & range,
+                TOp const & op,
+                T & result)
+            -> bool
+            {
+                if(range.m_begin >= range.m_end)
+                {
+                    return false;
+                }
+                result = pSrc[range.m_begin];
+                for(TIdx i(static_cast<TIdx>(range.m_begin + 1u)); i < range.m_end; ++i)
+                {
+                    result = op(result, pSrc[i]);
+                }
+                return true;
+            }
+
+            //#############################################################################
+            //! The kernel combining the elements of each block in order into pBlockSums[gridBlockIdx].
+            //!
+            //! \tparam T The type of the scan values.
+            template<
+                typename T>
+            struct ScanReduceBlocksKernel
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TElem,
+                    typename TOp>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TElem const * const pSrc,
+                    Idx<TAcc> const & elementCount,
+                    T * const pBlockSums,
+                    TOp const & op) const
+                -> void
+                {
+                    // The threads always process contiguous ranges because the order of the elements has to be kept.
+                    auto const threadRange(
+                        getThreadRange<true>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    T threadSum{};
+                    bool const bHasThreadSum(reduceRangeOrdered(pSrc, threadRange, op, threadSum));
+
+                    T * const pShared(block::dyn::getMem<T>(acc));
+                    bool * const pHasShared(
+                        static_cast<bool *>(
+                            static_cast<void *>(
+                                pShared + alpaka::getWorkDiv<Block, Threads>(acc)[0u])));
+
+                    T blockSum{};
+                    blockExclusiveScan(acc, pShared, pHasShared, threadSum, bHasThreadSum, threadSum, false, op, blockSum);
+
+                    // None of the blocks is empty so each one has a sum.
+                    if(getIdx<Block, Threads>(acc)[0u] == 0u)
+                    {
+                        pBlockSums[getIdx<Grid, Blocks>(acc)[0u]] = blockSum;
+                    }
+                }
+            };
+
+            //#############################################################################
+            //! The kernel replacing the block sums by the exclusive prefix of each block.
+            //!
+            //! It has to be executed by a single thread.
+            struct ScanBlockSumsKernel
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename T,
+                    typename TOp>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    T * const pBlockSums,
+                    Idx<TAcc> const & blockCount,
+                    bool const & bHasInit,
+                    T const & init,
+                    TOp const & op) const
+                -> void
+                {
+                    alpaka::ignore_unused(acc);
+
+                    // The prefix of the first block is only used if there is an initial value.
+                    T running(bHasInit ? op(init, pBlockSums[0u]) : pBlockSums[0u]);
+                    pBlockSums[0u] = init;
+                    for(Idx<TAcc> b(1u); b < blockCount; ++b)
+                    {
+                        T const current(pBlockSums[b]);
+                        pBlockSums[b] = running;
+                        running = op(running, current);
+                    }
+                }
+            };
+
+            //#############################################################################
+            //! The kernel scanning the elements of each block starting with the prefix of the block.
+            //!
+            //! The source may be equal to the destination.
+            //!
+            //! \tparam T The type of the scan values.
+            template<
+                typename T>
+            struct ScanKernel
+            {
+                //-----------------------------------------------------------------------------
+                //! \param pBlockPrefixes The exclusive prefixes of the blocks. Only required if there are multiple blocks.
+                //! \param bExclusive If the scan is exclusive. Only exclusive scans use the initial value.
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TElemSrc,
+                    typename TElemDst,
+                    typename TOp>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TElemSrc const * const pSrc,
+                    TElemDst * const pDst,
+                    Idx<TAcc> const & elementCount,
+                    T const * const pBlockPrefixes,
+                    bool const & bExclusive,
+                    T const & init,
+                    TOp const & op) const
+                -> void
+                {
+                    auto const gridBlockIdx(getIdx<Grid, Blocks>(acc)[0u]);
+                    auto const threadRange(
+                        getThreadRange<true>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    T threadSum(init);
+                    bool const bHasThreadSum(reduceRangeOrdered(pSrc, threadRange, op, threadSum));
+
+                    T * const pShared(block::dyn::getMem<T>(acc));
+                    bool * const pHasShared(
+                        static_cast<bool *>(
+                            static_cast<void *>(
+                                pShared + alpaka::getWorkDiv<Block, Threads>(acc)[0u])));
+
+                    bool const bHasBlockPrefix(bExclusive || (gridBlockIdx > 0u));
+                    T const blockPrefix((gridBlockIdx > 0u) ? pBlockPrefixes[gridBlockIdx] : init);
+                    T blockSum(init);
+                    blockExclusiveScan(acc, pShared, pHasShared, threadSum, bHasThreadSum, blockPrefix, bHasBlockPrefix, op, blockSum);
+
+                    auto const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                    bool bHasRunning(pHasShared[blockThreadIdx]);
+                    T running(bHasRunning ? pShared[blockThreadIdx] : init);
+                    for(auto i(threadRange.m_begin); i < threadRange.m_end; ++i)
+                    {
+                        // The element has to be read before writing the result because the scan may be in-place.
+                        T const current(pSrc[i]);
+                        if(bExclusive)
+                        {
+                            pDst[i] = running;
+                            running = op(running, current);
+                        }
+                        else
+                        {
+                            running = bHasRunning ? op(running, current) : current;
+                            bHasRunning = true;
+                            pDst[i] = running;
+                        }
+                    }
+                }
+            };
+
+            //-----------------------------------------------------------------------------
+            //! Scans the elements of the source into the destination.
+            //!
+            //! The scan is executed in three phases: the elements of each block are combined, the block sums are scanned by a single thread and finally each block scans its elements starting with its prefix.
+            //! A single-pass scan where each block looks back at the published prefixes of its predecessors would require forward progress guarantees between the blocks which the CPU accelerators do not give.
+            template<
+                typename TAcc,
+                typename TQueue,
+                typename TViewSrc,
+                typename TViewDst,
+                typename T,
+                typename TOp>
+            ALPAKA_FN_HOST auto scan(
+                TQueue & queue,
+                TViewSrc const & viewSrc,
+                TViewDst & viewDst,
+                bool const bExclusive,
+                T const & init,
+                TOp const & op)
+            -> void
+            {
+                static_assert(
+                    Dim<TViewSrc>::value == 1u && Dim<TViewDst>::value == 1u,
+                    "The scan algorithms require one-dimensional views!");
+
+                using TIdx = Idx<TAcc>;
+
+                auto const & dev(getDev(viewDst));
+                auto const elementCount(static_cast<TIdx>(extent::getExtentProduct(viewSrc)));
+                if(elementCount == 0u)
+                {
+                    return;
+                }
+                auto const workDiv(createWorkDiv<TAcc>(dev, elementCount));
+                auto const blockCount(workDiv.m_gridBlockExtent[0u]);
+
+                using ElemSrc = typename std::remove_pointer<decltype(view::getPtrNative(viewSrc))>::type;
+                ElemSrc const * const pSrc(view::getPtrNative(viewSrc));
+                auto const pDst(view::getPtrNative(viewDst));
+
+                if(blockCount == 1u)
+                {
+                    T const * const pBlockPrefixes(nullptr);
+                    alpaka::exec<TAcc>(
+                        queue,
+                        workDiv,
+                        ScanKernel<T>(),
+                        pSrc,
+                        pDst,
+                        elementCount,
+                        pBlockPrefixes,
+                        bExclusive,
+                        init,
+                        op);
+                    return;
+                }
+
+                auto bufBlockSums(allocBuf<T, TIdx>(dev, blockCount));
+                T * const pBlockSums(view::getPtrNative(bufBlockSums));
+                T const * const pBlockPrefixes(pBlockSums);
+
+                alpaka::exec<TAcc>(
+                    queue,
+                    workDiv,
+                    ScanReduceBlocksKernel<T>(),
+                    pSrc,
+                    elementCount,
+                    pBlockSums,
+                    op);
+
+                auto const one(Vec<DimInt<1u>, TIdx>(static_cast<TIdx>(1u)));
+                alpaka::exec<TAcc>(
+                    queue,
+                    WorkDivMembers<DimInt<1u>, TIdx>(one, one, one),
+                    ScanBlockSumsKernel(),
+                    pBlockSums,
+                    blockCount,
+                    bExclusive,
+                    init,
+                    op);
+
+                alpaka::exec<TAcc>(
+                    queue,
+                    workDiv,
+                    ScanKernel<T>(),
+                    pSrc,
+                    pDst,
+                    elementCount,
+                    pBlockPrefixes,
+                    bExclusive,
+                    init,
+                    op);
+
+                keepAlive(queue, bufBlockSums);
+            }
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The block shared dynamic memory size of the scan block reduction kernel holds one value per thread and one flag per thread plus one.
+        template<
+            typename T,
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::ScanReduceBlocksKernel<T>,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::ScanReduceBlocksKernel<T> const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TArgs const & ... args)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(args...);
+
+                return algorithm::detail::getBlockSharedMemBytesPerThreadValue<T>(blockThreadExtent.prod()) + sizeof(bool);
+            }
+        };
+
+        //#############################################################################
+        //! The block shared dynamic memory size of the scan kernel holds one value per thread and one flag per thread plus one.
+        template<
+            typename T,
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::ScanKernel<T>,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::ScanKernel<T> const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TArgs const & ... args)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(args...);
+
+                return algorithm::detail::getBlockSharedMemBytesPerThreadValue<T>(blockThreadExtent.prod()) + sizeof(bool);
+            }
+        };
+    }
+
+    namespace algorithm
+    {
+        //-----------------------------------------------------------------------------
+        //! Stores the combination of all source elements up to and including the i-th one into the i-th element of the destination.
+        //!
+        //! The operation has to be associative. The order of the operands is kept so it does not have to be commutative.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewDst The one-dimensional destination. It has to be at least as large as the source. It may be the source itself.
+        //! \param op The binary operation.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewDst,
+            typename TOp>
+        ALPAKA_FN_HOST auto inclusiveScan(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewDst & viewDst,
+            TOp const & op)
+        -> void
+        {
+            using T = Elem<TViewDst>;
+            detail::scan<TAcc>(queue, viewSrc, viewDst, false, T(), op);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Stores the combination of the initial value and all source elements before the i-th one into the i-th element of the destination.
+        //!
+        //! The operation has to be associative. The order of the operands is kept so it does not have to be commutative.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewDst The one-dimensional destination. It has to be at least as large as the source. It may be the source itself.
+        //! \param init The initial value. It is the first element of the result.
+        //! \param op The binary operation.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewDst,
+            typename TOp>
+        ALPAKA_FN_HOST auto exclusiveScan(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewDst & viewDst,
+            Elem<TViewDst> const & init,
+            TOp const & op)
+        -> void
+        {
+            detail::scan<TAcc>(queue, viewSrc, viewDst, true, init, op);
+        }
+    }
+}
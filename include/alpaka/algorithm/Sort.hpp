@@ -0,0 +1,631 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/algorithm/Common.hpp>
+#include <alpaka/algorithm/Reduce.hpp>
+#include <alpaka/algorithm/Scan.hpp>
+#include <alpaka/algorithm/Transform.hpp>
+
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace alpaka
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //! The number of bits sorted per radix pass.
+            //! Small digits keep the per-thread counters small so that a block can use the thread limit of the device.
+            constexpr std::size_t radixBits = 4u;
+            //! The number of buckets of a radix pass.
+            constexpr std::size_t radixBucketCount = static_cast<std::size_t>(1u) << radixBits;
+            //! The type of the per-thread digit counters in block shared memory.
+            using RadixCounter = std::uint16_t;
+            //! The maximum number of elements per block of the radix sort kernels.
+            //! The block local offsets of the digits have to be representable by a RadixCounter.
+            constexpr std::size_t radixBlockElemCountMax = std::numeric_limits<RadixCounter>::max();
+
+            //#############################################################################
+            //! Maps keys to unsigned integers with the same order.
+            template<
+                typename TKey,
+                typename TSfinae = void>
+            struct RadixKey;
+
+            //#############################################################################
+            template<
+                typename TKey>
+            struct RadixKey<
+                TKey,
+                std::enable_if_t<std::is_integral<TKey>::value && std::is_unsigned<TKey>::value>>
+            {
+                using Bits = TKey;
+
+                ALPAKA_FN_HOST_ACC static auto toBits(
+                    TKey const & key)
+                -> Bits
+                {
+                    return key;
+                }
+            };
+
+            //#############################################################################
+            //! Flipping the sign bit orders negative before positive values.
+            template<
+                typename TKey>
+            struct RadixKey<
+                TKey,
+                std::enable_if_t<std::is_integral<TKey>::value && std::is_signed<TKey>::value>>
+            {
+                using Bits = std::make_unsigned_t<TKey>;
+
+                ALPAKA_FN_HOST_ACC static auto toBits(
+                    TKey const & key)
+                -> Bits
+                {
+                    return static_cast<Bits>(static_cast<Bits>(key) ^ static_cast<Bits>(static_cast<Bits>(1u) << (sizeof(Bits) * CHAR_BIT - 1u)));
+                }
+            };
+
+            //#############################################################################
+            //! Negative values have all bits flipped so that larger magnitudes come first, positive ones only the sign bit.
+            template<
+                typename TKey>
+            struct RadixKey<
+                TKey,
+                std::enable_if_t<std::is_floating_point<TKey>::value>>
+            {
+                using Bits = std::conditional_t<sizeof(TKey) == 4u, std::uint32_t, std::uint64_t>;
+                static_assert(
+                    sizeof(Bits) == sizeof(TKey),
+                    "Only 32 and 64 bit floating point keys are supported!");
+
+                ALPAKA_FN_HOST_ACC static auto toBits(
+                    TKey const & key)
+                -> Bits
+                {
+                    Bits bits;
+                    std::memcpy(&bits, &key, sizeof(Bits));
+                    Bits const signBit(static_cast<Bits>(static_cast<Bits>(1u) << (sizeof(Bits) * CHAR_BIT - 1u)));
+                    return ((bits & signBit) != 0u) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+                }
+            };
+
+            //#############################################################################
+            //! The value type of sort operations without values.
+            struct NoValue
+            {};
+
+            //-----------------------------------------------------------------------------
+            //! Moves the value belonging to the key moved from src to dst.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TValue,
+                typename TIdx>
+            ALPAKA_FN_HOST_ACC auto moveValue(
+                TValue const * const pValuesSrc,
+                TValue * const pValuesDst,
+                TIdx const & src,
+                TIdx const & dst)
+            -> void
+            {
+                pValuesDst[dst] = pValuesSrc[src];
+            }
+            //-----------------------------------------------------------------------------
+            template<
+                typename TIdx>
+            ALPAKA_FN_HOST_ACC auto moveValue(
+                NoValue const * const pValuesSrc,
+                NoValue * const pValuesDst,
+                TIdx const & src,
+                TIdx const & dst)
+            -> void
+            {
+                alpaka::ignore_unused(pValuesSrc);
+                alpaka::ignore_unused(pValuesDst);
+                alpaka::ignore_unused(src);
+                alpaka::ignore_unused(dst);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The digit of the key sorted by the pass with the given shift.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TKey>
+            ALPAKA_FN_HOST_ACC auto getDigit(
+                TKey const & key,
+                std::size_t const & shift)
+            -> std::size_t
+            {
+                return static_cast<std::size_t>(RadixKey<TKey>::toBits(key) >> shift) & (radixBucketCount - 1u);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Counts the digits of the keys of the thread range in the column of the current thread.
+            //!
+            //! pCounts[digit * blockThreadCount + blockThreadIdx] is the count of the digit within the range of the thread.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc,
+                typename TKey>
+            ALPAKA_FN_HOST_ACC auto countDigits(
+                TAcc const & acc,
+                TKey const * const pKeys,
+                ThreadRange<Idx<TAcc>> const & threadRange,
+                std::size_t const & shift,
+                RadixCounter * const pCounts)
+            -> void
+            {
+                using TIdx = Idx<TAcc>;
+
+                TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+
+                for(std::size_t d(0u); d < radixBucketCount; ++d)
+                {
+                    pCounts[d * blockThreadCount + blockThreadIdx] = 0u;
+                }
+                for(TIdx i(threadRange.m_begin); i < threadRange.m_end; ++i)
+                {
+                    ++pCounts[getDigit(pKeys[i], shift) * blockThreadCount + blockThreadIdx];
+                }
+                block::syncBlockThreads(acc);
+            }
+
+            //#############################################################################
+            //! The kernel counting the digits of the keys of each block.
+            //!
+            //! The count of a digit within a block is stored in pBlockCounts[digit * gridBlockCount + gridBlockIdx].
+            //! An exclusive scan of this layout results in the first destination index of each digit of each block.
+            struct RadixCountKernel
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TKey>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TKey const * const pKeys,
+                    Idx<TAcc> const & elementCount,
+                    Idx<TAcc> * const pBlockCounts,
+                    std::size_t const & shift) const
+                -> void
+                {
+                    using TIdx = Idx<TAcc>;
+
+                    auto const threadRange(
+                        getThreadRange<true>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    RadixCounter * const pCounts(block::dyn::getMem<RadixCounter>(acc));
+                    countDigits(acc, pKeys, threadRange, shift, pCounts);
+
+                    TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                    TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+                    TIdx const gridBlockIdx(getIdx<Grid, Blocks>(acc)[0u]);
+                    TIdx const gridBlockCount(alpaka::getWorkDiv<Grid, Blocks>(acc)[0u]);
+                    for(TIdx d(blockThreadIdx); d < radixBucketCount; d += blockThreadCount)
+                    {
+                        TIdx sum(0u);
+                        for(TIdx t(0u); t < blockThreadCount; ++t)
+                        {
+                            sum += pCounts[d * blockThreadCount + t];
+                        }
+                        pBlockCounts[d * gridBlockCount + gridBlockIdx] = sum;
+                    }
+                }
+            };
+
+            //#############################################################################
+            //! The kernel moving the keys and values of each block to their destination.
+            //!
+            //! Each thread moves the keys of its contiguous range in order starting at the offset of the digit for the thread.
+            //! Therefore the order of equal digits is kept which makes the sort stable.
+            struct RadixScatterKernel
+            {
+                //-----------------------------------------------------------------------------
+                //! \param pBlockOffsets The exclusive scan of the block counts of RadixCountKernel.
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TKey,
+                    typename TValue>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TKey const * const pKeysSrc,
+                    TValue const * const pValuesSrc,
+                    TKey * const pKeysDst,
+                    TValue * const pValuesDst,
+                    Idx<TAcc> const & elementCount,
+                    Idx<TAcc> const * const pBlockOffsets,
+                    std::size_t const & shift) const
+                -> void
+                {
+                    using TIdx = Idx<TAcc>;
+
+                    auto const threadRange(
+                        getThreadRange<true>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    // The block offsets of the digits are followed by the per-thread counters.
+                    TIdx * const pDigitOffsets(block::dyn::getMem<TIdx>(acc));
+                    RadixCounter * const pCounts(reinterpret_cast<RadixCounter *>(pDigitOffsets + radixBucketCount));
+                    countDigits(acc, pKeysSrc, threadRange, shift, pCounts);
+
+                    TIdx const blockThreadIdx(getIdx<Block, Threads>(acc)[0u]);
+                    TIdx const blockThreadCount(alpaka::getWorkDiv<Block, Threads>(acc)[0u]);
+                    TIdx const gridBlockIdx(getIdx<Grid, Blocks>(acc)[0u]);
+                    TIdx const gridBlockCount(alpaka::getWorkDiv<Grid, Blocks>(acc)[0u]);
+
+                    // Replace the counts by the offsets of the threads relative to the block offset of the digit.
+                    for(TIdx d(blockThreadIdx); d < radixBucketCount; d += blockThreadCount)
+                    {
+                        pDigitOffsets[d] = pBlockOffsets[d * gridBlockCount + gridBlockIdx];
+                        RadixCounter running(0u);
+                        for(TIdx t(0u); t < blockThreadCount; ++t)
+                        {
+                            RadixCounter const count(pCounts[d * blockThreadCount + t]);
+                            pCounts[d * blockThreadCount + t] = running;
+                            running = static_cast<RadixCounter>(running + count);
+                        }
+                    }
+                    block::syncBlockThreads(acc);
+
+                    for(TIdx i(threadRange.m_begin); i < threadRange.m_end; ++i)
+                    {
+                        std::size_t const digit(getDigit(pKeysSrc[i], shift));
+                        TIdx const dst(static_cast<TIdx>(pDigitOffsets[digit] + pCounts[digit * blockThreadCount + blockThreadIdx]++));
+                        pKeysDst[dst] = pKeysSrc[i];
+                        moveValue(pValuesSrc, pValuesDst, i, dst);
+                    }
+                }
+            };
+
+            //#############################################################################
+            //! The addition of the radix offsets.
+            struct RadixOffsetAdd
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename T>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    T const & a,
+                    T const & b) const
+                -> T
+                {
+                    return a + b;
+                }
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The block shared dynamic memory size of the radix scatter kernel.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc>
+            ALPAKA_FN_HOST_ACC auto getRadixScatterSharedMemBytes(
+                std::size_t const & blockThreadCount)
+            -> std::size_t
+            {
+                return radixBucketCount * (sizeof(Idx<TAcc>) + blockThreadCount * sizeof(RadixCounter));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The work division of the radix sort kernels.
+            //!
+            //! The block thread count is only limited by the device and by the counters fitting into the shared memory.
+            //! Large inputs get additional blocks so that the block local offsets fit into a RadixCounter.
+            template<
+                typename TAcc,
+                typename TDev>
+            ALPAKA_FN_HOST auto createRadixWorkDiv(
+                TDev const & dev,
+                Idx<TAcc> const & elementCount)
+            -> WorkDivMembers<DimInt<1u>, Idx<TAcc>>
+            {
+                using TIdx = Idx<TAcc>;
+
+                auto const props(getAccDevProps<TAcc>(dev));
+                std::size_t const sharedMemBytesPerThread(getRadixScatterSharedMemBytes<TAcc>(1u) - getRadixScatterSharedMemBytes<TAcc>(0u));
+                std::size_t const sharedMemBlockThreadCount(
+                    (props.m_sharedMemSizeBytes > getRadixScatterSharedMemBytes<TAcc>(0u))
+                    ? (props.m_sharedMemSizeBytes - getRadixScatterSharedMemBytes<TAcc>(0u)) / sharedMemBytesPerThread
+                    : static_cast<std::size_t>(1u));
+
+                auto workDiv(
+                    createWorkDiv<TAcc>(
+                        dev,
+                        elementCount,
+                        std::min(sharedMemBlockThreadCount, static_cast<std::size_t>(props.m_blockThreadCountMax))));
+
+                TIdx const blockCountMin(static_cast<TIdx>((static_cast<std::size_t>(elementCount) + radixBlockElemCountMax - 1u) / radixBlockElemCountMax));
+                if(workDiv.m_gridBlockExtent[0u] >= blockCountMin)
+                {
+                    return workDiv;
+                }
+
+                // Remove the blocks that would be empty because of the rounding of the chunk size.
+                TIdx const blockElemCount(static_cast<TIdx>((elementCount + blockCountMin - 1u) / blockCountMin));
+                TIdx const blockCount(static_cast<TIdx>((elementCount + blockElemCount - 1u) / blockElemCount));
+                return
+                    WorkDivMembers<DimInt<1u>, TIdx>(
+                        Vec<DimInt<1u>, TIdx>(blockCount),
+                        workDiv.m_blockThreadExtent,
+                        workDiv.m_threadElemExtent);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Sorts the keys and values by a least significant digit radix sort.
+            //!
+            //! Each pass sorts by the next radixBits bits of the keys.
+            //! The digits of each block are counted, the counts are scanned to get the destination offsets and finally each block moves its keys to their destination.
+            //! The keys and values are moved between the given and the temporary memory in each pass.
+            template<
+                typename TAcc,
+                typename TQueue,
+                typename TDev,
+                typename TKey,
+                typename TValue>
+            ALPAKA_FN_HOST auto radixSort(
+                TQueue & queue,
+                TDev const & dev,
+                TKey * const pKeys,
+                TValue * const pValues,
+                TKey * const pKeysTmp,
+                TValue * const pValuesTmp,
+                Idx<TAcc> const & elementCount)
+            -> void
+            {
+                using TIdx = Idx<TAcc>;
+
+                auto const workDiv(createRadixWorkDiv<TAcc>(dev, elementCount));
+                auto const blockCount(workDiv.m_gridBlockExtent[0u]);
+
+                auto bufOffsets(allocBuf<TIdx, TIdx>(dev, static_cast<TIdx>(radixBucketCount * blockCount)));
+                TIdx * const pOffsets(view::getPtrNative(bufOffsets));
+                TIdx const * const pOffsetsConst(pOffsets);
+
+                TKey * pKeysSrc(pKeys);
+                TValue * pValuesSrc(pValues);
+                TKey * pKeysDst(pKeysTmp);
+                TValue * pValuesDst(pValuesTmp);
+                std::size_t const passCount(sizeof(TKey) * CHAR_BIT / radixBits);
+                for(std::size_t pass(0u); pass < passCount; ++pass)
+                {
+                    std::size_t const shift(pass * radixBits);
+                    TKey const * const pKeysSrcConst(pKeysSrc);
+                    TValue const * const pValuesSrcConst(pValuesSrc);
+
+                    alpaka::exec<TAcc>(
+                        queue,
+                        workDiv,
+                        RadixCountKernel(),
+                        pKeysSrcConst,
+                        elementCount,
+                        pOffsets,
+                        shift);
+                    scan<TAcc>(queue, bufOffsets, bufOffsets, true, static_cast<TIdx>(0u), RadixOffsetAdd());
+                    alpaka::exec<TAcc>(
+                        queue,
+                        workDiv,
+                        RadixScatterKernel(),
+                        pKeysSrcConst,
+                        pValuesSrcConst,
+                        pKeysDst,
+                        pValuesDst,
+                        elementCount,
+                        pOffsetsConst,
+                        shift);
+
+                    std::swap(pKeysSrc, pKeysDst);
+                    std::swap(pValuesSrc, pValuesDst);
+                }
+
+                // An odd number of passes leaves the result in the temporary memory.
+                if(pKeysSrc != pKeys)
+                {
+                    auto const workDivCopy(createWorkDiv<TAcc>(dev, elementCount));
+                    TKey const * const pKeysSrcConst(pKeysSrc);
+                    alpaka::exec<TAcc>(queue, workDivCopy, TransformKernel(), pKeys, elementCount, Identity(), pKeysSrcConst);
+                    if(!std::is_same<TValue, NoValue>::value)
+                    {
+                        TValue const * const pValuesSrcConst(pValuesSrc);
+                        alpaka::exec<TAcc>(queue, workDivCopy, TransformKernel(), pValues, elementCount, Identity(), pValuesSrcConst);
+                    }
+                }
+
+                keepAlive(queue, bufOffsets);
+            }
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The block shared dynamic memory size of the radix count kernel holds one counter per digit and thread.
+        template<
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::RadixCountKernel,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::RadixCountKernel const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TArgs const & ... args)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(args...);
+
+                return static_cast<std::size_t>(blockThreadExtent.prod()) * algorithm::detail::radixBucketCount * sizeof(algorithm::detail::RadixCounter);
+            }
+        };
+
+        //#############################################################################
+        //! The block shared dynamic memory size of the radix scatter kernel holds one offset per digit and one per digit and thread.
+        template<
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            algorithm::detail::RadixScatterKernel,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TDim,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                algorithm::detail::RadixScatterKernel const & kernelFnObj,
+                Vec<TDim, Idx<TAcc>> const & blockThreadExtent,
+                Vec<TDim, Idx<TAcc>> const & threadElemExtent,
+                TArgs const & ... args)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(kernelFnObj);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(args...);
+
+                return algorithm::detail::getRadixScatterSharedMemBytes<TAcc>(static_cast<std::size_t>(blockThreadExtent.prod()));
+            }
+        };
+    }
+
+    namespace algorithm
+    {
+        //-----------------------------------------------------------------------------
+        //! Sorts the keys in ascending order.
+        //!
+        //! The keys are sorted by a stable least significant digit radix sort which requires temporary memory of the size of the keys.
+        //! Signed and unsigned integral keys as well as 32 and 64 bit floating point keys are supported.
+        //! Negative floating point zeros are sorted before positive ones, NaNs are sorted to the ends depending on their sign.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewKeys The one-dimensional keys to sort in-place.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewKeys>
+        ALPAKA_FN_HOST auto sort(
+            TQueue & queue,
+            TViewKeys & viewKeys)
+        -> void
+        {
+            static_assert(
+                Dim<TViewKeys>::value == 1u,
+                "The sort algorithms require one-dimensional views!");
+
+            using TIdx = Idx<TAcc>;
+            using TKey = Elem<TViewKeys>;
+
+            auto const elementCount(static_cast<TIdx>(extent::getExtentProduct(viewKeys)));
+            if(elementCount <= 1u)
+            {
+                return;
+            }
+
+            auto const & dev(getDev(viewKeys));
+            auto bufKeysTmp(allocBuf<TKey, TIdx>(dev, elementCount));
+            detail::NoValue * const pNoValue(nullptr);
+
+            detail::radixSort<TAcc>(
+                queue,
+                dev,
+                view::getPtrNative(viewKeys),
+                pNoValue,
+                view::getPtrNative(bufKeysTmp),
+                pNoValue,
+                elementCount);
+
+            detail::keepAlive(queue, bufKeysTmp);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Sorts the keys in ascending order and moves the values along with their keys.
+        //!
+        //! The sort is stable so the values of equal keys keep their order.
+        //! It requires temporary memory of the size of the keys and the values.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewKeys The one-dimensional keys to sort in-place.
+        //! \param viewValues The one-dimensional values. It has to be at least as large as the keys.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewKeys,
+            typename TViewValues>
+        ALPAKA_FN_HOST auto sortByKey(
+            TQueue & queue,
+            TViewKeys & viewKeys,
+            TViewValues & viewValues)
+        -> void
+        {
+            static_assert(
+                Dim<TViewKeys>::value == 1u && Dim<TViewValues>::value == 1u,
+                "The sort algorithms require one-dimensional views!");
+
+            using TIdx = Idx<TAcc>;
+            using TKey = Elem<TViewKeys>;
+            using TValue = Elem<TViewValues>;
+
+            auto const elementCount(static_cast<TIdx>(extent::getExtentProduct(viewKeys)));
+            if(elementCount <= 1u)
+            {
+                return;
+            }
+
+            auto const & dev(getDev(viewKeys));
+            auto bufKeysTmp(allocBuf<TKey, TIdx>(dev, elementCount));
+            auto bufValuesTmp(allocBuf<TValue, TIdx>(dev, elementCount));
+
+            detail::radixSort<TAcc>(
+                queue,
+                dev,
+                view::getPtrNative(viewKeys),
+                view::getPtrNative(viewValues),
+                view::getPtrNative(bufKeysTmp),
+                view::getPtrNative(bufValuesTmp),
+                elementCount);
+
+            detail::keepAlive(queue, bufKeysTmp);
+            detail::keepAlive(queue, bufValuesTmp);
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/algorithm/Common.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace algorithm
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! The kernel applying an operation to each element.
+            struct TransformKernel
+            {
+                //-----------------------------------------------------------------------------
+                //! \param pDst The destination. May be equal to one of the sources.
+                //! \param elementCount The number of elements.
+                //! \param op The operation called with the elements of all sources at the same index.
+                //! \param pSrcs The sources.
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TElemDst,
+                    typename TOp,
+                    typename... TElemSrcs>
+                ALPAKA_FN_ACC auto operator()(
+                    TAcc const & acc,
+                    TElemDst * const pDst,
+                    Idx<TAcc> const & elementCount,
+                    TOp const & op,
+                    TElemSrcs const * const ... pSrcs) const
+                -> void
+                {
+                    auto const threadRange(
+                        getThreadRange<IsContiguousThreadRange<TAcc>::value>(
+                            acc,
+                            getBlockRange(acc, elementCount)));
+
+                    // For contiguous ranges the stride is one which allows the compiler to vectorize the loop.
+                    for(auto i(threadRange.m_begin); i < threadRange.m_end; i += threadRange.m_stride)
+                    {
+                        pDst[i] = op(pSrcs[i]...);
+                    }
+                }
+            };
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Applies the unary operation to each element of the source and stores the results in the destination.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc The one-dimensional source.
+        //! \param viewDst The one-dimensional destination. It has to be at least as large as the source. It may be the source itself.
+        //! \param op The operation.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc,
+            typename TViewDst,
+            typename TOp>
+        ALPAKA_FN_HOST auto transform(
+            TQueue & queue,
+            TViewSrc const & viewSrc,
+            TViewDst & viewDst,
+            TOp const & op)
+        -> void
+        {
+            static_assert(
+                Dim<TViewSrc>::value == 1u && Dim<TViewDst>::value == 1u,
+                "The transform algorithm requires one-dimensional views!");
+
+            auto const elementCount(static_cast<Idx<TAcc>>(extent::getExtentProduct(viewSrc)));
+            if(elementCount == 0u)
+            {
+                return;
+            }
+
+            alpaka::exec<TAcc>(
+                queue,
+                detail::createWorkDiv<TAcc>(getDev(viewDst), elementCount),
+                detail::TransformKernel(),
+                view::getPtrNative(viewDst),
+                elementCount,
+                op,
+                view::getPtrNative(viewSrc));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Applies the binary operation to the elements of both sources at the same index and stores the results in the destination.
+        //!
+        //! \tparam TAcc The accelerator executing the operation.
+        //! \param queue The queue to enqueue the operation into.
+        //! \param viewSrc0 The one-dimensional first source.
+        //! \param viewSrc1 The one-dimensional second source. It has to be at least as large as the first one.
+        //! \param viewDst The one-dimensional destination. It has to be at least as large as the first source. It may be one of the sources.
+        //! \param op The operation.
+        template<
+            typename TAcc,
+            typename TQueue,
+            typename TViewSrc0,
+            typename TViewSrc1,
+            typename TViewDst,
+            typename TOp>
+        ALPAKA_FN_HOST auto transform(
+            TQueue & queue,
+            TViewSrc0 const & viewSrc0,
+            TViewSrc1 const & viewSrc1,
+            TViewDst & viewDst,
+            TOp const & op)
+        -> void
+        {
+            static_assert(
+                Dim<TViewSrc0>::value == 1u && Dim<TViewSrc1>::value == 1u && Dim<TViewDst>::value == 1u,
+                "The transform algorithm requires one-dimensional views!");
+
+            auto const elementCount(static_cast<Idx<TAcc>>(extent::getExtentProduct(viewSrc0)));
+            if(elementCount == 0u)
+            {
+                return;
+            }
+
+            alpaka::exec<TAcc>(
+                queue,
+                detail::createWorkDiv<TAcc>(getDev(viewDst), elementCount),
+                detail::TransformKernel(),
+                view::getPtrNative(viewDst),
+                elementCount,
+                op,
+                view::getPtrNative(viewSrc0),
+                view::getPtrNative(viewSrc1));
+        }
+    }
+}
@@ -21,9 +21,12 @@
 #include <alpaka/acc/AccCpuSerial.hpp>
 #include <alpaka/acc/AccCpuThreads.hpp>
 #include <alpaka/acc/AccCpuFibers.hpp>
+#include <alpaka/acc/AccCpuFibersBase.hpp>
+#include <alpaka/acc/AccCpuFibersMt.hpp>
 #include <alpaka/acc/AccCpuTbbBlocks.hpp>
 #include <alpaka/acc/AccCpuOmp2Blocks.hpp>
 #include <alpaka/acc/AccCpuOmp2Threads.hpp>
+#include <alpaka/acc/AccCpuOmp2Simd.hpp>
 #include <alpaka/acc/AccOmp5.hpp>
 #include <alpaka/acc/AccGpuUniformCudaHipRt.hpp>
 #include <alpaka/acc/AccGpuCudaRt.hpp>
@@ -31,6 +34,13 @@
 #include <alpaka/acc/AccDevProps.hpp>
 #include <alpaka/acc/Traits.hpp>
 //-----------------------------------------------------------------------------
+// algorithm
+#include <alpaka/algorithm/Histogram.hpp>
+#include <alpaka/algorithm/Reduce.hpp>
+#include <alpaka/algorithm/Scan.hpp>
+#include <alpaka/algorithm/Sort.hpp>
+#include <alpaka/algorithm/Transform.hpp>
+//-----------------------------------------------------------------------------
 // atomic
 #include <alpaka/atomic/AtomicUniformCudaHipBuiltIn.hpp>
 #include <alpaka/atomic/AtomicNoOp.hpp>
@@ -46,6 +56,7 @@
         // dynamic
         #include <alpaka/block/shared/dyn/BlockSharedMemDynUniformCudaHipBuiltIn.hpp>
         #include <alpaka/block/shared/dyn/BlockSharedMemDynAlignedAlloc.hpp>
+        #include <alpaka/block/shared/dyn/BlockSharedMemDynArena.hpp>
         #include <alpaka/block/shared/dyn/BlockSharedMemDynMember.hpp>
         #include <alpaka/block/shared/dyn/Traits.hpp>
         //-----------------------------------------------------------------------------
@@ -83,6 +94,7 @@
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/core/Utility.hpp>
 #include <alpaka/core/Vectorize.hpp>
+#include <alpaka/core/WorkerPool.hpp>
 //-----------------------------------------------------------------------------
 // dev
 #include <alpaka/dev/DevUniformCudaHipRt.hpp>
@@ -104,8 +116,15 @@
 // extent
 #include <alpaka/extent/Traits.hpp>
 //-----------------------------------------------------------------------------
+// grid
+#include <alpaka/grid/sync/GridSyncBarrierOmp.hpp>
+#include <alpaka/grid/sync/GridSyncBlockSync.hpp>
+#include <alpaka/grid/sync/Traits.hpp>
+//-----------------------------------------------------------------------------
 // idx
+#include <alpaka/idx/batch/IdxBatchRef.hpp>
 #include <alpaka/idx/bt/IdxBtUniformCudaHipBuiltIn.hpp>
+#include <alpaka/idx/bt/IdxBtLinear.hpp>
 #include <alpaka/idx/bt/IdxBtOmp.hpp>
 #include <alpaka/idx/bt/IdxBtRefFiberIdMap.hpp>
 #include <alpaka/idx/bt/IdxBtRefThreadIdMap.hpp>
@@ -120,9 +139,12 @@
 #include <alpaka/kernel/TaskKernelCpuSerial.hpp>
 #include <alpaka/kernel/TaskKernelCpuThreads.hpp>
 #include <alpaka/kernel/TaskKernelCpuFibers.hpp>
+#include <alpaka/kernel/TaskKernelCpuFibersBase.hpp>
+#include <alpaka/kernel/TaskKernelCpuFibersMt.hpp>
 #include <alpaka/kernel/TaskKernelCpuTbbBlocks.hpp>
 #include <alpaka/kernel/TaskKernelCpuOmp2Blocks.hpp>
 #include <alpaka/kernel/TaskKernelCpuOmp2Threads.hpp>
+#include <alpaka/kernel/TaskKernelCpuOmp2Simd.hpp>
 #include <alpaka/kernel/TaskKernelOmp5.hpp>
 #include <alpaka/kernel/TaskKernelGpuUniformCudaHipRt.hpp>
 #include <alpaka/kernel/Traits.hpp>
@@ -133,15 +155,24 @@
 //-----------------------------------------------------------------------------
 // mem
 #include <alpaka/mem/alloc/AllocCpuAligned.hpp>
+#include <alpaka/mem/alloc/AllocCpuHugePage.hpp>
 #include <alpaka/mem/alloc/AllocCpuNew.hpp>
 #include <alpaka/mem/alloc/Traits.hpp>
 
 #include <alpaka/mem/buf/BufCpu.hpp>
+#include <alpaka/mem/buf/BufMmap.hpp>
 #include <alpaka/mem/buf/BufUniformCudaHipRt.hpp>
 #include <alpaka/mem/buf/BufOmp5.hpp>
+#include <alpaka/mem/buf/BufSoA.hpp>
 #include <alpaka/mem/buf/Traits.hpp>
 
+#include <alpaka/mem/view/Accessor.hpp>
+#include <alpaka/mem/view/AccessorSoA.hpp>
+#include <alpaka/mem/view/CopyBatch.hpp>
+#include <alpaka/mem/view/Layout.hpp>
 #include <alpaka/mem/view/ViewCompileTimeArray.hpp>
+#include <alpaka/mem/view/ViewLayout.hpp>
+#include <alpaka/mem/view/ViewMmap.hpp>
 #include <alpaka/mem/view/ViewPlainPtr.hpp>
 #include <alpaka/mem/view/ViewStdArray.hpp>
 #include <alpaka/mem/view/ViewStdVector.hpp>
@@ -178,6 +209,7 @@
 // rand
 #include <alpaka/rand/RandUniformCudaHipRand.hpp>
 #include <alpaka/rand/Traits.hpp>
+#include <alpaka/rand/UniformUintBounded.hpp>
 //-----------------------------------------------------------------------------
 // idx
 #include <alpaka/idx/Traits.hpp>
@@ -194,13 +226,19 @@
 // time
 #include <alpaka/time/Traits.hpp>
 //-----------------------------------------------------------------------------
+// trace
+#include <alpaka/trace/Trace.hpp>
+//-----------------------------------------------------------------------------
 // wait
 #include <alpaka/wait/Traits.hpp>
 //-----------------------------------------------------------------------------
 // workdiv
 #include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/workdiv/WorkDivRef.hpp>
+#include <alpaka/workdiv/WorkDivStatic.hpp>
 #include <alpaka/workdiv/Traits.hpp>
 #include <alpaka/workdiv/WorkDivHelpers.hpp>
+#include <alpaka/workdiv/WorkDivAutoTune.hpp>
 //-----------------------------------------------------------------------------
 // vec
 #include <alpaka/vec/Vec.hpp>
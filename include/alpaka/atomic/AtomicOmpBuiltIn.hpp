@@ -14,6 +14,12 @@
 #include <alpaka/atomic/Traits.hpp>
 #include <alpaka/atomic/Op.hpp>
 
+#include <alpaka/core/BoostPredef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
 namespace alpaka
 {
     //#############################################################################
@@ -38,6 +44,83 @@ namespace alpaka
         /*virtual*/ ~AtomicOmpBuiltIn() = default;
     };
 
+    namespace detail
+    {
+        //#############################################################################
+        //! The unsigned integer type with the given size.
+        template<
+            std::size_t TSize>
+        struct AtomicOmpBuiltInBits
+        {};
+        //#############################################################################
+        template<>
+        struct AtomicOmpBuiltInBits<1u>
+        {
+            using type = std::uint8_t;
+        };
+        //#############################################################################
+        template<>
+        struct AtomicOmpBuiltInBits<2u>
+        {
+            using type = std::uint16_t;
+        };
+        //#############################################################################
+        template<>
+        struct AtomicOmpBuiltInBits<4u>
+        {
+            using type = std::uint32_t;
+        };
+        //#############################################################################
+        template<>
+        struct AtomicOmpBuiltInBits<8u>
+        {
+            using type = std::uint64_t;
+        };
+
+        //#############################################################################
+        //! If the type has the size of an unsigned integer type.
+        template<
+            typename T>
+        struct HasAtomicOmpBuiltInBits : std::integral_constant<
+            bool,
+            (sizeof(T) == 1u) || (sizeof(T) == 2u) || (sizeof(T) == 4u) || (sizeof(T) == 8u)>
+        {};
+
+        //#############################################################################
+        //! If the atomic operations on the given type can be implemented by lock-free compare-and-swap.
+        template<
+            typename T>
+        struct IsAtomicOmpBuiltInCasLoopSupported : std::integral_constant<
+            bool,
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG || BOOST_COMP_INTEL
+            std::is_trivially_copyable<T>::value && HasAtomicOmpBuiltInBits<T>::value && __atomic_always_lock_free(sizeof(T), 0)
+#else
+            false
+#endif
+        >
+        {};
+
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG || BOOST_COMP_INTEL
+        //-----------------------------------------------------------------------------
+        //! \return The bit pattern of the value as unsigned integer.
+        //!
+        //! Reading an inactive union member is supported by all compilers using this code path.
+        template<
+            typename T>
+        ALPAKA_FN_HOST auto getAtomicOmpBuiltInBits(
+            T const & value)
+        -> typename AtomicOmpBuiltInBits<sizeof(T)>::type
+        {
+            union
+            {
+                T m_value;
+                typename AtomicOmpBuiltInBits<sizeof(T)>::type m_bits;
+            } const pun{value};
+            return pun.m_bits;
+        }
+#endif
+    }
+
     namespace traits
     {
 
@@ -230,7 +313,7 @@ namespace alpaka
         //#############################################################################
         //! The OpenMP accelerators atomic operation
         //
-        // generic implementations for operations where native atomics are not available
+        // generic implementations for operations where native atomics are not available (Min, Max, Inc, Dec, Cas)
         template<
             typename TOp,
             typename T,
@@ -247,6 +330,70 @@ namespace alpaka
                 T * const addr,
                 T const & value)
             -> T
+            {
+                return atomicOpImpl(addr, value, alpaka::detail::IsAtomicOmpBuiltInCasLoopSupported<T>());
+            }
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto atomicOp(
+                AtomicOmpBuiltIn const &,
+                T * const addr,
+                T const & compare,
+                T const & value)
+            -> T
+            {
+                return atomicOpImpl(addr, compare, value, alpaka::detail::IsAtomicOmpBuiltInCasLoopSupported<T>());
+            }
+
+        private:
+#if BOOST_COMP_GNUC || BOOST_COMP_CLANG || BOOST_COMP_INTEL
+            //-----------------------------------------------------------------------------
+            //! Lock-free implementation.
+            //! The new value is computed by the non-atomic operation on a local copy and written by a compare-and-swap loop.
+            ALPAKA_FN_HOST static auto atomicOpImpl(
+                T * const addr,
+                T const & value,
+                std::true_type)
+            -> T
+            {
+                T old;
+                __atomic_load(addr, &old, __ATOMIC_RELAXED);
+                T desired;
+                do
+                {
+                    desired = old;
+                    TOp()(&desired, value);
+                    // Do not write if the value would not change (e.g. min/max with a value not changing the extremum).
+                    if(alpaka::detail::getAtomicOmpBuiltInBits(desired) == alpaka::detail::getAtomicOmpBuiltInBits(old))
+                    {
+                        break;
+                    }
+                }
+                while(!__atomic_compare_exchange(addr, &old, &desired, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+                return old;
+            }
+            //-----------------------------------------------------------------------------
+            //! Lock-free implementation of the compare-and-swap operation.
+            //! It is a single strong compare-and-swap, so the values are compared by their bit patterns like on the GPU backends.
+            ALPAKA_FN_HOST static auto atomicOpImpl(
+                T * const addr,
+                T const & compare,
+                T const & value,
+                std::true_type)
+            -> T
+            {
+                T old(compare);
+                T desired(value);
+                __atomic_compare_exchange(addr, &old, &desired, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+                return old;
+            }
+#endif
+            //-----------------------------------------------------------------------------
+            //! Fallback for types and compilers without lock-free compare-and-swap.
+            ALPAKA_FN_HOST static auto atomicOpImpl(
+                T * const addr,
+                T const & value,
+                std::false_type)
+            -> T
             {
                 T old;
                 // \TODO: Currently not only the access to the same memory location is protected by a mutex but all atomic ops on all threads.
@@ -257,11 +404,12 @@ namespace alpaka
                 return old;
             }
             //-----------------------------------------------------------------------------
-            ALPAKA_FN_HOST static auto atomicOp(
-                AtomicOmpBuiltIn const &,
+            //! Fallback for types and compilers without lock-free compare-and-swap.
+            ALPAKA_FN_HOST static auto atomicOpImpl(
                 T * const addr,
                 T const & compare,
-                T const & value)
+                T const & value,
+                std::false_type)
             -> T
             {
                 T old;
@@ -0,0 +1,185 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/core/AlignedAlloc.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Vectorize.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#ifndef ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB
+#define ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB 30
+#endif
+
+namespace alpaka
+{
+    namespace block
+    {
+        namespace dyn
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! The block shared memory arena of the calling thread.
+                //!
+                //! The memory is kept for the lifetime of the thread and only grows, so a worker executing many blocks
+                //! or many kernels always gets the same cache line aligned memory which stays warm in the cache.
+                //! Only one block may use the arena of a thread at a time.
+                class BlockSharedMemArena
+                {
+                public:
+                    //! The alignment of the arena and of the begin of the static block shared memory.
+                    static constexpr std::size_t alignment =
+                        (core::vectorization::defaultAlignment > 64u) ? core::vectorization::defaultAlignment : 64u;
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The arena of the calling thread with a capacity of at least the given number of bytes.
+                    ALPAKA_FN_HOST static auto get(
+                        std::size_t const & sizeBytes)
+                    -> std::uint8_t *
+                    {
+                        thread_local BlockSharedMemArena arena;
+
+                        if(sizeBytes > arena.m_capacityBytes)
+                        {
+                            std::size_t const capacityBytes(roundUp(sizeBytes));
+                            // Release the old memory first so that the peak usage does not double.
+                            arena.m_mem.reset();
+                            arena.m_capacityBytes = 0u;
+                            arena.m_mem.reset(
+                                reinterpret_cast<std::uint8_t *>(
+                                    core::alignedAlloc(alignment, capacityBytes)));
+                            if(!arena.m_mem)
+                            {
+                                throw std::bad_alloc();
+                            }
+                            arena.m_capacityBytes = capacityBytes;
+                        }
+                        return arena.m_mem.get();
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The size rounded up to a multiple of the arena alignment.
+                    ALPAKA_FN_HOST static constexpr auto roundUp(
+                        std::size_t const & sizeBytes)
+                    -> std::size_t
+                    {
+                        return (sizeBytes / alignment + (sizeBytes % alignment > 0u)) * alignment;
+                    }
+
+                private:
+                    std::unique_ptr<
+                        std::uint8_t,
+                        core::AlignedDelete> m_mem;
+                    std::size_t m_capacityBytes = 0u;
+                };
+                constexpr std::size_t BlockSharedMemArena::alignment;
+            }
+
+            //#############################################################################
+            //! Dynamic block shared memory provider using the block shared memory arena of the executing thread.
+            //!
+            //! The dynamic block shared memory is sized at kernel launch. It is followed by the given number of
+            //! KiB reserved for static block shared memory.
+            //! Contrary to BlockSharedMemDynMember the accelerator object does not embed the memory and the size
+            //! of the dynamic block shared memory is not limited at compile time.
+            template<std::size_t TStaticAllocKiB = ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB>
+            class BlockSharedMemDynArena :
+                public concepts::Implements<ConceptBlockSharedDyn, BlockSharedMemDynArena<TStaticAllocKiB>>
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST BlockSharedMemDynArena(std::size_t sizeBytes)
+                    : m_dynPitch(detail::BlockSharedMemArena::roundUp(sizeBytes)),
+                      m_mem(detail::BlockSharedMemArena::get(m_dynPitch + staticAllocBytes()))
+                {}
+                //-----------------------------------------------------------------------------
+                //! Uses arena memory which has already been sized for the block.
+                //!
+                //! This allows multiple providers of the same block to share the memory.
+                //! \param mem The arena memory with a capacity of at least dynPitch + staticAllocBytes().
+                //! \param dynPitch The size of the dynamic block shared memory rounded up by BlockSharedMemArena::roundUp.
+                ALPAKA_FN_HOST BlockSharedMemDynArena(std::uint8_t * mem, std::size_t dynPitch)
+                    : m_dynPitch(dynPitch),
+                      m_mem(mem)
+                {}
+                //-----------------------------------------------------------------------------
+                BlockSharedMemDynArena(BlockSharedMemDynArena const &) = delete;
+                //-----------------------------------------------------------------------------
+                BlockSharedMemDynArena(BlockSharedMemDynArena &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(BlockSharedMemDynArena const &) -> BlockSharedMemDynArena & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(BlockSharedMemDynArena &&) -> BlockSharedMemDynArena & = delete;
+                //-----------------------------------------------------------------------------
+                /*virtual*/ ~BlockSharedMemDynArena() = default;
+
+                std::uint8_t* dynMemBegin() const {return m_mem;}
+
+                /*! \return the pointer to the begin of data after the portion allocated as dynamical shared memory.
+                    */
+                std::uint8_t* staticMemBegin() const
+                {
+                    return m_mem + m_dynPitch;
+                }
+
+                /*! \return the capacity for static block shared memory.
+                    */
+                std::size_t staticMemCapacity() const
+                {
+                    return staticAllocBytes();
+                }
+
+                //! Storage size in bytes reserved for static block shared memory
+                static constexpr std::size_t staticAllocBytes() {return TStaticAllocKiB<<10;}
+
+            private:
+                std::size_t m_dynPitch;
+                std::uint8_t* m_mem;
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                template<
+                    typename T,
+                    std::size_t TStaticAllocKiB>
+                struct GetMem<
+                    T,
+                    BlockSharedMemDynArena<TStaticAllocKiB>>
+                {
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align" // "cast from 'unsigned char*' to 'unsigned int*' increases required alignment of target type"
+#endif
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST static auto getMem(
+                        block::dyn::BlockSharedMemDynArena<TStaticAllocKiB> const &mem)
+                    -> T *
+                    {
+                        static_assert(
+                            core::vectorization::defaultAlignment >= alignof(T),
+                            "Unable to get block shared dynamic memory for types with alignment higher than defaultAlignment!");
+                        return reinterpret_cast<T*>(mem.dynMemBegin());
+                    }
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic pop
+#endif
+                };
+            }
+        }
+    }
+}
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) || defined(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
 
 #include <alpaka/block/sync/Traits.hpp>
 
@@ -457,6 +457,16 @@ namespace alpaka
                 std::atomic<bool> m_bShutdownFlag;
             };
 
+            //#############################################################################
+            //! The state of a dependency enqueued into a ConcurrentExecPool.
+            //!
+            //! It is guarded by the wakeup mutex of the pool it has been enqueued into.
+            struct ConcurrentExecPoolDependency
+            {
+                bool m_bReached = false;    //!< If the executors have reached the dependency in the task queue.
+                bool m_bResolved = false;   //!< If the dependency has been resolved.
+            };
+
             //#############################################################################
             //! ConcurrentExecPool using a condition variable to wait for new work.
             //!
@@ -495,6 +505,7 @@ namespace alpaka
                     m_numActiveTasks(0u),
                     m_mtxWakeup(),
                     m_cvWakeup(),
+                    m_numUnresolvedDependencies(0u),
                     m_bShutdownFlag(false)
                 {
                     if(concurrentExecutionCount < 1)
@@ -597,6 +608,64 @@ namespace alpaka
                     return future;
                 }
                 //-----------------------------------------------------------------------------
+                //! Enqueues a dependency in First In First Out (FIFO) order.
+                //!
+                //! As soon as the executor reaches the dependency, it does not start any further tasks until it has been resolved via resolveDependency.
+                //! Meanwhile the executor does not run any task but sleeps exactly like it does when there is no work at all.
+                //! This is only supported for pools with a single executor.
+                //! With more executors, the others could already have started tasks enqueued after the dependency before it is reached.
+                //!
+                //! \return The dependency to resolve.
+                auto enqueueDependency()
+                -> std::shared_ptr<ConcurrentExecPoolDependency>
+                {
+                    if(m_vConcurrentExecs.size() != 1u)
+                    {
+                        throw std::logic_error("Dependencies can only be enqueued into a ConcurrentExecPool with a single concurrent executor!");
+                    }
+
+                    auto spDependency(std::make_shared<ConcurrentExecPoolDependency>());
+
+                    enqueueTask(
+                        [this, spDependency]()
+                        {
+                            std::lock_guard<TMutex> lock(m_mtxWakeup);
+
+                            if(!spDependency->m_bResolved)
+                            {
+                                spDependency->m_bReached = true;
+                                ++m_numUnresolvedDependencies;
+                            }
+                        });
+
+                    return spDependency;
+                }
+                //-----------------------------------------------------------------------------
+                //! Resolves the given dependency and releases the tasks enqueued after it.
+                //!
+                //! This can be called before or after the executors have reached the dependency.
+                auto resolveDependency(
+                    std::shared_ptr<ConcurrentExecPoolDependency> const & spDependency)
+                -> void
+                {
+                    {
+                        std::lock_guard<TMutex> lock(m_mtxWakeup);
+
+                        if(spDependency->m_bResolved)
+                        {
+                            return;
+                        }
+                        spDependency->m_bResolved = true;
+
+                        if(spDependency->m_bReached)
+                        {
+                            --m_numUnresolvedDependencies;
+                        }
+                    }
+
+                    m_cvWakeup.notify_all();
+                }
+                //-----------------------------------------------------------------------------
                 //! \return The number of concurrent executors available.
                 auto getConcurrentExecutionCount() const
                 -> TIdx
@@ -621,24 +690,23 @@ namespace alpaka
                     {
                         auto currentTaskPackage = std::shared_ptr<ITaskPkg>{nullptr};
 
-                        // Use popTask so we only ever have one reference to the ITaskPkg
-                        if(popTask(currentTaskPackage))
-                        {
-                            currentTaskPackage->runTask();
-                        }
                         {
                             std::unique_lock<TMutex> lock(m_mtxWakeup);
-                            if(m_qTasks.empty())
-                            {
-                                // If the shutdown flag has been set since the last check, return now.
-                                if(m_bShutdownFlag)
-                                {
-                                    return;
-                                }
 
-                                m_cvWakeup.wait(lock, [this]() { return ((!m_qTasks.empty()) || m_bShutdownFlag); });
+                            // Sleep while there is no work or the remaining tasks are held back by a dependency.
+                            m_cvWakeup.wait(lock, [this]() { return ((!m_qTasks.empty()) && (m_numUnresolvedDependencies == 0u)) || m_bShutdownFlag; });
+
+                            // If the shutdown flag has been set since the last check, return now.
+                            if(m_bShutdownFlag)
+                            {
+                                return;
                             }
+
+                            // Use popTask so we only ever have one reference to the ITaskPkg
+                            popTask(currentTaskPackage);
                         }
+
+                        currentTaskPackage->runTask();
                     }
                 }
 
@@ -671,6 +739,7 @@ namespace alpaka
 
                 TMutex m_mtxWakeup;
                 TCondVar m_cvWakeup;
+                std::size_t m_numUnresolvedDependencies;    //!< The number of reached but not yet resolved dependencies. Guarded by m_mtxWakeup.
                 std::atomic<bool> m_bShutdownFlag;
             };
         }
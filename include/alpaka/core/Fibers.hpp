@@ -9,7 +9,7 @@
 
 #pragma once
 
-#ifdef ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) || defined(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
 
 #include <alpaka/core/BoostPredef.hpp>
 
@@ -34,6 +34,7 @@
 #include <boost/fiber/mutex.hpp>
 #include <boost/fiber/future.hpp>
 #include <boost/fiber/barrier.hpp>
+#include <boost/fiber/pooled_fixedsize_stack.hpp>
 
 #if BOOST_COMP_MSVC
     #undef NOMINMAX
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <alpaka/core/BoostPredef.hpp>
 #include <alpaka/core/Common.hpp>
 
 #include <cstddef>
@@ -17,22 +18,25 @@
 //-----------------------------------------------------------------------------
 //! Suggests vectorization of the directly following loop to the compiler.
 //!
+//! The hint asserts that there are no dependencies between the iterations of the loop.
+//!
 //! Usage:
-//!  `ALPAKA_VECTORIZE_HINT
+//!  `ALPAKA_VECTORIZE_HINT()
 //!  for(...){...}`
-// \TODO: Implement for other compilers.
 // See: http://stackoverflow.com/questions/2706286/pragmas-swp-ivdep-prefetch-support-in-various-compilers
-/*#if BOOST_COMP_INTEL || BOOST_COMP_HPACC
+#if BOOST_COMP_INTEL || BOOST_COMP_HPACC
     #define ALPAKA_VECTORIZE_HINT(...)  _Pragma("ivdep")
 #elif BOOST_COMP_PGI
     #define ALPAKA_VECTORIZE_HINT(...)  _Pragma("vector")
 #elif BOOST_COMP_MSVC
     #define ALPAKA_VECTORIZE_HINT(...)  __pragma(loop(ivdep))
+#elif BOOST_COMP_CLANG
+    #define ALPAKA_VECTORIZE_HINT(...)  _Pragma("clang loop vectorize(assume_safety)")
 #elif BOOST_COMP_GNUC
     #define ALPAKA_VECTORIZE_HINT(...)  _Pragma("GCC ivdep")
 #else
     #define ALPAKA_VECTORIZE_HINT(...)
-#endif*/
+#endif
 
 namespace alpaka
 {
@@ -0,0 +1,253 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace alpaka
+{
+    namespace core
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A pool of persistent operating system threads executing parallel jobs.
+            //!
+            //! The threads are created once and wait for the next job between the jobs.
+            //! A job consists of a number of work items which are identified by their worker index.
+            //! The calling thread executes the work items of its job which have not been taken by an idle thread of the pool.
+            //! Therefore jobs started concurrently from different threads share the pool instead of waiting for each other,
+            //! and jobs started from within a work item, e.g. by a kernel or a host task executed by the pool, can not deadlock.
+            //! The work items of a job must not depend on being executed concurrently.
+            class WorkerPool final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param workerCount The number of workers including the calling thread.
+                ALPAKA_FN_HOST explicit WorkerPool(
+                    std::size_t const & workerCount) :
+                        m_workerCount(std::max(workerCount, static_cast<std::size_t>(1u))),
+                        m_isShutdown(false)
+                {
+                    m_threads.reserve(m_workerCount - 1u);
+                    for(std::size_t workerIdx(1u); workerIdx < m_workerCount; ++workerIdx)
+                    {
+                        m_threads.emplace_back(
+                            [this]()
+                            {
+                                threadFn();
+                            });
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                WorkerPool(WorkerPool const &) = delete;
+                //-----------------------------------------------------------------------------
+                WorkerPool(WorkerPool &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkerPool const &) -> WorkerPool & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(WorkerPool &&) -> WorkerPool & = delete;
+                //-----------------------------------------------------------------------------
+                ~WorkerPool()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_mtx);
+                        m_isShutdown = true;
+                    }
+                    m_cvJob.notify_all();
+                    for(auto & thread : m_threads)
+                    {
+                        thread.join();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The pool shared by all users, which has one worker per hardware thread.
+                ALPAKA_FN_HOST static auto getInstance()
+                -> WorkerPool &
+                {
+                    static WorkerPool pool(static_cast<std::size_t>(std::thread::hardware_concurrency()));
+                    return pool;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The number of workers including the calling thread.
+                ALPAKA_FN_HOST auto getWorkerCount() const
+                -> std::size_t
+                {
+                    return m_workerCount;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Calls the function with the indices of the given number of workers and waits for all of them.
+                //!
+                //! The calls are executed in parallel by the calling thread and the idle threads of the pool.
+                //! The first exception thrown by a worker is rethrown after all workers have finished.
+                //! \param workerCount The number of workers to use. It is limited to the size of the pool.
+                //! \param fn The function called as fn(std::size_t workerIdx).
+                template<
+                    typename TFn>
+                ALPAKA_FN_HOST auto run(
+                    std::size_t const & workerCount,
+                    TFn const & fn)
+                -> void
+                {
+                    Job job(
+                        std::cref(fn),
+                        std::min(std::max(workerCount, static_cast<std::size_t>(1u)), m_workerCount));
+
+                    if(job.m_workerCount > 1u)
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(m_mtx);
+                            m_jobs.push_back(&job);
+                        }
+                        m_cvJob.notify_all();
+                    }
+
+                    // Execute the work items which have not been taken by the threads of the pool.
+                    for(;;)
+                    {
+                        std::size_t workerIdx(0u);
+                        {
+                            std::lock_guard<std::mutex> lock(m_mtx);
+                            if(job.m_nextWorkerIdx == job.m_workerCount)
+                            {
+                                break;
+                            }
+                            workerIdx = takeWorkerIdx(job);
+                        }
+                        execute(job, workerIdx);
+                    }
+
+                    std::unique_lock<std::mutex> lock(m_mtx);
+                    m_cvDone.wait(lock, [&job](){return job.m_pendingWorkerCount == 0u;});
+                    if(job.m_exception)
+                    {
+                        std::rethrow_exception(job.m_exception);
+                    }
+                }
+
+            private:
+                //#############################################################################
+                //! A job started by run.
+                struct Job
+                {
+                    //-----------------------------------------------------------------------------
+                    Job(
+                        std::function<void(std::size_t)> fn,
+                        std::size_t const workerCount) :
+                            m_fn(std::move(fn)),
+                            m_workerCount(workerCount),
+                            m_nextWorkerIdx(0u),
+                            m_pendingWorkerCount(workerCount)
+                    {}
+
+                    std::function<void(std::size_t)> const m_fn;
+                    std::size_t const m_workerCount;
+                    std::size_t m_nextWorkerIdx;                //!< The index of the next work item to be taken.
+                    std::size_t m_pendingWorkerCount;           //!< The number of work items which have not finished yet.
+                    std::exception_ptr m_exception;
+                };
+
+                //-----------------------------------------------------------------------------
+                //! \return The index of the next work item of the job. It is removed from the waiting jobs when its last work item is taken.
+                //! Has to be called with m_mtx locked.
+                ALPAKA_FN_HOST auto takeWorkerIdx(
+                    Job & job)
+                -> std::size_t
+                {
+                    std::size_t const workerIdx(job.m_nextWorkerIdx++);
+                    if(job.m_nextWorkerIdx == job.m_workerCount)
+                    {
+                        auto const it(std::find(m_jobs.begin(), m_jobs.end(), &job));
+                        if(it != m_jobs.end())
+                        {
+                            m_jobs.erase(it);
+                        }
+                    }
+                    return workerIdx;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Executes a work item of the job.
+                ALPAKA_FN_HOST auto execute(
+                    Job & job,
+                    std::size_t const workerIdx)
+                -> void
+                {
+                    std::exception_ptr exception;
+                    try
+                    {
+                        job.m_fn(workerIdx);
+                    }
+                    catch(...)
+                    {
+                        exception = std::current_exception();
+                    }
+
+                    std::lock_guard<std::mutex> lock(m_mtx);
+                    if(exception && !job.m_exception)
+                    {
+                        job.m_exception = exception;
+                    }
+                    // The job may be destroyed by its thread as soon as the mutex is released.
+                    if(--job.m_pendingWorkerCount == 0u)
+                    {
+                        m_cvDone.notify_all();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The function executed by each thread of the pool.
+                ALPAKA_FN_HOST auto threadFn()
+                -> void
+                {
+                    for(;;)
+                    {
+                        Job * pJob(nullptr);
+                        std::size_t workerIdx(0u);
+                        {
+                            std::unique_lock<std::mutex> lock(m_mtx);
+                            m_cvJob.wait(lock, [this](){return m_isShutdown || !m_jobs.empty();});
+                            if(m_isShutdown)
+                            {
+                                return;
+                            }
+                            pJob = m_jobs.front();
+                            workerIdx = takeWorkerIdx(*pJob);
+                        }
+
+                        execute(*pJob, workerIdx);
+                    }
+                }
+
+                std::size_t const m_workerCount;
+                std::vector<std::thread> m_threads;
+
+                std::mutex m_mtx;                           //!< Protects the jobs.
+                std::condition_variable m_cvJob;
+                std::condition_variable m_cvDone;
+                std::deque<Job *> m_jobs;                   //!< The jobs with work items which have not been taken yet.
+                bool m_isShutdown;
+            };
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/cpu/SysInfo.hpp>
+#include <alpaka/dev/cpu/Topology.hpp>
 
 #include <alpaka/queue/Traits.hpp>
 #include <alpaka/queue/Properties.hpp>
@@ -169,6 +170,19 @@ namespace alpaka
         std::shared_ptr<cpu::detail::DevCpuImpl> m_spDevCpuImpl;
     };
 
+    //-----------------------------------------------------------------------------
+    //! \return The topology of the cores, caches and NUMA nodes of the CPU device.
+    //!
+    //! It is read once from the operating system and cpuid.
+    ALPAKA_FN_HOST inline auto getTopology(
+        DevCpu const & dev)
+    -> cpu::Topology const &
+    {
+        alpaka::ignore_unused(dev);
+
+        return cpu::detail::getTopology();
+    }
+
     namespace traits
     {
         //#############################################################################
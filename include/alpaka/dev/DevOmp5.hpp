@@ -26,7 +26,6 @@
 #include <alpaka/core/Omp5.hpp>
 
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
-#include <alpaka/queue/QueueGenericThreadsNonBlocking.hpp>
 #include <alpaka/queue/QueueGenericThreadsBlocking.hpp>
 
 namespace alpaka
@@ -40,6 +39,7 @@ namespace alpaka
         struct GetDevByIdx;
     }
     class PltfOmp5;
+    class QueueOmp5NonBlocking;
 
     namespace omp5
     {
@@ -285,7 +285,6 @@ namespace alpaka
             using type = PltfOmp5;
         };
     }
-    using QueueOmp5NonBlocking = QueueGenericThreadsNonBlocking<DevOmp5>;
     using QueueOmp5Blocking = QueueGenericThreadsBlocking<DevOmp5>;
 
     namespace traits
@@ -330,4 +329,6 @@ namespace alpaka
     }
 }
 
+#include <alpaka/queue/QueueOmp5NonBlocking.hpp>
+
 #endif
@@ -0,0 +1,463 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/dev/cpu/SysInfo.hpp>
+
+#if BOOST_OS_LINUX
+    #include <fstream>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace cpu
+    {
+        //#############################################################################
+        //! The kind of data held by a CPU cache.
+        enum class CacheType
+        {
+            Data,
+            Instruction,
+            Unified
+        };
+
+        //#############################################################################
+        //! The properties of a CPU cache.
+        struct CacheInfo
+        {
+            //! The level of the cache starting with 1.
+            std::uint32_t m_level;
+            //! The kind of data held by the cache.
+            CacheType m_type;
+            //! The size of the cache in bytes.
+            std::size_t m_sizeBytes;
+            //! The size of a cache line in bytes.
+            std::size_t m_lineSizeBytes;
+            //! The number of ways or 0 if unknown.
+            std::uint32_t m_associativity;
+            //! The number of logical cores sharing one instance of the cache.
+            std::size_t m_sharingLogicalCoreCount;
+        };
+
+        //#############################################################################
+        //! The topology of the CPUs of the system.
+        //!
+        //! On Linux it is read from /sys/devices/system. On other systems the caches are read with cpuid and
+        //! every logical core reported by std::thread::hardware_concurrency is assumed to be a physical core.
+        struct Topology
+        {
+            //! The number of logical cores (hardware threads) which are online.
+            std::size_t m_logicalCoreCount;
+            //! The number of physical cores.
+            std::size_t m_physicalCoreCount;
+            //! The number of processor packages (sockets).
+            std::size_t m_packageCount;
+            //! The indices of the logical cores of each physical core, i.e. the SMT siblings.
+            std::vector<std::vector<std::size_t>> m_coreLogicalCores;
+            //! The caches seen by the first logical core ordered by level.
+            std::vector<CacheInfo> m_caches;
+            //! The distances between the NUMA nodes as reported by the system, where 10 is the local distance.
+            //! m_numaDistances[i][j] is the distance of node j from node i. There is at least one node.
+            std::vector<std::vector<std::uint32_t>> m_numaDistances;
+        };
+
+        //-----------------------------------------------------------------------------
+        //! \return The maximum number of logical cores of a physical core.
+        inline auto getSmtWidth(
+            Topology const & topology)
+        -> std::size_t
+        {
+            std::size_t smtWidth(1u);
+            for(auto const & logicalCores : topology.m_coreLogicalCores)
+            {
+                smtWidth = std::max(smtWidth, logicalCores.size());
+            }
+            return smtWidth;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return The size in bytes of the data or unified cache of the given level or 0 if there is none.
+        inline auto getCacheSizeBytes(
+            Topology const & topology,
+            std::uint32_t const level)
+        -> std::size_t
+        {
+            for(auto const & cache : topology.m_caches)
+            {
+                if((cache.m_level == level) && (cache.m_type != CacheType::Instruction))
+                {
+                    return cache.m_sizeBytes;
+                }
+            }
+            return 0u;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return The cache line size in bytes of the first level data cache or 64 if it is unknown.
+        inline auto getCacheLineSizeBytes(
+            Topology const & topology)
+        -> std::size_t
+        {
+            for(auto const & cache : topology.m_caches)
+            {
+                if((cache.m_type != CacheType::Instruction) && (cache.m_lineSizeBytes > 0u))
+                {
+                    return cache.m_lineSizeBytes;
+                }
+            }
+            return 64u;
+        }
+
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The indices in a Linux CPU list like "0-3,8,10-11".
+            inline auto parseCpuList(
+                std::string const & list)
+            -> std::vector<std::size_t>
+            {
+                std::vector<std::size_t> indices;
+                std::stringstream ss(list);
+                std::string range;
+                while(std::getline(ss, range, ','))
+                {
+                    if(range.empty() || (range.find_first_of("0123456789") == std::string::npos))
+                    {
+                        continue;
+                    }
+                    auto const dashPos(range.find('-'));
+                    std::size_t const first(static_cast<std::size_t>(std::stoull(range.substr(0u, dashPos))));
+                    std::size_t const last(
+                        (dashPos == std::string::npos)
+                        ? first
+                        : static_cast<std::size_t>(std::stoull(range.substr(dashPos + 1u))));
+                    for(std::size_t i(first); i <= last; ++i)
+                    {
+                        indices.push_back(i);
+                    }
+                }
+                return indices;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The size in bytes of a Linux size string like "48K".
+            inline auto parseSize(
+                std::string const & size)
+            -> std::size_t
+            {
+                std::size_t pos(0u);
+                std::size_t value(static_cast<std::size_t>(std::stoull(size, &pos)));
+                if(pos < size.size())
+                {
+                    switch(size[pos])
+                    {
+                        case 'K': value <<= 10u; break;
+                        case 'M': value <<= 20u; break;
+                        case 'G': value <<= 30u; break;
+                        default: break;
+                    }
+                }
+                return value;
+            }
+
+#if BOOST_OS_LINUX
+            //-----------------------------------------------------------------------------
+            //! Reads the first line of the given file.
+            //! \return If the file could be read.
+            inline auto readSysFile(
+                std::string const & path,
+                std::string & line)
+            -> bool
+            {
+                std::ifstream file(path);
+                return static_cast<bool>(std::getline(file, line));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Reads the cores and packages of the online logical cores from /sys/devices/system/cpu.
+            //! \return If the topology could be read.
+            inline auto readSysCores(
+                Topology & topology)
+            -> bool
+            {
+                std::string line;
+                if(!readSysFile("/sys/devices/system/cpu/online", line))
+                {
+                    return false;
+                }
+                auto const logicalCores(parseCpuList(line));
+                if(logicalCores.empty())
+                {
+                    return false;
+                }
+
+                // A physical core is identified by its package and its core id within the package.
+                std::map<std::pair<std::size_t, std::size_t>, std::vector<std::size_t>> cores;
+                std::set<std::size_t> packages;
+                for(auto const logicalCore : logicalCores)
+                {
+                    std::string const dir("/sys/devices/system/cpu/cpu" + std::to_string(logicalCore) + "/topology/");
+                    std::string packageId;
+                    std::string coreId;
+                    if(!readSysFile(dir + "physical_package_id", packageId) || !readSysFile(dir + "core_id", coreId))
+                    {
+                        return false;
+                    }
+                    auto const key(
+                        std::make_pair(
+                            static_cast<std::size_t>(std::stoull(packageId)),
+                            static_cast<std::size_t>(std::stoull(coreId))));
+                    cores[key].push_back(logicalCore);
+                    packages.insert(key.first);
+                }
+
+                topology.m_logicalCoreCount = logicalCores.size();
+                topology.m_physicalCoreCount = cores.size();
+                topology.m_packageCount = packages.size();
+                topology.m_coreLogicalCores.clear();
+                for(auto & core : cores)
+                {
+                    topology.m_coreLogicalCores.push_back(std::move(core.second));
+                }
+                return true;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Reads the caches of the first online logical core from /sys/devices/system/cpu.
+            //! \return If at least one cache could be read.
+            inline auto readSysCaches(
+                std::size_t const logicalCore,
+                std::vector<CacheInfo> & caches)
+            -> bool
+            {
+                std::string const dir("/sys/devices/system/cpu/cpu" + std::to_string(logicalCore) + "/cache/index");
+                for(std::size_t index(0u);; ++index)
+                {
+                    std::string const indexDir(dir + std::to_string(index) + "/");
+                    std::string level;
+                    std::string type;
+                    std::string size;
+                    if(!readSysFile(indexDir + "level", level) || !readSysFile(indexDir + "type", type) || !readSysFile(indexDir + "size", size))
+                    {
+                        break;
+                    }
+
+                    CacheInfo cache{};
+                    cache.m_level = static_cast<std::uint32_t>(std::stoul(level));
+                    cache.m_type =
+                        (type == "Data") ? CacheType::Data
+                        : ((type == "Instruction") ? CacheType::Instruction : CacheType::Unified);
+                    cache.m_sizeBytes = parseSize(size);
+
+                    std::string value;
+                    if(readSysFile(indexDir + "coherency_line_size", value))
+                    {
+                        cache.m_lineSizeBytes = static_cast<std::size_t>(std::stoull(value));
+                    }
+                    if(readSysFile(indexDir + "ways_of_associativity", value))
+                    {
+                        cache.m_associativity = static_cast<std::uint32_t>(std::stoul(value));
+                    }
+                    cache.m_sharingLogicalCoreCount =
+                        readSysFile(indexDir + "shared_cpu_list", value)
+                        ? std::max(parseCpuList(value).size(), static_cast<std::size_t>(1u))
+                        : 1u;
+                    caches.push_back(cache);
+                }
+                return !caches.empty();
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Reads the distances between the online NUMA nodes from /sys/devices/system/node.
+            //! \return If the distances could be read.
+            inline auto readSysNumaDistances(
+                std::vector<std::vector<std::uint32_t>> & distances)
+            -> bool
+            {
+                std::string line;
+                if(!readSysFile("/sys/devices/system/node/online", line))
+                {
+                    return false;
+                }
+                auto const nodes(parseCpuList(line));
+                if(nodes.empty())
+                {
+                    return false;
+                }
+
+                distances.clear();
+                for(auto const node : nodes)
+                {
+                    if(!readSysFile("/sys/devices/system/node/node" + std::to_string(node) + "/distance", line))
+                    {
+                        return false;
+                    }
+                    // The file contains the distances to all possible nodes, so only the online ones are kept.
+                    std::vector<std::uint32_t> allDistances;
+                    std::stringstream ss(line);
+                    std::uint32_t distance(0u);
+                    while(ss >> distance)
+                    {
+                        allDistances.push_back(distance);
+                    }
+                    std::vector<std::uint32_t> nodeDistances;
+                    for(auto const other : nodes)
+                    {
+                        nodeDistances.push_back((other < allDistances.size()) ? allDistances[other] : 0u);
+                    }
+                    distances.push_back(std::move(nodeDistances));
+                }
+                return true;
+            }
+#endif
+
+            //-----------------------------------------------------------------------------
+            //! Reads the caches with the deterministic cache parameters of cpuid.
+            //!
+            //! Intel reports them in leaf 4 and AMD in leaf 0x8000001D.
+            //! \return If at least one cache could be read.
+            inline auto readCpuidCaches(
+                std::vector<CacheInfo> & caches)
+            -> bool
+            {
+                std::uint32_t ex[4] = {0};
+                cpuid(0u, 0u, ex);
+                std::uint32_t const maxLeaf(ex[0]);
+                char vendor[13] = {0};
+                std::memcpy(vendor, &ex[1], 4u);
+                std::memcpy(vendor + 4, &ex[3], 4u);
+                std::memcpy(vendor + 8, &ex[2], 4u);
+
+                std::uint32_t leaf(0u);
+                if((std::strcmp(vendor, "GenuineIntel") == 0) && (maxLeaf >= 4u))
+                {
+                    leaf = 4u;
+                }
+                else if(std::strcmp(vendor, "AuthenticAMD") == 0)
+                {
+                    cpuid(0x80000000u, 0u, ex);
+                    if(ex[0] >= 0x8000001Du)
+                    {
+                        leaf = 0x8000001Du;
+                    }
+                }
+                if(leaf == 0u)
+                {
+                    return false;
+                }
+
+                for(std::uint32_t subleaf(0u);; ++subleaf)
+                {
+                    cpuid(leaf, subleaf, ex);
+                    std::uint32_t const type(ex[0] & 0x1Fu);
+                    if(type == 0u)
+                    {
+                        break;
+                    }
+
+                    std::size_t const lineSize((ex[1] & 0xFFFu) + 1u);
+                    std::size_t const partitions(((ex[1] >> 12u) & 0x3FFu) + 1u);
+                    std::size_t const ways(((ex[1] >> 22u) & 0x3FFu) + 1u);
+                    std::size_t const sets(static_cast<std::size_t>(ex[2]) + 1u);
+
+                    CacheInfo cache{};
+                    cache.m_level = (ex[0] >> 5u) & 0x7u;
+                    cache.m_type =
+                        (type == 1u) ? CacheType::Data
+                        : ((type == 2u) ? CacheType::Instruction : CacheType::Unified);
+                    cache.m_sizeBytes = ways * partitions * lineSize * sets;
+                    cache.m_lineSizeBytes = lineSize;
+                    cache.m_associativity = static_cast<std::uint32_t>(ways);
+                    cache.m_sharingLogicalCoreCount = static_cast<std::size_t>(((ex[0] >> 14u) & 0xFFFu) + 1u);
+                    caches.push_back(cache);
+                }
+                return !caches.empty();
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The topology of the system read from the operating system or cpuid.
+            inline auto readTopology()
+            -> Topology
+            {
+                Topology topology{};
+
+#if BOOST_OS_LINUX
+                bool const hasSysCores(readSysCores(topology));
+#else
+                bool const hasSysCores(false);
+#endif
+                if(!hasSysCores)
+                {
+                    std::size_t const logicalCoreCount(std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1u)));
+                    topology.m_logicalCoreCount = logicalCoreCount;
+                    topology.m_physicalCoreCount = logicalCoreCount;
+                    topology.m_packageCount = 1u;
+                    topology.m_coreLogicalCores.clear();
+                    for(std::size_t i(0u); i < logicalCoreCount; ++i)
+                    {
+                        topology.m_coreLogicalCores.push_back({i});
+                    }
+                }
+
+#if BOOST_OS_LINUX
+                bool const hasSysCaches(readSysCaches(topology.m_coreLogicalCores.front().front(), topology.m_caches));
+#else
+                bool const hasSysCaches(false);
+#endif
+                if(!hasSysCaches)
+                {
+                    topology.m_caches.clear();
+                    readCpuidCaches(topology.m_caches);
+                }
+                std::sort(
+                    topology.m_caches.begin(),
+                    topology.m_caches.end(),
+                    [](CacheInfo const & a, CacheInfo const & b)
+                    {
+                        return (a.m_level < b.m_level) || ((a.m_level == b.m_level) && (a.m_type < b.m_type));
+                    });
+
+#if BOOST_OS_LINUX
+                bool const hasSysNuma(readSysNumaDistances(topology.m_numaDistances));
+#else
+                bool const hasSysNuma(false);
+#endif
+                if(!hasSysNuma)
+                {
+                    topology.m_numaDistances = {{10u}};
+                }
+
+                return topology;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The topology of the system which is read once.
+            inline auto getTopology()
+            -> Topology const &
+            {
+                static Topology const topology(readTopology());
+                return topology;
+            }
+        }
+    }
+}
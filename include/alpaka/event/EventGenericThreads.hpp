@@ -12,6 +12,7 @@
 #include <alpaka/core/Assert.hpp>
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/core/Utility.hpp>
+#include <alpaka/trace/Trace.hpp>
 
 #include <alpaka/dev/Traits.hpp>
 #include <alpaka/event/Traits.hpp>
@@ -24,6 +25,13 @@
 #include <mutex>
 #include <condition_variable>
 #include <future>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>
 #endif
@@ -47,7 +55,9 @@ namespace alpaka
                             m_dev(dev),
                             m_mutex(),
                             m_enqueueCount(0u),
-                            m_LastReadyEnqueueCount(0u)
+                            m_LastReadyEnqueueCount(0u),
+                            m_timePoint(),
+                            m_vContinuations()
                     {}
                     //-----------------------------------------------------------------------------
                     EventGenericThreadsImpl(EventGenericThreadsImpl<TDev> const &) = delete;
@@ -66,6 +76,33 @@ namespace alpaka
                         return (m_LastReadyEnqueueCount == m_enqueueCount);
                     }
 
+                    //-----------------------------------------------------------------------------
+                    //! Sets the event ready for all enqueues up to the current one.
+                    //!
+                    //! The mutex has to be locked by the caller.
+                    //! \return The continuations of the waiters released by this. They have to be called after unlocking the mutex.
+                    auto setReady(std::chrono::steady_clock::time_point const & timePoint) -> std::vector<std::function<void()>>
+                    {
+                        m_LastReadyEnqueueCount = m_enqueueCount;
+                        m_timePoint = timePoint;
+
+                        std::vector<std::function<void()>> vReadyContinuations;
+                        auto itContinuation(m_vContinuations.begin());
+                        while(itContinuation != m_vContinuations.end())
+                        {
+                            if(itContinuation->first <= m_LastReadyEnqueueCount)
+                            {
+                                vReadyContinuations.emplace_back(std::move(itContinuation->second));
+                                itContinuation = m_vContinuations.erase(itContinuation);
+                            }
+                            else
+                            {
+                                ++itContinuation;
+                            }
+                        }
+                        return vReadyContinuations;
+                    }
+
                     //-----------------------------------------------------------------------------
                     auto wait(std::size_t const & enqueueCount, std::unique_lock<std::mutex>& lk) const noexcept -> void
                     {
@@ -89,6 +126,8 @@ namespace alpaka
                     std::size_t m_LastReadyEnqueueCount;                    //!< The time this event has been ready the last time.
                                                                             //!< Ready means that the event was not waiting within a queue (not enqueued or already completed).
                                                                             //!< If m_enqueueCount == m_LastReadyEnqueueCount, the event is currently not enqueued
+                    std::chrono::steady_clock::time_point m_timePoint;      //!< The time the event has been completed the last time.
+                    std::vector<std::pair<std::size_t, std::function<void()>>> m_vContinuations; //!< The continuations to call as soon as the event is ready for the given enqueue count.
                 };
             }
         }
@@ -104,12 +143,15 @@ namespace alpaka
         public:
             //-----------------------------------------------------------------------------
             //! \param bBusyWaiting Unused. EventGenericThreads never does busy waiting.
+            //! \param bTiming Unused. EventGenericThreads always records the time of its completion.
             EventGenericThreads(
                 TDev const & dev,
-                bool bBusyWaiting = true) :
+                bool bBusyWaiting = true,
+                bool bTiming = false) :
                     m_spEventImpl(std::make_shared<generic::detail::EventGenericThreadsImpl<TDev>>(dev))
             { 
                 alpaka::ignore_unused(bBusyWaiting);
+                alpaka::ignore_unused(bTiming);
             }
             //-----------------------------------------------------------------------------
             EventGenericThreads(EventGenericThreads<TDev> const &) = default;
@@ -172,6 +214,42 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CPU device event elapsed time trait specialization.
+        template<typename TDev>
+        struct GetElapsedTime<
+            EventGenericThreads<TDev>>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The time in milliseconds between the completion time points recorded by the queue workers.
+            ALPAKA_FN_HOST static auto getElapsedTime(
+                EventGenericThreads<TDev> const & evStart,
+                EventGenericThreads<TDev> const & evEnd)
+            -> double
+            {
+                auto const startTimePoint(getCompletionTimePoint(*evStart.m_spEventImpl));
+                auto const endTimePoint(getCompletionTimePoint(*evEnd.m_spEventImpl));
+
+                return std::chrono::duration<double, std::milli>(endTimePoint - startTimePoint).count();
+            }
+
+        private:
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getCompletionTimePoint(
+                alpaka::generic::detail::EventGenericThreadsImpl<TDev> & eventImpl)
+            -> std::chrono::steady_clock::time_point
+            {
+                std::lock_guard<std::mutex> lk(eventImpl.m_mutex);
+
+                if((eventImpl.m_enqueueCount == 0u) || !eventImpl.isReady())
+                {
+                    throw std::runtime_error("The elapsed time can only be queried for events that have been enqueued and completed!");
+                }
+
+                return eventImpl.m_timePoint;
+            }
+        };
+
         //#############################################################################
         //! The CPU non-blocking device queue enqueue trait specialization.
         template<
@@ -203,17 +281,34 @@ namespace alpaka
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
                 auto const enqueueCount = spEventImpl->m_enqueueCount;
+                auto const pQueueImpl = &queueImpl;
 
                 // Enqueue a task that only resets the events flag if it is completed.
                 spEventImpl->m_future = queueImpl.m_workerThread.enqueueTask(
-                    [spEventImpl, enqueueCount]()
+                    [spEventImpl, enqueueCount, pQueueImpl]()
                     {
-                        std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
+                        ALPAKA_TRACE_QUEUE_SCOPE(pQueueImpl);
+                        ALPAKA_TRACE_SCOPE(
+                            "event",
+                            [&](){return std::make_pair(std::string("event"), trace::detail::Args().add("enqueueCount", enqueueCount).str());});
 
-                        // Nothing to do if it has been re-enqueued to a later position in the queue.
-                        if(enqueueCount == spEventImpl->m_enqueueCount)
+                        auto const timePoint(std::chrono::steady_clock::now());
+
+                        std::vector<std::function<void()>> vReadyContinuations;
                         {
-                            spEventImpl->m_LastReadyEnqueueCount = spEventImpl->m_enqueueCount;
+                            std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
+
+                            // Nothing to do if it has been re-enqueued to a later position in the queue.
+                            if(enqueueCount == spEventImpl->m_enqueueCount)
+                            {
+                                vReadyContinuations = spEventImpl->setReady(timePoint);
+                            }
+                        }
+
+                        // Release the queues waiting for this event.
+                        for(auto && continuation : vReadyContinuations)
+                        {
+                            continuation();
                         }
                     });
 #endif
@@ -255,6 +350,7 @@ namespace alpaka
                 ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
                 std::promise<void> promise;
+                std::vector<std::function<void()>> vReadyContinuations;
                 {
                     std::lock_guard<std::mutex> lk(queueImpl.m_mutex);
 
@@ -268,7 +364,7 @@ namespace alpaka
 
                         ++eventImpl.m_enqueueCount;
                         // NOTE: Difference to non-blocking version: directly set the event state instead of enqueuing.
-                        eventImpl.m_LastReadyEnqueueCount = eventImpl.m_enqueueCount;
+                        vReadyContinuations = eventImpl.setReady(std::chrono::steady_clock::now());
 
                         eventImpl.m_future = promise.get_future();
                     }
@@ -276,6 +372,12 @@ namespace alpaka
                     queueImpl.m_bCurrentlyExecutingTask = false;
                 }
                 promise.set_value();
+
+                // Release the queues waiting for this event.
+                for(auto && continuation : vReadyContinuations)
+                {
+                    continuation();
+                }
             }
         };
         //#############################################################################
@@ -394,14 +496,52 @@ namespace alpaka
                 {
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
-                    auto const enqueueCount = spEventImpl->m_enqueueCount;
+#ifdef ALPAKA_TRACE_ENABLED
+                    // The wait is not a task any more. It is recorded from the worker reaching the dependency until the following tasks are released.
+                    bool const bTraceWait(trace::isEnabled());
+                    auto const spWaitBeginNs(std::make_shared<std::uint64_t>(0u));
+                    if(bTraceWait)
+                    {
+                        queueImpl.m_workerThread.enqueueTask(
+                            [spWaitBeginNs]()
+                            {
+                                *spWaitBeginNs = trace::detail::Tracer::get().now();
+                            });
+                    }
+#endif
+
+                    // Instead of enqueuing a task that blocks the worker thread until the event is ready,
+                    // the tasks enqueued after this point are held back by a dependency which is resolved by the event itself.
+                    auto spDependency(queueImpl.m_workerThread.enqueueDependency());
 
-                    // Enqueue a task that waits for the given event.
-                    queueImpl.m_workerThread.enqueueTask(
-                        [spEventImpl, enqueueCount]()
+#ifdef ALPAKA_TRACE_ENABLED
+                    if(bTraceWait)
+                    {
+                        auto const enqueueCount = spEventImpl->m_enqueueCount;
+                        auto const pQueueImpl = &queueImpl;
+                        queueImpl.m_workerThread.enqueueTask(
+                            [spWaitBeginNs, enqueueCount, pQueueImpl]()
+                            {
+                                ALPAKA_TRACE_QUEUE_SCOPE(pQueueImpl);
+                                trace::detail::recordSpan(
+                                    "event",
+                                    [&](){return std::make_pair(std::string("wait"), trace::detail::Args().add("enqueueCount", enqueueCount).str());},
+                                    *spWaitBeginNs);
+                            });
+                    }
+#endif
+
+                    // The queue may be destroyed before the event is ready.
+                    std::weak_ptr<alpaka::generic::detail::QueueGenericThreadsNonBlockingImpl<TDev>> wpQueueImpl(queueImpl.shared_from_this());
+
+                    spEventImpl->m_vContinuations.emplace_back(
+                        spEventImpl->m_enqueueCount,
+                        [wpQueueImpl, spDependency]()
                         {
-                            std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
-                            spEventImpl->wait(enqueueCount, lk2);
+                            if(auto spQueueImpl = wpQueueImpl.lock())
+                            {
+                                spQueueImpl->m_workerThread.resolveDependency(spDependency);
+                            }
                         });
 #endif
                 }
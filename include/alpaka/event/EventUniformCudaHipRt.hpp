@@ -54,7 +54,8 @@ namespace alpaka
                 //-----------------------------------------------------------------------------
                 ALPAKA_FN_HOST EventUniformCudaHipImpl(
                     DevUniformCudaHipRt const & dev,
-                    bool bBusyWait) :
+                    bool bBusyWait,
+                    bool bTiming) :
                         m_dev(dev),
                         m_UniformCudaHipEvent()
                 {
@@ -74,7 +75,7 @@ namespace alpaka
                     ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
                         ALPAKA_API_PREFIX(EventCreateWithFlags)(
                             &m_UniformCudaHipEvent,
-                            (bBusyWait ? ALPAKA_API_PREFIX(EventDefault) : ALPAKA_API_PREFIX(EventBlockingSync)) | ALPAKA_API_PREFIX(EventDisableTiming)));
+                            (bBusyWait ? ALPAKA_API_PREFIX(EventDefault) : ALPAKA_API_PREFIX(EventBlockingSync)) | (bTiming ? 0u : ALPAKA_API_PREFIX(EventDisableTiming))));
                 }
                 //-----------------------------------------------------------------------------
                 EventUniformCudaHipImpl(EventUniformCudaHipImpl const &) = delete;
@@ -116,10 +117,12 @@ namespace alpaka
     {
     public:
         //-----------------------------------------------------------------------------
+        //! \param bTiming If the event records timing data. This is required for getElapsedTime but makes waiting for the event more expensive.
         ALPAKA_FN_HOST EventUniformCudaHipRt(
             DevUniformCudaHipRt const & dev,
-            bool bBusyWait = true) :
-                m_spEventImpl(std::make_shared<uniform_cuda_hip::detail::EventUniformCudaHipImpl>(dev, bBusyWait))
+            bool bBusyWait = true,
+            bool bTiming = false) :
+                m_spEventImpl(std::make_shared<uniform_cuda_hip::detail::EventUniformCudaHipImpl>(dev, bBusyWait, bTiming))
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
         }
@@ -189,6 +192,32 @@ namespace alpaka
             }
         };
 
+        //#############################################################################
+        //! The CUDA/HIP RT device event elapsed time trait specialization.
+        //!
+        //! Both events have to be created with bTiming enabled.
+        template<>
+        struct GetElapsedTime<
+            EventUniformCudaHipRt>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getElapsedTime(
+                EventUniformCudaHipRt const & evStart,
+                EventUniformCudaHipRt const & evEnd)
+            -> double
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                float elapsedTimeMs(0.0f);
+                ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                    ALPAKA_API_PREFIX(EventElapsedTime)(
+                        &elapsedTimeMs,
+                        evStart.m_spEventImpl->m_UniformCudaHipEvent,
+                        evEnd.m_spEventImpl->m_UniformCudaHipEvent));
+                return static_cast<double>(elapsedTimeMs);
+            }
+        };
+
         //#############################################################################
         //! The CUDA/HIP RT queue enqueue trait specialization.
         template<>
@@ -32,6 +32,13 @@ namespace alpaka
             typename TEvent,
             typename TSfinae = void>
         struct IsComplete;
+
+        //#############################################################################
+        //! The event elapsed time trait.
+        template<
+            typename TEvent,
+            typename TSfinae = void>
+        struct GetElapsedTime;
     }
 
     //#############################################################################
@@ -54,4 +61,24 @@ namespace alpaka
             ::isComplete(
                 event);
     }
+
+    //-----------------------------------------------------------------------------
+    //! \return The time in milliseconds elapsed between the completion of the two given events.
+    //!
+    //! Both events have to be completed. The result is negative if evEnd completed before evStart.
+    //! This does not wait for the events and therefore does not serialize the queues they are enqueued into.
+    template<
+        typename TEvent>
+    ALPAKA_FN_HOST auto getElapsedTime(
+        TEvent const & evStart,
+        TEvent const & evEnd)
+    -> double
+    {
+        return
+            traits::GetElapsedTime<
+                TEvent>
+            ::getElapsedTime(
+                evStart,
+                evEnd);
+    }
 }
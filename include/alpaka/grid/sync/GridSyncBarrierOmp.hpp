@@ -0,0 +1,79 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef _OPENMP
+
+#include <alpaka/grid/sync/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+
+#include <stdexcept>
+
+namespace alpaka
+{
+    namespace grid
+    {
+        //#############################################################################
+        //! The OpenMP barrier grid synchronization.
+        //!
+        //! Cooperative launches execute each block by its own thread of an OpenMP team so the team barrier synchronizes the grid.
+        //! Other launches share the threads between the blocks, so calls outside of cooperative launches throw std::logic_error.
+        //! As this happens within a parallel region the program is terminated.
+        class GridSyncBarrierOmp : public concepts::Implements<ConceptGridSync, GridSyncBarrierOmp>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! \param bCooperative If the kernel is executed by a cooperative launch. Only the cooperative execution task sets it.
+            ALPAKA_FN_HOST GridSyncBarrierOmp(
+                bool const & bCooperative) :
+                    m_bCooperative(bCooperative)
+            {}
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GridSyncBarrierOmp(GridSyncBarrierOmp const &) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GridSyncBarrierOmp(GridSyncBarrierOmp &&) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GridSyncBarrierOmp const &) -> GridSyncBarrierOmp & = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GridSyncBarrierOmp &&) -> GridSyncBarrierOmp & = delete;
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~GridSyncBarrierOmp() = default;
+
+            bool const & m_bCooperative;
+        };
+
+        namespace traits
+        {
+            //#############################################################################
+            template<>
+            struct SyncGridThreads<
+                GridSyncBarrierOmp>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto syncGridThreads(
+                    grid::GridSyncBarrierOmp const & gridSync)
+                -> void
+                {
+                    if(!gridSync.m_bCooperative)
+                    {
+                        throw std::logic_error("grid::syncGridThreads is only allowed within kernels executed by a cooperative launch!");
+                    }
+
+                    // The barrier binds to the team of the cooperative launch which contains exactly one thread per block.
+                    // It implies a flush so all memory operations of the grid are visible afterwards.
+                    #pragma omp barrier
+                }
+            };
+        }
+    }
+}
+
+#endif
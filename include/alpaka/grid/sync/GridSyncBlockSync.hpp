@@ -0,0 +1,82 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/grid/sync/Traits.hpp>
+
+#include <alpaka/block/sync/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <stdexcept>
+
+namespace alpaka
+{
+    namespace grid
+    {
+        //#############################################################################
+        //! The grid synchronization of accelerators whose cooperative launches consist of a single block.
+        //!
+        //! These accelerators execute the blocks of a grid one after another, so only a single block can be resident.
+        //! Within such a grid the block synchronization synchronizes all threads of the grid.
+        //! Calls outside of cooperative launches throw std::logic_error.
+        //!
+        //! \tparam TBlockSync The block synchronization implementation of the accelerator.
+        template<
+            typename TBlockSync>
+        class GridSyncBlockSync : public concepts::Implements<ConceptGridSync, GridSyncBlockSync<TBlockSync>>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! \param bCooperative If the kernel is executed by a cooperative launch. Only the cooperative execution task sets it.
+            ALPAKA_FN_HOST GridSyncBlockSync(
+                TBlockSync const & blockSync,
+                bool const & bCooperative) :
+                    m_blockSync(blockSync),
+                    m_bCooperative(bCooperative)
+            {}
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GridSyncBlockSync(GridSyncBlockSync const &) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST GridSyncBlockSync(GridSyncBlockSync &&) = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GridSyncBlockSync const &) -> GridSyncBlockSync & = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto operator=(GridSyncBlockSync &&) -> GridSyncBlockSync & = delete;
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~GridSyncBlockSync() = default;
+
+            TBlockSync const & m_blockSync;
+            bool const & m_bCooperative;
+        };
+
+        namespace traits
+        {
+            //#############################################################################
+            template<
+                typename TBlockSync>
+            struct SyncGridThreads<
+                GridSyncBlockSync<TBlockSync>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto syncGridThreads(
+                    grid::GridSyncBlockSync<TBlockSync> const & gridSync)
+                -> void
+                {
+                    if(!gridSync.m_bCooperative)
+                    {
+                        throw std::logic_error("grid::syncGridThreads is only allowed within kernels executed by a cooperative launch!");
+                    }
+
+                    block::syncBlockThreads(gridSync.m_blockSync);
+                }
+            };
+        }
+    }
+}
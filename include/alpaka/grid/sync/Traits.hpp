@@ -0,0 +1,59 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Concepts.hpp>
+
+#include <type_traits>
+
+namespace alpaka
+{
+    //-----------------------------------------------------------------------------
+    //! The grid specifics
+    namespace grid
+    {
+        struct ConceptGridSync{};
+
+        //-----------------------------------------------------------------------------
+        //! The grid synchronization traits.
+        namespace traits
+        {
+            //#############################################################################
+            //! The grid synchronization operation trait.
+            template<
+                typename TGridSync,
+                typename TSfinae = void>
+            struct SyncGridThreads;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Synchronizes all threads of all blocks of the grid.
+        //!
+        //! This is only allowed within kernels executed by a cooperative launch (see execCooperative) because all blocks have to be resident at the same time.
+        //! It has to be called by all threads of the grid.
+        //!
+        //! \tparam TGridSync The grid synchronization implementation type.
+        //! \param gridSync The grid synchronization implementation.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TGridSync>
+        ALPAKA_FN_ACC auto syncGridThreads(
+            TGridSync const & gridSync)
+        -> void
+        {
+            using ImplementationBase = concepts::ImplementationBase<ConceptGridSync, TGridSync>;
+            traits::SyncGridThreads<
+                ImplementationBase>
+            ::syncGridThreads(
+                gridSync);
+        }
+    }
+}
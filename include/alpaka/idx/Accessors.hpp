@@ -159,6 +159,24 @@ namespace alpaka
         };
     }
     //-----------------------------------------------------------------------------
+    //! \return The index of the problem instance executed by the current thread within a batched kernel execution (see execBatched).
+    //!
+    //! Outside of batched kernel executions the batch index is zero.
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TIdxBatch>
+    ALPAKA_FN_HOST_ACC auto getBatchIdx(
+        TIdxBatch const & idxBatch)
+    -> Idx<TIdxBatch>
+    {
+        using ImplementationBase = concepts::ImplementationBase<ConceptIdxBatch, TIdxBatch>;
+        return
+            traits::GetBatchIdx<
+                ImplementationBase>
+            ::getBatchIdx(
+                idxBatch);
+    }
+    //-----------------------------------------------------------------------------
     //! Get the index of the first element this thread computes.
     ALPAKA_NO_HOST_ACC_WARNING
     template<
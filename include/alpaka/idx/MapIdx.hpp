@@ -14,6 +14,7 @@
 #include <alpaka/core/Unused.hpp>
 
 #include <type_traits>
+#include <utility>
 
 namespace alpaka
 {
@@ -156,6 +157,39 @@ namespace alpaka
                 extent);
     }
 
+    //#############################################################################
+    //! Maps a N dimensional index to a N dimensional position within an extent known at compile time.
+    //!
+    //! The divisions and multiplications by the extent are done with constants, e.g. for the static block thread extent of WorkDivStatic.
+    //!
+    //! \tparam TidxDimOut Dimension of the index vector to map to.
+    //! \tparam TidxDimIn Dimension of the index vector to map from.
+    //! \tparam TElem Type of the elements of the index vector to map from.
+    //! \tparam Textent The extent in each dimension.
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        std::size_t TidxDimOut,
+        std::size_t TidxDimIn,
+        typename TElem,
+        TElem... Textent>
+    ALPAKA_FN_HOST_ACC auto mapIdx(
+        Vec<DimInt<TidxDimIn>, TElem> const & idx,
+        std::integer_sequence<TElem, Textent...> const & extent)
+    -> Vec<DimInt<TidxDimOut>, TElem>
+    {
+        static_assert(
+            sizeof...(Textent) == ((TidxDimOut < TidxDimIn) ? TidxDimIn : TidxDimOut),
+            "The dimension of the extent has to be the greater dimension of the index vectors!");
+
+        alpaka::ignore_unused(extent);
+
+        return
+            mapIdx<
+                TidxDimOut>(
+                idx,
+                Vec<DimInt<sizeof...(Textent)>, TElem>(Textent...));
+    }
+
     namespace detail
     {
         //#############################################################################
@@ -16,6 +16,7 @@ namespace alpaka
 {
     struct ConceptIdxBt{};
     struct ConceptIdxGb{};
+    struct ConceptIdxBatch{};
 
     //-----------------------------------------------------------------------------
     //! The idx traits.
@@ -54,5 +55,12 @@ namespace alpaka
             typename TUnit,
             typename TSfinae = void>
         struct GetIdx;
+
+        //#############################################################################
+        //! The batch index get trait.
+        template<
+            typename TIdxBatch,
+            typename TSfinae = void>
+        struct GetBatchIdx;
     }
 }
@@ -0,0 +1,78 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/idx/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Concepts.hpp>
+
+namespace alpaka
+{
+    namespace batch
+    {
+        //#############################################################################
+        //! A IdxBatchRef batch index.
+        template<
+            typename TIdx>
+        class IdxBatchRef : public concepts::Implements<ConceptIdxBatch, IdxBatchRef<TIdx>>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            IdxBatchRef(
+                TIdx const & batchIdx) :
+                    m_batchIdx(batchIdx)
+            {}
+            //-----------------------------------------------------------------------------
+            IdxBatchRef(IdxBatchRef const &) = delete;
+            //-----------------------------------------------------------------------------
+            IdxBatchRef(IdxBatchRef &&) = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(IdxBatchRef const &) -> IdxBatchRef & = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(IdxBatchRef &&) -> IdxBatchRef & = delete;
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~IdxBatchRef() = default;
+
+        public:
+            TIdx const & m_batchIdx;
+        };
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The IdxBatchRef batch index get trait specialization.
+        template<
+            typename TIdx>
+        struct GetBatchIdx<
+            batch::IdxBatchRef<TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The index of the problem instance currently executed.
+            ALPAKA_FN_HOST static auto getBatchIdx(
+                batch::IdxBatchRef<TIdx> const & idx)
+            -> TIdx
+            {
+                return idx.m_batchIdx;
+            }
+        };
+
+        //#############################################################################
+        //! The IdxBatchRef batch index idx type trait specialization.
+        template<
+            typename TIdx>
+        struct IdxType<
+            batch::IdxBatchRef<TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+}
@@ -0,0 +1,107 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/core/Positioning.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+namespace alpaka
+{
+    namespace bt
+    {
+        //#############################################################################
+        //! A block thread index stored as the linearized index of the thread in the block.
+        //!
+        //! The multi-dimensional index is only computed when it is queried.
+        //! Storing a single scalar keeps the creation cheap when one object is created for each thread.
+        template<
+            typename TDim,
+            typename TIdx>
+        class IdxBtLinear : public concepts::Implements<ConceptIdxBt, IdxBtLinear<TDim, TIdx>>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            IdxBtLinear(
+                TIdx const & blockThreadIdx1d) :
+                    m_blockThreadIdx1d(blockThreadIdx1d)
+            {}
+            //-----------------------------------------------------------------------------
+            IdxBtLinear(IdxBtLinear const &) = delete;
+            //-----------------------------------------------------------------------------
+            IdxBtLinear(IdxBtLinear &&) = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(IdxBtLinear const &) -> IdxBtLinear & = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(IdxBtLinear &&) -> IdxBtLinear & = delete;
+            //-----------------------------------------------------------------------------
+            /*virtual*/ ~IdxBtLinear() = default;
+
+        public:
+            TIdx const m_blockThreadIdx1d;
+        };
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The IdxBtLinear block thread index dimension get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DimType<
+            bt::IdxBtLinear<TDim, TIdx>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The IdxBtLinear block thread index get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetIdx<
+            bt::IdxBtLinear<TDim, TIdx>,
+            origin::Block,
+            unit::Threads>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The index of the current thread in the block.
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST static auto getIdx(
+                bt::IdxBtLinear<TDim, TIdx> const & idx,
+                TWorkDiv const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                return
+                    mapIdx<TDim::value>(
+                        Vec<DimInt<1u>, TIdx>(idx.m_blockThreadIdx1d),
+                        getWorkDiv<Block, Threads>(workDiv));
+            }
+        };
+
+        //#############################################################################
+        //! The IdxBtLinear block thread index idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct IdxType<
+            bt::IdxBtLinear<TDim, TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+}
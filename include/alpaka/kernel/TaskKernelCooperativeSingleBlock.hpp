@@ -0,0 +1,83 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/workdiv/Traits.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace alpaka
+{
+    namespace detail
+    {
+        //#############################################################################
+        //! The cooperative execution task creation of accelerators which keep only a single block resident.
+        //!
+        //! Their cooperative grids consist of a single block and the grid synchronization maps to the block synchronization.
+        //! The accelerators specialize traits::CreateTaskKernelCooperative by deriving from it.
+        //!
+        //! \tparam TTask The execution task type. It has to be constructible from the TaskKernelCooperative tag.
+        template<
+            typename TTask,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperativeSingleBlock
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto createTaskKernelCooperative(
+                TWorkDiv const & workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args)
+            -> TTask
+            {
+                if(getWorkDiv<Grid, Blocks>(workDiv).prod() > static_cast<Idx<TTask>>(1u))
+                {
+                    throw std::runtime_error("The cooperative launch of the " + getAccName<Acc<TTask>>() + " accelerator is limited to a single block!");
+                }
+
+                return
+                    TTask(
+                        TaskKernelCooperative(),
+                        workDiv,
+                        kernelFnObj,
+                        std::forward<TArgs>(args)...);
+            }
+        };
+
+        //#############################################################################
+        //! The cooperative grid block count of accelerators which keep only a single block resident.
+        //!
+        //! The accelerators specialize traits::GetCooperativeGridBlockCountMax by deriving from it.
+        template<
+            typename TIdx>
+        struct GetCooperativeGridBlockCountMaxSingleBlock
+        {
+            //-----------------------------------------------------------------------------
+            template<
+                typename TDev>
+            ALPAKA_FN_HOST static auto getCooperativeGridBlockCountMax(
+                TDev const & dev)
+            -> TIdx
+            {
+                alpaka::ignore_unused(dev);
+
+                return static_cast<TIdx>(1u);
+            }
+        };
+    }
+}
@@ -0,0 +1,299 @@
+/* Copyright 2020 Benjamin Worpitz, René Widera
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#if defined(ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLED) || defined(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
+
+// Implementation details.
+#include <alpaka/acc/AccCpuFibersBase.hpp>
+#include <alpaka/core/Decay.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <alpaka/core/Fibers.hpp>
+#include <alpaka/meta/NdLoop.hpp>
+#include <alpaka/meta/ApplyTuple.hpp>
+
+#include <exception>
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>
+#endif
+
+namespace alpaka
+{
+    namespace detail
+    {
+        //#############################################################################
+        //! The implementation shared by the execution tasks of the CPU fibers accelerators.
+        //!
+        //! The tasks only differ in how the blocks are distributed over the operating system threads.
+        //! Each operating system thread executes its blocks one after another with a fiber for each thread of the block.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        class TaskKernelCpuFibersBase :
+            public WorkDivMembers<TDim, TIdx>
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST TaskKernelCpuFibersBase(
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args) :
+                    WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
+                    m_kernelFnObj(kernelFnObj),
+                    m_args(std::forward<TArgs>(args)...),
+                    m_batchCount(static_cast<TIdx>(1u)),
+                    m_bCooperative(false)
+            {
+                static_assert(
+                    Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
+                    "The work division and the execution task have to be of the same dimensionality!");
+            }
+            //-----------------------------------------------------------------------------
+            //! Creates a batched execution of the given number of problem instances.
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST TaskKernelCpuFibersBase(
+                TaskKernelBatch<TIdx> const & batch,
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args) :
+                    TaskKernelCpuFibersBase(
+                        std::forward<TWorkDiv>(workDiv),
+                        kernelFnObj,
+                        std::forward<TArgs>(args)...)
+            {
+                m_batchCount = batch.m_batchCount;
+            }
+            //-----------------------------------------------------------------------------
+            //! Creates a cooperative launch which allows the kernel to synchronize the grid.
+            template<
+                typename TWorkDiv>
+            ALPAKA_FN_HOST TaskKernelCpuFibersBase(
+                TaskKernelCooperative const &,
+                TWorkDiv && workDiv,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args) :
+                    TaskKernelCpuFibersBase(
+                        std::forward<TWorkDiv>(workDiv),
+                        kernelFnObj,
+                        std::forward<TArgs>(args)...)
+            {
+                m_bCooperative = true;
+            }
+
+        protected:
+            //-----------------------------------------------------------------------------
+            //! \return The number of blocks of all problem instances.
+            ALPAKA_FN_HOST auto getBatchGridBlockCount() const
+            -> TIdx
+            {
+                return getWorkDiv<Grid, Blocks>(getWorkDivMembers()).prod() * m_batchCount;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The size of the block shared dynamic memory.
+            template<
+                typename TAcc>
+            ALPAKA_FN_HOST auto getBlockSharedMemDynSizeBytes() const
+            -> std::size_t
+            {
+                auto const blockSharedMemDynSizeBytes(
+                    meta::apply(
+                        [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                        {
+                            return
+                                alpaka::getBlockSharedMemDynSizeBytes<
+                                    TAcc>(
+                                        m_kernelFnObj,
+                                        getWorkDiv<Block, Threads>(getWorkDivMembers()),
+                                        getWorkDiv<Thread, Elems>(getWorkDivMembers()),
+                                        args...);
+                        },
+                        m_args));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__
+                    << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
+#endif
+                return blockSharedMemDynSizeBytes;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Executes blocks on the calling operating system thread until there are no more blocks.
+            //!
+            //! \param blockSharedMemDynSizeBytes The size of the block shared dynamic memory.
+            //! \param takeBlock The function returning the linear index of the next block of all problem instances to execute.
+            //!        Indices beyond the number of blocks of all problem instances end the execution.
+            template<
+                typename TAcc,
+                typename TTakeBlock>
+            ALPAKA_FN_HOST auto execBlocks(
+                std::size_t const & blockSharedMemDynSizeBytes,
+                TTakeBlock && takeBlock) const
+            -> void
+            {
+                meta::apply(
+                    [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                    {
+                        execBlocksImpl<TAcc>(
+                            blockSharedMemDynSizeBytes,
+                            takeBlock,
+                            args...);
+                    },
+                    m_args);
+            }
+
+        private:
+            //-----------------------------------------------------------------------------
+            //! \return The work division of the task.
+            ALPAKA_FN_HOST auto getWorkDivMembers() const
+            -> WorkDivMembers<TDim, TIdx> const &
+            {
+                return *this;
+            }
+            //-----------------------------------------------------------------------------
+            template<
+                typename TAcc,
+                typename TTakeBlock>
+            ALPAKA_FN_HOST auto execBlocksImpl(
+                std::size_t const & blockSharedMemDynSizeBytes,
+                TTakeBlock && takeBlock,
+                std::decay_t<TArgs> const & ... args) const
+            -> void
+            {
+                // The stacks of the fibers are reused by all blocks and kernels executed on this operating system thread.
+                thread_local boost::fibers::pooled_fixedsize_stack stackAlloc;
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__
+                    << " Fiber stack idx: " << boost::fibers::fixedsize_stack::traits_type::default_size() << " B" << std::endl;
+#endif
+
+                auto const & workDiv(getWorkDivMembers());
+                auto const gridBlockExtent(getWorkDiv<Grid, Blocks>(workDiv));
+                auto const blockThreadExtent(getWorkDiv<Block, Threads>(workDiv));
+                TIdx const gridBlockCount(gridBlockExtent.prod());
+                TIdx const batchGridBlockCount(getBatchGridBlockCount());
+
+                TAcc acc(
+                    workDiv,
+                    blockSharedMemDynSizeBytes);
+                acc.m_bCooperative = m_bCooperative;
+
+                std::vector<boost::fibers::fiber> fibersInBlock;
+                fibersInBlock.reserve(static_cast<std::size_t>(blockThreadExtent.prod()));
+                std::exception_ptr exception;
+
+                for(TIdx i(takeBlock()); i < batchGridBlockCount; i = takeBlock())
+                {
+                    acc.m_batchIdx = i / gridBlockCount;
+                    acc.m_gridBlockIdx = mapIdx<TDim::value>(Vec<DimInt<1u>, TIdx>(i % gridBlockCount), gridBlockExtent);
+
+                    // Start a fiber for each thread of the block.
+                    meta::ndLoopIncIdx(
+                        blockThreadExtent,
+                        [&](Vec<TDim, TIdx> const & blockThreadIdx)
+                        {
+                            fibersInBlock.emplace_back(
+                                std::allocator_arg,
+                                stackAlloc,
+                                [&, blockThreadIdx]()
+                                {
+                                    // Exceptions must not leave a fiber.
+                                    try
+                                    {
+                                        blockThreadFiberFn(
+                                            acc,
+                                            blockThreadIdx,
+                                            args...);
+                                    }
+                                    catch(...)
+                                    {
+                                        if(!exception)
+                                        {
+                                            exception = std::current_exception();
+                                        }
+                                    }
+                                });
+                        });
+
+                    // Wait for the completion of the block threads.
+                    for(auto & fiber : fibersInBlock)
+                    {
+                        fiber.join();
+                    }
+                    fibersInBlock.clear();
+
+                    acc.m_fibersToIndices.clear();
+
+                    // After a block has been processed, the shared memory has to be deleted.
+                    block::st::freeMem(acc);
+
+                    if(exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+            }
+            //-----------------------------------------------------------------------------
+            //! The fiber entry point.
+            template<
+                typename TAcc>
+            ALPAKA_FN_HOST auto blockThreadFiberFn(
+                TAcc & acc,
+                Vec<TDim, TIdx> const & blockThreadIdx,
+                std::decay_t<TArgs> const & ... args) const
+            -> void
+            {
+                // We have to store the fiber data before the kernel is calling any of the methods of this class depending on them.
+                auto const fiberId(boost::this_fiber::get_id());
+
+                // Set the master thread id.
+                if(blockThreadIdx.sum() == 0)
+                {
+                    acc.m_masterFiberId = fiberId;
+                }
+
+                // Save the fiber id, and index.
+                acc.m_fibersToIndices.emplace(fiberId, blockThreadIdx);
+
+                // Sync all threads so that the maps with thread id's are complete and not changed after here.
+                syncBlockThreads(acc);
+
+                // Execute the kernel itself.
+                m_kernelFnObj(
+                    const_cast<TAcc const &>(acc),
+                    args...);
+
+                // We have to sync all fibers here because if a fiber would finish before all fibers have been started, the new fiber could get a recycled (then duplicate) fiber id!
+                syncBlockThreads(acc);
+            }
+
+            TKernelFnObj m_kernelFnObj;
+            std::tuple<std::decay_t<TArgs>...> m_args;
+            TIdx m_batchCount;
+            bool m_bCooperative;
+        };
+    }
+}
+
+#endif
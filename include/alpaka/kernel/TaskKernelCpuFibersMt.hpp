@@ -0,0 +1,156 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/acc/AccCpuFibersMt.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/kernel/TaskKernelCpuFibersBase.hpp>
+#include <alpaka/trace/Trace.hpp>
+
+#include <alpaka/core/WorkerPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+namespace alpaka
+{
+    //#############################################################################
+    //! The CPU multi-threaded fibers accelerator execution task.
+    //!
+    //! The blocks are handed out one by one to the workers of the shared worker pool.
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TKernelFnObj,
+        typename... TArgs>
+    class TaskKernelCpuFibersMt final :
+        public detail::TaskKernelCpuFibersBase<TDim, TIdx, TKernelFnObj, TArgs...>
+    {
+    public:
+        using detail::TaskKernelCpuFibersBase<TDim, TIdx, TKernelFnObj, TArgs...>::TaskKernelCpuFibersBase;
+
+        //-----------------------------------------------------------------------------
+        //! Executes the kernel function object.
+        ALPAKA_FN_HOST auto operator()() const
+        -> void
+        {
+            ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuFibersMt<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
+
+            auto const blockSharedMemDynSizeBytes(
+                this->template getBlockSharedMemDynSizeBytes<AccCpuFibersMt<TDim, TIdx>>());
+
+            TIdx const batchGridBlockCount(this->getBatchGridBlockCount());
+            if(batchGridBlockCount == static_cast<TIdx>(0u))
+            {
+                return;
+            }
+
+            // The blocks are handed out one by one so that workers finishing early take over the remaining blocks.
+            std::atomic<TIdx> nextBlock(static_cast<TIdx>(0u));
+
+            auto & workerPool(core::detail::WorkerPool::getInstance());
+            workerPool.run(
+                std::min(workerPool.getWorkerCount(), static_cast<std::size_t>(batchGridBlockCount)),
+                [&](std::size_t const)
+                {
+                    this->template execBlocks<AccCpuFibersMt<TDim, TIdx>>(
+                        blockSharedMemDynSizeBytes,
+                        [&nextBlock]()
+                        {
+                            return nextBlock.fetch_add(static_cast<TIdx>(1u));
+                        });
+                });
+        }
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task accelerator type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct AccType<
+            TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = AccCpuFibersMt<TDim, TIdx>;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task device type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct DevType<
+            TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = DevCpu;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task dimension getter trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct DimType<
+            TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task platform type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct PltfType<
+            TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = PltfCpu;
+        };
+
+        //#############################################################################
+        //! The CPU multi-threaded fibers execution task idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct IdxType<
+            TaskKernelCpuFibersMt<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = TIdx;
+        };
+    }
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/idx/MapIdx.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <alpaka/meta/ApplyTuple.hpp>
@@ -64,7 +65,9 @@ namespace alpaka
             TArgs && ... args) :
                 WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
                 m_kernelFnObj(kernelFnObj),
-                m_args(std::forward<TArgs>(args)...)
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u)),
+                m_bCooperative(false)
         {
 
             static_assert(
@@ -72,6 +75,38 @@ namespace alpaka
                 "The work division and the execution task have to be of the same dimensionality!");
         }
         //-----------------------------------------------------------------------------
+        //! Creates a cooperative launch which executes each block by its own thread of an OpenMP team.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Blocks(
+            detail::TaskKernelCooperative const &,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuOmp2Blocks(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_bCooperative = true;
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Blocks(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuOmp2Blocks(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
         TaskKernelCpuOmp2Blocks(TaskKernelCpuOmp2Blocks const &) = default;
         //-----------------------------------------------------------------------------
         TaskKernelCpuOmp2Blocks(TaskKernelCpuOmp2Blocks &&) = default;
@@ -88,6 +123,9 @@ namespace alpaka
         -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuOmp2Blocks<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
 
             auto const gridBlockExtent(
                 getWorkDiv<Grid, Blocks>(*this));
@@ -136,7 +174,15 @@ namespace alpaka
                 throw std::runtime_error("Only one thread per block allowed in the OpenMP 2.0 block accelerator!");
             }
 
-            if(::omp_in_parallel() != 0)
+            if(m_bCooperative)
+            {
+                cooperativeFn(
+                    boundKernelFnObj,
+                    blockSharedMemDynSizeBytes,
+                    numBlocksInGrid,
+                    gridBlockExtent);
+            }
+            else if(::omp_in_parallel() != 0)
             {
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                 std::cout << __func__ << " already within a parallel region." << std::endl;
@@ -177,7 +223,7 @@ namespace alpaka
                 // * only one thread is required in the num_threads clause
                 // * or only one thread is available
                 // In all other cases we expect to be in a parallel region now.
-                if((numBlocksInGrid > 1) && (::omp_get_max_threads() > 1) && (::omp_in_parallel() == 0))
+                if((numBlocksInGrid * m_batchCount > 1) && (::omp_get_max_threads() > 1) && (::omp_in_parallel() == 0))
                 {
                     throw std::runtime_error("The OpenMP 2.0 runtime did not create a parallel region!");
                 }
@@ -191,23 +237,27 @@ namespace alpaka
                 *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
                 blockSharedMemDynSizeBytes);
 
+            // The blocks of all problem instances are distributed by a single loop.
+            TIdx const numBlocksInBatch(numBlocksInGrid * m_batchCount);
+
             // NOTE: schedule(static) does not improve performance.
 #if _OPENMP < 200805    // For OpenMP < 3.0 you have to declare the loop index (a signed integer) outside of the loop header.
-            std::intmax_t iNumBlocksInGrid(static_cast<std::intmax_t>(numBlocksInGrid));
+            std::intmax_t iNumBlocksInBatch(static_cast<std::intmax_t>(numBlocksInBatch));
             std::intmax_t i;
             #pragma omp for nowait schedule(guided)
-            for(i = 0; i < iNumBlocksInGrid; ++i)
+            for(i = 0; i < iNumBlocksInBatch; ++i)
 #else
             #pragma omp for nowait schedule(guided)
-            for(TIdx i = 0; i < numBlocksInGrid; ++i)
+            for(TIdx i = 0; i < numBlocksInBatch; ++i)
 #endif
             {
 #if _OPENMP < 200805
                 auto const i_tidx  = static_cast<TIdx>(i); // for issue #840
-                auto const index   = Vec<DimInt<1u>, TIdx>( i_tidx ); // for issue #840
 #else
-                auto const index   = Vec<DimInt<1u>, TIdx>( i ); // for issue #840
+                auto const i_tidx  = i;
 #endif
+                auto const index   = Vec<DimInt<1u>, TIdx>( i_tidx % numBlocksInGrid ); // for issue #840
+                acc.m_batchIdx = i_tidx / numBlocksInGrid;
                 acc.m_gridBlockIdx = mapIdx<TDim::value>(index,
                                                                 gridBlockExtent);
 
@@ -219,8 +269,61 @@ namespace alpaka
             }
         }
 
+        //-----------------------------------------------------------------------------
+        //! Executes all blocks of the grid at the same time so that the team barrier synchronizes the grid.
+        template<
+            typename FnObj>
+        ALPAKA_FN_HOST auto cooperativeFn(
+            FnObj const & boundKernelFnObj,
+            std::size_t const & blockSharedMemDynSizeBytes,
+            TIdx const & numBlocksInGrid,
+            Vec<TDim, TIdx> const & gridBlockExtent) const
+        -> void
+        {
+            if(numBlocksInGrid == static_cast<TIdx>(0u))
+            {
+                return;
+            }
+
+            int const numThreads(static_cast<int>(numBlocksInGrid));
+            bool bTeamIncomplete(false);
+
+            // Exceptions must not leave the parallel region, so an incomplete team is only recorded.
+            #pragma omp parallel num_threads(numThreads)
+            {
+                // All threads see the same team size, so either all or none of them execute the kernel and reach the grid barriers.
+                if(::omp_get_num_threads() != numThreads)
+                {
+                    #pragma omp master
+                    bTeamIncomplete = true;
+                }
+                else
+                {
+                    AccCpuOmp2Blocks<TDim, TIdx> acc(
+                        *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
+                        blockSharedMemDynSizeBytes);
+                    acc.m_bCooperative = true;
+
+                    auto const index = Vec<DimInt<1u>, TIdx>(static_cast<TIdx>(::omp_get_thread_num()));
+                    acc.m_gridBlockIdx = mapIdx<TDim::value>(index, gridBlockExtent);
+
+                    boundKernelFnObj(
+                        acc);
+
+                    block::st::freeMem(acc);
+                }
+            }
+
+            if(bTeamIncomplete)
+            {
+                throw std::runtime_error("The OpenMP 2.0 runtime did not create a team with one thread per block for the cooperative launch!");
+            }
+        }
+
         TKernelFnObj m_kernelFnObj;
         std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+        bool m_bCooperative;
     };
 
     namespace traits
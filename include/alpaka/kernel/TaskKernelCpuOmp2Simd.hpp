@@ -0,0 +1,332 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED
+
+#if _OPENMP < 200203
+    #error If ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED is set, the compiler has to support OpenMP 2.0 or higher!
+#endif
+
+// Specialized traits.
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/pltf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+// Implementation details.
+#include <alpaka/acc/AccCpuOmp2Simd.hpp>
+#include <alpaka/block/shared/dyn/BlockSharedMemDynArena.hpp>
+#include <alpaka/core/Decay.hpp>
+#include <alpaka/core/Vectorize.hpp>
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <alpaka/meta/ApplyTuple.hpp>
+
+#include <omp.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>
+#endif
+
+namespace alpaka
+{
+    //#############################################################################
+    //! The CPU OpenMP 2.0 SIMD block thread accelerator execution task.
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TKernelFnObj,
+        typename... TArgs>
+    class TaskKernelCpuOmp2Simd final :
+        public WorkDivMembers<TDim, TIdx>
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Simd(
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
+                m_kernelFnObj(kernelFnObj),
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u))
+        {
+
+            static_assert(
+                Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
+                "The work division and the execution task have to be of the same dimensionality!");
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Simd(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuOmp2Simd(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
+        TaskKernelCpuOmp2Simd(TaskKernelCpuOmp2Simd const &) = default;
+        //-----------------------------------------------------------------------------
+        TaskKernelCpuOmp2Simd(TaskKernelCpuOmp2Simd &&) = default;
+        //-----------------------------------------------------------------------------
+        auto operator=(TaskKernelCpuOmp2Simd const &) -> TaskKernelCpuOmp2Simd & = default;
+        //-----------------------------------------------------------------------------
+        auto operator=(TaskKernelCpuOmp2Simd &&) -> TaskKernelCpuOmp2Simd & = default;
+        //-----------------------------------------------------------------------------
+        ~TaskKernelCpuOmp2Simd() = default;
+
+        //-----------------------------------------------------------------------------
+        //! Executes the kernel function object.
+        ALPAKA_FN_HOST auto operator()() const
+        -> void
+        {
+            ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuOmp2Simd<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
+
+            auto const gridBlockExtent(
+                getWorkDiv<Grid, Blocks>(*this));
+            auto const blockThreadExtent(
+                getWorkDiv<Block, Threads>(*this));
+            auto const threadElemExtent(
+                getWorkDiv<Thread, Elems>(*this));
+
+            // Get the size of the block shared dynamic memory.
+            auto const blockSharedMemDynSizeBytes(
+                meta::apply(
+                    [&](ALPAKA_DECAY_T(TArgs) const & ... args)
+                    {
+                        return
+                            getBlockSharedMemDynSizeBytes<
+                                AccCpuOmp2Simd<TDim, TIdx>>(
+                                    m_kernelFnObj,
+                                    blockThreadExtent,
+                                    threadElemExtent,
+                                    args...);
+                    },
+                    m_args));
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+            std::cout << __func__
+                << " blockSharedMemDynSizeBytes: " << blockSharedMemDynSizeBytes << " B" << std::endl;
+#endif
+            // Bind all arguments except the accelerator.
+            // TODO: With C++14 we could create a perfectly argument forwarding function object within the constructor.
+            auto const boundKernelFnObj(
+                meta::apply(
+                    [this](ALPAKA_DECAY_T(TArgs) const & ... args)
+                    {
+                        return
+                            std::bind(
+                                std::ref(m_kernelFnObj),
+                                std::placeholders::_1,
+                                std::ref(args)...);
+                    },
+                    m_args));
+
+            // The number of blocks in the grid.
+            TIdx const numBlocksInGrid(gridBlockExtent.prod());
+
+            if(::omp_in_parallel() != 0)
+            {
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__ << " already within a parallel region." << std::endl;
+#endif
+                parallelFn(
+                    boundKernelFnObj,
+                    blockSharedMemDynSizeBytes,
+                    numBlocksInGrid,
+                    gridBlockExtent,
+                    blockThreadExtent);
+            }
+            else
+            {
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                std::cout << __func__ << " opening new parallel region." << std::endl;
+#endif
+                #pragma omp parallel
+                parallelFn(
+                    boundKernelFnObj,
+                    blockSharedMemDynSizeBytes,
+                    numBlocksInGrid,
+                    gridBlockExtent,
+                    blockThreadExtent);
+            }
+        }
+
+    private:
+        template<
+            typename FnObj>
+        ALPAKA_FN_HOST auto parallelFn(
+            FnObj const & boundKernelFnObj,
+            std::size_t const & blockSharedMemDynSizeBytes,
+            TIdx const & numBlocksInGrid,
+            Vec<TDim, TIdx> const & gridBlockExtent,
+            Vec<TDim, TIdx> const & blockThreadExtent) const
+        -> void
+        {
+            #pragma omp single nowait
+            {
+                // The OpenMP runtime does not create a parallel region when either:
+                // * only one thread is required in the num_threads clause
+                // * or only one thread is available
+                // In all other cases we expect to be in a parallel region now.
+                if((numBlocksInGrid * m_batchCount > 1) && (::omp_get_max_threads() > 1) && (::omp_in_parallel() == 0))
+                {
+                    throw std::runtime_error("The OpenMP runtime did not create a parallel region!");
+                }
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                std::cout << __func__ << " omp_get_num_threads: " << ::omp_get_num_threads() << std::endl;
+#endif
+            }
+
+            // All threads of the blocks executed by this OpenMP thread share the arena memory of the thread.
+            std::size_t const blockSharedMemDynPitch(
+                block::dyn::detail::BlockSharedMemArena::roundUp(blockSharedMemDynSizeBytes));
+            std::uint8_t * const blockSharedMem(
+                block::dyn::detail::BlockSharedMemArena::get(
+                    blockSharedMemDynPitch + block::dyn::BlockSharedMemDynArena<>::staticAllocBytes()));
+
+            auto const & workDiv(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));
+            TIdx const numThreadsInBlock(blockThreadExtent.prod());
+
+            // The blocks of all problem instances are distributed by a single loop.
+            TIdx const numBlocksInBatch(numBlocksInGrid * m_batchCount);
+
+            // NOTE: schedule(static) does not improve performance.
+            #pragma omp for nowait schedule(guided)
+            for(TIdx i = 0; i < numBlocksInBatch; ++i)
+            {
+                TIdx const batchIdx(i / numBlocksInGrid);
+                Vec<TDim, TIdx> const gridBlockIdx(
+                    mapIdx<TDim::value>(
+                        Vec<DimInt<1u>, TIdx>(i % numBlocksInGrid),
+                        gridBlockExtent));
+
+                // The threads of the block are the lanes of the loop.
+                // Each lane creates its own lightweight accelerator holding the index of its thread.
+                // The kernel does not synchronize the threads, so there are no dependencies between the iterations.
+                // NOTE: omp simd privatizes the accelerator into a per lane array which prevents the vectorization by GCC.
+                ALPAKA_VECTORIZE_HINT()
+                for(TIdx t = 0; t < numThreadsInBlock; ++t)
+                {
+                    AccCpuOmp2Simd<TDim, TIdx> const acc(
+                        workDiv,
+                        gridBlockIdx,
+                        batchIdx,
+                        t,
+                        blockSharedMem,
+                        blockSharedMemDynPitch);
+
+                    boundKernelFnObj(
+                        acc);
+                }
+            }
+        }
+
+        TKernelFnObj m_kernelFnObj;
+        std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task accelerator type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct AccType<
+            TaskKernelCpuOmp2Simd<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = AccCpuOmp2Simd<TDim, TIdx>;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task device type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct DevType<
+            TaskKernelCpuOmp2Simd<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = DevCpu;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task dimension getter trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct DimType<
+            TaskKernelCpuOmp2Simd<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task platform type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct PltfType<
+            TaskKernelCpuOmp2Simd<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = PltfCpu;
+        };
+
+        //#############################################################################
+        //! The CPU OpenMP 2.0 SIMD block thread execution task idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct IdxType<
+            TaskKernelCpuOmp2Simd<TDim, TIdx, TKernelFnObj, TArgs...>>
+        {
+            using type = TIdx;
+        };
+    }
+}
+
+#endif
@@ -28,12 +28,16 @@
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
+#include <alpaka/idx/MapIdx.hpp>
 #include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/ApplyTuple.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <omp.h>
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <stdexcept>
 #include <tuple>
@@ -64,13 +68,47 @@ namespace alpaka
             TArgs && ... args) :
                 WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
                 m_kernelFnObj(kernelFnObj),
-                m_args(std::forward<TArgs>(args)...)
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u)),
+                m_bCooperative(false)
         {
             static_assert(
                 Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
                 "The work division and the execution task have to be of the same dimensionality!");
         }
         //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Threads(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuOmp2Threads(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a cooperative launch which allows the kernel to synchronize the grid.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuOmp2Threads(
+            detail::TaskKernelCooperative const &,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuOmp2Threads(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_bCooperative = true;
+        }
+        //-----------------------------------------------------------------------------
         TaskKernelCpuOmp2Threads(TaskKernelCpuOmp2Threads const &) = default;
         //-----------------------------------------------------------------------------
         TaskKernelCpuOmp2Threads(TaskKernelCpuOmp2Threads &&) = default;
@@ -87,6 +125,9 @@ namespace alpaka
         -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuOmp2Threads<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
 
             auto const gridBlockExtent(
                 getWorkDiv<Grid, Blocks>(*this));
@@ -128,14 +169,8 @@ namespace alpaka
                     },
                     m_args));
 
-            AccCpuOmp2Threads<TDim, TIdx> acc(
-                *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
-                blockSharedMemDynSizeBytes);
-
             // The number of threads in this block.
             TIdx const blockThreadCount(blockThreadExtent.prod());
-            int const iBlockThreadCount(static_cast<int>(blockThreadCount));
-            alpaka::ignore_unused(iBlockThreadCount);
 
             if(::omp_in_parallel() != 0)
             {
@@ -146,58 +181,207 @@ namespace alpaka
             int const ompIsDynamic(::omp_get_dynamic());
             ::omp_set_dynamic(0);
 
-            // Execute the blocks serially.
-            meta::ndLoopIncIdx(
+#if defined(ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS_ENABLED) && (_OPENMP >= 200805)
+            runBlocksConcurrently(
                 gridBlockExtent,
-                [&](Vec<TDim, TIdx> const & gridBlockIdx)
-                {
-                    acc.m_gridBlockIdx = gridBlockIdx;
+                blockThreadCount,
+                blockSharedMemDynSizeBytes,
+                boundKernelFnObj);
+#else
+            runBlocksSerially(
+                gridBlockExtent,
+                blockThreadCount,
+                blockSharedMemDynSizeBytes,
+                boundKernelFnObj);
+#endif
+
+            // Reset the dynamic thread number setting.
+            ::omp_set_dynamic(ompIsDynamic);
+        }
+
+    private:
+        //-----------------------------------------------------------------------------
+        //! Executes the blocks of all problem instances one after another within a single parallel region.
+        //!
+        //! Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
+        //! So we have to spawn one OS thread per thread in a block.
+        //! 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
+        //! Therefore the team of the parallel region has as many threads as a block and all of them execute every block.
+        template<
+            typename TBoundKernelFnObj>
+        ALPAKA_FN_HOST auto runBlocksSerially(
+            Vec<TDim, TIdx> const & gridBlockExtent,
+            TIdx const & blockThreadCount,
+            std::size_t const & blockSharedMemDynSizeBytes,
+            TBoundKernelFnObj const & boundKernelFnObj) const
+        -> void
+        {
+            TIdx const gridBlockCount(gridBlockExtent.prod());
+            TIdx const batchGridBlockCount(gridBlockCount * m_batchCount);
+            if(batchGridBlockCount == static_cast<TIdx>(0u))
+            {
+                return;
+            }
+
+            int const iBlockThreadCount(static_cast<int>(blockThreadCount));
+
+            AccCpuOmp2Threads<TDim, TIdx> acc(
+                *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
+                blockSharedMemDynSizeBytes);
+            acc.m_bCooperative = m_bCooperative;
 
-                    // Execute the threads in parallel.
+            #pragma omp parallel num_threads(iBlockThreadCount)
+            {
+                // The guard is for gcc internal compiler error, as discussed in #735
+#if (!BOOST_COMP_GNUC) || (BOOST_COMP_GNUC >= BOOST_VERSION_NUMBER(8, 1, 0))
+                #pragma omp single nowait
+                {
+                    // The OpenMP runtime does not create a parallel region when only one thread is required in the num_threads clause.
+                    // In all other cases we expect to be in a parallel region now.
+                    if((iBlockThreadCount > 1) && (::omp_in_parallel() == 0))
+                    {
+                        throw std::runtime_error("The OpenMP 2.0 runtime did not create a parallel region!");
+                    }
 
-                    // Parallel execution of the threads in a block is required because when syncBlockThreads is called all of them have to be done with their work up to this line.
-                    // So we have to spawn one OS thread per thread in a block.
-                    // 'omp for' is not useful because it is meant for cases where multiple iterations are executed by one thread but in our case a 1:1 mapping is required.
-                    // Therefore we use 'omp parallel' with the specified number of threads in a block.
-                    #pragma omp parallel num_threads(iBlockThreadCount)
+                    int const numThreads(::omp_get_num_threads());
+                    if(numThreads != iBlockThreadCount)
+                    {
+                        throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
+                    }
+                }
+#endif
+                for(TIdx linearGridBlockIdx(0u); linearGridBlockIdx < batchGridBlockCount; ++linearGridBlockIdx)
+                {
+                    // One thread frees the shared memory of the previous block and sets the index of the next one.
+                    // The implicit barrier at the end of omp single publishes the new block index to the team.
+                    #pragma omp single
                     {
-                        // The guard is for gcc internal compiler error, as discussed in #735
+                        block::st::freeMem(acc);
+
+                        acc.m_batchIdx = linearGridBlockIdx / gridBlockCount;
+                        acc.m_gridBlockIdx = mapIdx<TDim::value>(
+                            Vec<DimInt<1u>, TIdx>(linearGridBlockIdx % gridBlockCount),
+                            gridBlockExtent);
+                    }
+
+                    boundKernelFnObj(
+                        acc);
+
+                    // Wait for all threads to finish the block before the shared memory is deleted.
+                    #pragma omp barrier
+                }
+            }
+
+            block::st::freeMem(acc);
+        }
+
+#if defined(ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS_ENABLED) && (_OPENMP >= 200805)
+        //-----------------------------------------------------------------------------
+        //! Executes all blocks of the grid within a single (nested) parallel region.
+        //!
+        //! The outer parallel region creates as many teams as blocks fit onto the available threads.
+        //! Each team opens one inner parallel region with one thread per block thread and
+        //! processes blocks until all of them have been executed.
+        //! All barriers and 'omp single' constructs within the kernel bind to the inner region so they only synchronize the threads of one block.
+        template<
+            typename TBoundKernelFnObj>
+        ALPAKA_FN_HOST auto runBlocksConcurrently(
+            Vec<TDim, TIdx> const & gridBlockExtent,
+            TIdx const & blockThreadCount,
+            std::size_t const & blockSharedMemDynSizeBytes,
+            TBoundKernelFnObj const & boundKernelFnObj) const
+        -> void
+        {
+            TIdx const gridBlockCount(gridBlockExtent.prod());
+            // The blocks of all problem instances are executed by the same teams.
+            TIdx const batchGridBlockCount(gridBlockCount * m_batchCount);
+            if(batchGridBlockCount == static_cast<TIdx>(0u))
+            {
+                return;
+            }
+
+            int const iBlockThreadCount(static_cast<int>(blockThreadCount));
+
+            // Use as many teams as blocks can be executed concurrently on the available threads.
+            int const threadCountMax(std::min(::omp_get_max_threads(), ::omp_get_thread_limit()));
+            int const iTeamCount(
+                static_cast<int>(
+                    std::min(
+                        static_cast<TIdx>(std::max(threadCountMax / iBlockThreadCount, 1)),
+                        batchGridBlockCount)));
+
+            // Nested parallelism is required for the per-block teams.
+            int const ompMaxActiveLevels(::omp_get_max_active_levels());
+            ::omp_set_max_active_levels(std::max(ompMaxActiveLevels, 2));
+
+            // The linear index of the next block to be executed by any team.
+            std::atomic<TIdx> nextGridBlockIdx(static_cast<TIdx>(0u));
+
+            #pragma omp parallel num_threads(iTeamCount)
+            {
+                // Each team has its own accelerator holding the block index and the block shared memory.
+                AccCpuOmp2Threads<TDim, TIdx> acc(
+                    *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
+                    blockSharedMemDynSizeBytes);
+                acc.m_bCooperative = m_bCooperative;
+
+                // The linear index of the block currently executed by this team.
+                TIdx linearGridBlockIdx(static_cast<TIdx>(0u));
+
+                #pragma omp parallel num_threads(iBlockThreadCount)
+                {
+                    // The guard is for gcc internal compiler error, as discussed in #735
 #if (!BOOST_COMP_GNUC) || (BOOST_COMP_GNUC >= BOOST_VERSION_NUMBER(8, 1, 0))
-                        #pragma omp single nowait
+                    #pragma omp single nowait
+                    {
+                        int const numThreads(::omp_get_num_threads());
+                        if(numThreads != iBlockThreadCount)
                         {
-                            // The OpenMP runtime does not create a parallel region when only one thread is required in the num_threads clause.
-                            // In all other cases we expect to be in a parallel region now.
-                            if((iBlockThreadCount > 1) && (::omp_in_parallel() == 0))
-                            {
-                                throw std::runtime_error("The OpenMP 2.0 runtime did not create a parallel region!");
-                            }
+                            throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
+                        }
+                    }
+#endif
+                    while(true)
+                    {
+                        // One thread of the team frees the shared memory of the previous block and fetches the next block.
+                        // The implicit barrier at the end of omp single publishes the new block index to the team.
+                        #pragma omp single
+                        {
+                            block::st::freeMem(acc);
 
-                            int const numThreads(::omp_get_num_threads());
-                            if(numThreads != iBlockThreadCount)
+                            linearGridBlockIdx = nextGridBlockIdx.fetch_add(static_cast<TIdx>(1u));
+                            if(linearGridBlockIdx < batchGridBlockCount)
                             {
-                                throw std::runtime_error("The OpenMP 2.0 runtime did not use the number of threads that had been required!");
+                                acc.m_batchIdx = linearGridBlockIdx / gridBlockCount;
+                                acc.m_gridBlockIdx = mapIdx<TDim::value>(
+                                    Vec<DimInt<1u>, TIdx>(linearGridBlockIdx % gridBlockCount),
+                                    gridBlockExtent);
                             }
                         }
-#endif
+
+                        if(linearGridBlockIdx >= batchGridBlockCount)
+                        {
+                            break;
+                        }
+
                         boundKernelFnObj(
                             acc);
 
-                        // Wait for all threads to finish before deleting the shared memory.
-                        // This is done by default if the omp 'nowait' clause is missing on the omp parallel directive
-                        //block::syncBlockThreads(acc);
+                        // Wait for all threads of the team to finish the block before the shared memory is deleted.
+                        #pragma omp barrier
                     }
+                }
+            }
 
-                    // After a block has been processed, the shared memory has to be deleted.
-                    block::st::freeMem(acc);
-                });
-
-            // Reset the dynamic thread number setting.
-            ::omp_set_dynamic(ompIsDynamic);
+            // Reset the nesting setting.
+            ::omp_set_max_active_levels(ompMaxActiveLevels);
         }
+#endif
 
-    private:
         TKernelFnObj m_kernelFnObj;
         std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+        bool m_bCooperative;
     };
 
     namespace traits
@@ -24,6 +24,7 @@
 #include <alpaka/core/Unused.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
 #include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/ApplyTuple.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
@@ -57,13 +58,47 @@ namespace alpaka
             TArgs && ... args) :
                 WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
                 m_kernelFnObj(kernelFnObj),
-                m_args(std::forward<TArgs>(args)...)
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u)),
+                m_bCooperative(false)
         {
             static_assert(
                 Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
                 "The work division and the execution task have to be of the same dimensionality!");
         }
         //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuSerial(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuSerial(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a cooperative launch which allows the kernel to synchronize the grid.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuSerial(
+            detail::TaskKernelCooperative const &,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuSerial(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_bCooperative = true;
+        }
+        //-----------------------------------------------------------------------------
         TaskKernelCpuSerial(TaskKernelCpuSerial const &) = default;
         //-----------------------------------------------------------------------------
         TaskKernelCpuSerial(TaskKernelCpuSerial &&) = default;
@@ -80,6 +115,9 @@ namespace alpaka
         -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuSerial<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
 
             auto const gridBlockExtent(
                 getWorkDiv<Grid, Blocks>(*this));
@@ -124,30 +162,38 @@ namespace alpaka
             AccCpuSerial<TDim, TIdx> acc(
                 *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
                 blockSharedMemDynSizeBytes);
+            acc.m_bCooperative = m_bCooperative;
 
             if(blockThreadExtent.prod() != static_cast<TIdx>(1u))
             {
                 throw std::runtime_error("A block for the serial accelerator can only ever have one single thread!");
             }
 
-            // Execute the blocks serially.
-            meta::ndLoopIncIdx(
-                gridBlockExtent,
-                [&](Vec<TDim, TIdx> const & blockThreadIdx)
-                {
-                    acc.m_gridBlockIdx = blockThreadIdx;
+            // Execute the blocks of all problem instances serially.
+            for(TIdx batchIdx(0u); batchIdx < m_batchCount; ++batchIdx)
+            {
+                acc.m_batchIdx = batchIdx;
 
-                    boundKernelFnObj(
-                        acc);
+                meta::ndLoopIncIdx(
+                    gridBlockExtent,
+                    [&](Vec<TDim, TIdx> const & blockThreadIdx)
+                    {
+                        acc.m_gridBlockIdx = blockThreadIdx;
 
-                    // After a block has been processed, the shared memory has to be deleted.
-                    block::st::freeMem(acc);
-                });
+                        boundKernelFnObj(
+                            acc);
+
+                        // After a block has been processed, the shared memory has to be deleted.
+                        block::st::freeMem(acc);
+                    });
+            }
         }
 
     private:
         TKernelFnObj m_kernelFnObj;
         std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+        bool m_bCooperative;
     };
 
     namespace traits
@@ -24,6 +24,7 @@
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/idx/MapIdx.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <alpaka/meta/NdLoop.hpp>
@@ -63,13 +64,47 @@ namespace alpaka
             TArgs && ... args) :
                 WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
                 m_kernelFnObj(kernelFnObj),
-                m_args(std::forward<TArgs>(args)...)
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u)),
+                m_bCooperative(false)
         {
             static_assert(
                 Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
                 "The work division and the execution task have to be of the same dimensionality!");
         }
         //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuTbbBlocks(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuTbbBlocks(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a cooperative launch which allows the kernel to synchronize the grid.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuTbbBlocks(
+            detail::TaskKernelCooperative const &,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuTbbBlocks(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_bCooperative = true;
+        }
+        //-----------------------------------------------------------------------------
         TaskKernelCpuTbbBlocks(TaskKernelCpuTbbBlocks const &) = default;
         //-----------------------------------------------------------------------------
         TaskKernelCpuTbbBlocks(TaskKernelCpuTbbBlocks &&) = default;
@@ -86,6 +121,9 @@ namespace alpaka
         -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuTbbBlocks<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
 
             auto const gridBlockExtent(
                 getWorkDiv<Grid, Blocks>(*this));
@@ -135,18 +173,21 @@ namespace alpaka
                 throw std::runtime_error("A block for the TBB accelerator can only ever have one single thread!");
             }
 
+            // The blocks of all problem instances are distributed by a single parallel loop.
             tbb::parallel_for(
                 static_cast<TIdx>(0),
-                static_cast<TIdx>(numBlocksInGrid),
+                static_cast<TIdx>(numBlocksInGrid * m_batchCount),
                 [&](TIdx i){
                         AccCpuTbbBlocks<TDim, TIdx> acc(
                             *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
                             blockSharedMemDynSizeBytes);
+                        acc.m_bCooperative = m_bCooperative;
 
+                        acc.m_batchIdx = i / numBlocksInGrid;
                         acc.m_gridBlockIdx =
                             mapIdx<TDim::value>(
                                 Vec<DimInt<1u>, TIdx>(
-                                    static_cast<TIdx>(i)
+                                    static_cast<TIdx>(i % numBlocksInGrid)
                                 ),
                                 gridBlockExtent
                             );
@@ -161,6 +202,8 @@ namespace alpaka
     private:
         TKernelFnObj m_kernelFnObj;
         std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+        bool m_bCooperative;
     };
 
     namespace traits
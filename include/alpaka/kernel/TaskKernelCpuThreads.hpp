@@ -23,6 +23,7 @@
 #include <alpaka/core/Decay.hpp>
 #include <alpaka/dev/DevCpu.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <alpaka/core/BoostPredef.hpp>
@@ -86,13 +87,47 @@ namespace alpaka
             TArgs && ... args) :
                 WorkDivMembers<TDim, TIdx>(std::forward<TWorkDiv>(workDiv)),
                 m_kernelFnObj(kernelFnObj),
-                m_args(std::forward<TArgs>(args)...)
+                m_args(std::forward<TArgs>(args)...),
+                m_batchCount(static_cast<TIdx>(1u)),
+                m_bCooperative(false)
         {
             static_assert(
                 Dim<std::decay_t<TWorkDiv>>::value == TDim::value,
                 "The work division and the execution task have to be of the same dimensionality!");
         }
         //-----------------------------------------------------------------------------
+        //! Creates a batched execution of the given number of problem instances.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuThreads(
+            detail::TaskKernelBatch<TIdx> const & batch,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuThreads(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_batchCount = batch.m_batchCount;
+        }
+        //-----------------------------------------------------------------------------
+        //! Creates a cooperative launch which allows the kernel to synchronize the grid.
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST TaskKernelCpuThreads(
+            detail::TaskKernelCooperative const &,
+            TWorkDiv && workDiv,
+            TKernelFnObj const & kernelFnObj,
+            TArgs && ... args) :
+                TaskKernelCpuThreads(
+                    std::forward<TWorkDiv>(workDiv),
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...)
+        {
+            m_bCooperative = true;
+        }
+        //-----------------------------------------------------------------------------
         TaskKernelCpuThreads(TaskKernelCpuThreads const &) = default;
         //-----------------------------------------------------------------------------
         TaskKernelCpuThreads(TaskKernelCpuThreads &&) = default;
@@ -109,6 +144,9 @@ namespace alpaka
         -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return trace::detail::describeKernel<AccCpuThreads<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));});
 
             auto const gridBlockExtent(
                 getWorkDiv<Grid, Blocks>(*this));
@@ -139,6 +177,7 @@ namespace alpaka
             AccCpuThreads<TDim, TIdx> acc(
                 *static_cast<WorkDivMembers<TDim, TIdx> const *>(this),
                 blockSharedMemDynSizeBytes);
+            acc.m_bCooperative = m_bCooperative;
 
             auto const blockThreadCount(blockThreadExtent.prod());
             ThreadPool threadPool(blockThreadCount);
@@ -160,10 +199,15 @@ namespace alpaka
                     },
                     m_args));
 
-            // Execute the blocks serially.
-            meta::ndLoopIncIdx(
-                gridBlockExtent,
-                boundGridBlockExecHost);
+            // Execute the blocks of all problem instances serially.
+            for(TIdx batchIdx(0u); batchIdx < m_batchCount; ++batchIdx)
+            {
+                acc.m_batchIdx = batchIdx;
+
+                meta::ndLoopIncIdx(
+                    gridBlockExtent,
+                    boundGridBlockExecHost);
+            }
         }
 
     private:
@@ -296,6 +340,8 @@ namespace alpaka
 
         TKernelFnObj m_kernelFnObj;
         std::tuple<std::decay_t<TArgs>...> m_args;
+        TIdx m_batchCount;
+        bool m_bCooperative;
     };
 
     namespace traits
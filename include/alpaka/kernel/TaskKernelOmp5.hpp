@@ -28,6 +28,7 @@
 #include <alpaka/dev/DevOmp5.hpp>
 #include <alpaka/idx/MapIdx.hpp>
 #include <alpaka/kernel/Traits.hpp>
+#include <alpaka/trace/Trace.hpp>
 #include <alpaka/workdiv/WorkDivMembers.hpp>
 
 #include <alpaka/meta/ApplyTuple.hpp>
@@ -36,8 +37,10 @@
 
 #include <functional>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <algorithm>
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
     #include <iostream>
@@ -83,12 +86,49 @@ namespace alpaka
         ~TaskKernelOmp5() = default;
 
         //-----------------------------------------------------------------------------
-        //! Executes the kernel function object.
+        //! Executes the kernel function object and waits for its completion.
         ALPAKA_FN_HOST auto operator()(
                 const
                 DevOmp5& dev
             ) const
         -> void
+        {
+            if(::omp_in_parallel() != 0)
+            {
+                throw std::runtime_error("The OpenMP 5.0 backend can not be used within an existing parallel region!");
+            }
+
+            ALPAKA_TRACE_SCOPE(
+                "kernel",
+                [this](){return this->describeTrace();});
+
+            // Outside of a parallel region the target task is not deferred but the wait makes this explicit.
+            char dependency(0);
+            (*this)(dev, &dependency);
+            #pragma omp taskwait
+        }
+
+#ifdef ALPAKA_TRACE_ENABLED
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST auto describeTrace() const
+        -> std::pair<std::string, std::string>
+        {
+            return trace::detail::describeKernel<AccOmp5<TDim, TIdx>, TKernelFnObj>(*static_cast<WorkDivMembers<TDim, TIdx> const *>(this));
+        }
+#endif
+
+        //-----------------------------------------------------------------------------
+        //! Launches the kernel function object as a deferred target task.
+        //!
+        //! The task depends on (inout) the given dependency object so launches sharing it are executed in order.
+        //! The kernel function object and the arguments are copied into the task once.
+        //! The caller has to wait for the task before the execution can be traced.
+        ALPAKA_FN_HOST auto operator()(
+                const
+                DevOmp5& dev,
+                char * const pDependency
+            ) const
+        -> void
         {
             ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
 
@@ -150,20 +190,16 @@ namespace alpaka
             std::cout << "teamCount=" << teamCount << "\tgridBlockCount=" << gridBlockCount << std::endl;
 #endif
 
-            if(::omp_in_parallel() != 0)
-            {
-                throw std::runtime_error("The OpenMP 5.0 backend can not be used within an existing parallel region!");
-            }
-
             // Force the environment to use the given number of threads.
             int const ompIsDynamic(::omp_get_dynamic());
             ::omp_set_dynamic(0);
 
             // `When an if(scalar-expression) evaluates to false, the structured block is executed on the host.`
+            // All values used within the region are firstprivate because the task may be executed after this function returned.
             auto argsD = m_args;
             auto kernelFnObj = m_kernelFnObj;
             const auto iDevice = dev.iDevice();
-            #pragma omp target device(iDevice)
+            #pragma omp target device(iDevice) nowait depend(inout: pDependency[0]) firstprivate(argsD, kernelFnObj, gridBlockExtent, blockThreadExtent, threadElemExtent, blockSharedMemDynSizeBytes, gridBlockCount, blockThreadCount, teamCount)
             {
                 #pragma omp teams distribute num_teams(teamCount) //thread_limit(blockThreadCount)
                 for(TIdx t = 0u; t < gridBlockCount; ++t)
@@ -322,9 +358,12 @@ namespace alpaka
 
                 queue.m_spQueueImpl->m_bCurrentlyExecutingTask = true;
 
-                task(
-                        queue.m_spQueueImpl->m_dev
-                    );
+                {
+                    ALPAKA_TRACE_QUEUE_SCOPE(queue.m_spQueueImpl.get());
+                    task(
+                            queue.m_spQueueImpl->m_dev
+                        );
+                }
 
                 queue.m_spQueueImpl->m_bCurrentlyExecutingTask = false;
             }
@@ -345,12 +384,20 @@ namespace alpaka
                 TaskKernelOmp5<TDim, TIdx, TKernelFnObj, TArgs...> const & task)
             -> void
             {
-                queue.m_spQueueImpl->m_workerThread.enqueueTask(
-                    [&queue, task]()
+                auto const dev(queue.m_spQueueImpl->m_dev);
+                queue.m_spQueueImpl->enqueueLaunch(
+                    [dev, task](char * const pDependency)
                     {
+                        // The record covers the execution of the kernel and not only its submission.
+                        ALPAKA_TRACE_SCOPE(
+                            "kernel",
+                            [&task](){return task.describeTrace();});
+
                         task(
-                                queue.m_spQueueImpl->m_dev
+                                dev,
+                                pDependency
                             );
+                        #pragma omp taskwait
                     });
             }
         };
@@ -19,16 +19,34 @@
 
 #include <alpaka/core/BoostPredef.hpp>
 #include <alpaka/core/Debug.hpp>
-#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
-    #include <alpaka/workdiv/Traits.hpp>
-#endif
+#include <alpaka/workdiv/Traits.hpp>
 
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 //-----------------------------------------------------------------------------
 //! The alpaka accelerator library.
 namespace alpaka
 {
+    namespace detail
+    {
+        //#############################################################################
+        //! The tag selecting the batched execution of a kernel execution task.
+        template<
+            typename TIdx>
+        struct TaskKernelBatch
+        {
+            //! The number of problem instances.
+            TIdx m_batchCount;
+        };
+
+        //#############################################################################
+        //! The tag selecting the cooperative launch of a kernel execution task.
+        struct TaskKernelCooperative{};
+    }
+
     //-----------------------------------------------------------------------------
     //! The kernel traits.
     namespace traits
@@ -43,6 +61,58 @@ namespace alpaka
             typename TSfinae = void*/>
         struct CreateTaskKernel;
 
+        //#############################################################################
+        //! The cooperative kernel execution task creation trait.
+        //!
+        //! Only accelerators supporting grid synchronization specialize it.
+        template<
+            typename TAcc,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelCooperative;
+
+        //#############################################################################
+        //! The batched kernel execution task creation trait.
+        //!
+        //! By default the execution task of CreateTaskKernel is constructed from the TaskKernelBatch tag.
+        //! Accelerators whose execution tasks can not provide the batch index do not support batched launches.
+        template<
+            typename TAcc,
+            typename TWorkDiv,
+            typename TKernelFnObj,
+            typename... TArgs>
+        struct CreateTaskKernelBatched
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto createTaskKernelBatched(
+                TWorkDiv const & workDiv,
+                Idx<TAcc> const & batchCount,
+                TKernelFnObj const & kernelFnObj,
+                TArgs && ... args)
+            {
+                using TaskKernel = decltype(
+                    CreateTaskKernel<
+                        TAcc,
+                        TWorkDiv,
+                        TKernelFnObj,
+                        TArgs...>::createTaskKernel(
+                            workDiv,
+                            kernelFnObj,
+                            std::forward<TArgs>(args)...));
+                static_assert(
+                    std::is_constructible<TaskKernel, alpaka::detail::TaskKernelBatch<Idx<TAcc>>, TWorkDiv const &, TKernelFnObj const &, TArgs && ...>::value,
+                    "The accelerator does not support batched kernel execution!");
+
+                return
+                    TaskKernel(
+                        alpaka::detail::TaskKernelBatch<Idx<TAcc>>{batchCount},
+                        workDiv,
+                        kernelFnObj,
+                        std::forward<TArgs>(args)...);
+            }
+        };
+
         //#############################################################################
         //! The trait for getting the size of the block shared dynamic memory of a kernel.
         //!
@@ -90,6 +160,31 @@ namespace alpaka
                 return 0u;
             }
         };
+
+        //#############################################################################
+        //! The trait declaring that a kernel never synchronizes the threads of a block.
+        //!
+        //! \tparam TKernelFnObj The kernel function object.
+        //!
+        //! Accelerators executing the threads of a block as the lanes of a single loop require it.
+        //! The default implementation is false, so a kernel has to opt in by specializing it.
+        template<
+            typename TKernelFnObj,
+            typename TSfinae = void>
+        struct IsBlockSyncFree :
+            std::false_type
+        {};
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \tparam TKernelFnObj The kernel function object.
+    //! \return If the kernel never synchronizes the threads of a block.
+    template<
+        typename TKernelFnObj>
+    ALPAKA_FN_HOST_ACC constexpr auto isBlockSyncFree()
+    -> bool
+    {
+        return traits::IsBlockSyncFree<TKernelFnObj>::value;
     }
 
 #if BOOST_COMP_CLANG
@@ -163,6 +258,7 @@ namespace alpaka
             }
         };
     }
+
     //-----------------------------------------------------------------------------
     //! Creates a kernel execution task.
     //!
@@ -247,4 +343,205 @@ namespace alpaka
                 kernelFnObj,
                 std::forward<TArgs>(args)...));
     }
+
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+    //-----------------------------------------------------------------------------
+    //! Creates a cooperative kernel execution task.
+    //!
+    //! All blocks of a cooperative launch are resident at the same time, so the kernel is allowed to call grid::syncGridThreads.
+    //! The number of blocks must not exceed getCooperativeGridBlockCountMax.
+    //!
+    //! \tparam TAcc The accelerator type.
+    //! \param workDiv The index domain work division.
+    //! \param kernelFnObj The kernel function object which should be executed.
+    //! \param args,... The kernel invocation arguments.
+    //! \return The kernel execution task.
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+    template<
+        typename TAcc,
+        typename TWorkDiv,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto createTaskKernelCooperative(
+        TWorkDiv const & workDiv,
+        TKernelFnObj const & kernelFnObj,
+        TArgs && ... args)
+    {
+        // check for void return type
+        detail::CheckFnReturnType<TAcc>{}(kernelFnObj, args...);
+
+        static_assert(
+            Dim<std::decay_t<TWorkDiv>>::value == Dim<TAcc>::value,
+            "The dimensions of TAcc and TWorkDiv have to be identical!");
+        static_assert(
+            std::is_same<Idx<std::decay_t<TWorkDiv>>, Idx<TAcc>>::value,
+            "The idx type of TAcc and the idx type of TWorkDiv have to be identical!");
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+        std::cout << __func__
+            << " workDiv: " << workDiv
+            << ", kernelFnObj: " << typeid(kernelFnObj).name()
+            << std::endl;
+#endif
+        return
+            traits::CreateTaskKernelCooperative<
+                TAcc,
+                TWorkDiv,
+                TKernelFnObj,
+                TArgs...>::createTaskKernelCooperative(
+                    workDiv,
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...);
+    }
+
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+    //-----------------------------------------------------------------------------
+    //! Executes the given kernel in the given queue as a cooperative launch.
+    //!
+    //! \tparam TAcc The accelerator type.
+    //! \param queue The queue to enqueue the kernel execution task into.
+    //! \param workDiv The index domain work division.
+    //! \param kernelFnObj The kernel function object which should be executed.
+    //! \param args,... The kernel invocation arguments.
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+    template<
+        typename TAcc,
+        typename TQueue,
+        typename TWorkDiv,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto execCooperative(
+        TQueue & queue,
+        TWorkDiv const & workDiv,
+        TKernelFnObj const & kernelFnObj,
+        TArgs && ... args)
+    -> void
+    {
+        enqueue(
+            queue,
+            createTaskKernelCooperative<
+                TAcc>(
+                workDiv,
+                kernelFnObj,
+                std::forward<TArgs>(args)...));
+    }
+
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+    //-----------------------------------------------------------------------------
+    //! Creates a task executing a kernel for many independent problem instances.
+    //!
+    //! The grid of the work division is executed once per problem instance.
+    //! All blocks of all instances are scheduled by a single launch, e.g. within a single parallel region.
+    //! The kernel queries the index of its problem instance with getBatchIdx(acc).
+    //! All other indices and the work division are those of a single instance.
+    //!
+    //! \tparam TAcc The accelerator type.
+    //! \param workDiv The index domain work division of a single problem instance.
+    //! \param batchCount The number of problem instances.
+    //! \param kernelFnObj The kernel function object which should be executed.
+    //! \param args,... The kernel invocation arguments.
+    //! \return The kernel execution task.
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+    template<
+        typename TAcc,
+        typename TWorkDiv,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto createTaskKernelBatched(
+        TWorkDiv const & workDiv,
+        Idx<TAcc> const & batchCount,
+        TKernelFnObj const & kernelFnObj,
+        TArgs && ... args)
+    {
+        // check for void return type
+        detail::CheckFnReturnType<TAcc>{}(kernelFnObj, args...);
+
+        static_assert(
+            Dim<std::decay_t<TWorkDiv>>::value == Dim<TAcc>::value,
+            "The dimensions of TAcc and TWorkDiv have to be identical!");
+        static_assert(
+            std::is_same<Idx<std::decay_t<TWorkDiv>>, Idx<TAcc>>::value,
+            "The idx type of TAcc and the idx type of TWorkDiv have to be identical!");
+
+        // The blocks of all problem instances are enumerated by a single index.
+        auto const gridBlockCount(getWorkDiv<Grid, Blocks>(workDiv).prod());
+        if((gridBlockCount > static_cast<Idx<TAcc>>(0u))
+            && (batchCount > std::numeric_limits<Idx<TAcc>>::max() / gridBlockCount))
+        {
+            throw std::runtime_error("The number of blocks of all problem instances of a batched launch exceeds the index type!");
+        }
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+        std::cout << __func__
+            << " workDiv: " << workDiv
+            << ", batchCount: " << batchCount
+            << ", kernelFnObj: " << typeid(kernelFnObj).name()
+            << std::endl;
+#endif
+        return
+            traits::CreateTaskKernelBatched<
+                TAcc,
+                TWorkDiv,
+                TKernelFnObj,
+                TArgs...>::createTaskKernelBatched(
+                    workDiv,
+                    batchCount,
+                    kernelFnObj,
+                    std::forward<TArgs>(args)...);
+    }
+
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"  // clang does not support the syntax for variadic template arguments "args,..."
+#endif
+    //-----------------------------------------------------------------------------
+    //! Executes the given kernel in the given queue for many independent problem instances.
+    //!
+    //! \tparam TAcc The accelerator type.
+    //! \param queue The queue to enqueue the kernel execution task into.
+    //! \param workDiv The index domain work division of a single problem instance.
+    //! \param batchCount The number of problem instances.
+    //! \param kernelFnObj The kernel function object which should be executed.
+    //! \param args,... The kernel invocation arguments.
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+    template<
+        typename TAcc,
+        typename TQueue,
+        typename TWorkDiv,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto execBatched(
+        TQueue & queue,
+        TWorkDiv const & workDiv,
+        Idx<TAcc> const & batchCount,
+        TKernelFnObj const & kernelFnObj,
+        TArgs && ... args)
+    -> void
+    {
+        enqueue(
+            queue,
+            createTaskKernelBatched<
+                TAcc>(
+                workDiv,
+                batchCount,
+                kernelFnObj,
+                std::forward<TArgs>(args)...));
+    }
 }
@@ -19,6 +19,7 @@
 #include <alpaka/math/cos/CosStdLib.hpp>
 #include <alpaka/math/erf/ErfStdLib.hpp>
 #include <alpaka/math/exp/ExpStdLib.hpp>
+#include <alpaka/math/fast/FastStdLib.hpp>
 #include <alpaka/math/floor/FloorStdLib.hpp>
 #include <alpaka/math/fmod/FmodStdLib.hpp>
 #include <alpaka/math/log/LogStdLib.hpp>
@@ -53,6 +54,7 @@ namespace alpaka
             public CosStdLib,
             public ErfStdLib,
             public ExpStdLib,
+            public fast::FastStdLib,
             public FloorStdLib,
             public FmodStdLib,
             public LogStdLib,
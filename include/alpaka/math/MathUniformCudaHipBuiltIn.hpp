@@ -46,6 +46,7 @@
 #include <alpaka/math/cos/CosUniformCudaHipBuiltIn.hpp>
 #include <alpaka/math/erf/ErfUniformCudaHipBuiltIn.hpp>
 #include <alpaka/math/exp/ExpUniformCudaHipBuiltIn.hpp>
+#include <alpaka/math/fast/FastUniformCudaHipBuiltIn.hpp>
 #include <alpaka/math/floor/FloorUniformCudaHipBuiltIn.hpp>
 #include <alpaka/math/fmod/FmodUniformCudaHipBuiltIn.hpp>
 #include <alpaka/math/log/LogUniformCudaHipBuiltIn.hpp>
@@ -80,6 +81,7 @@ namespace alpaka
             public CosUniformCudaHipBuiltIn,
             public ErfUniformCudaHipBuiltIn,
             public ExpUniformCudaHipBuiltIn,
+            public fast::FastUniformCudaHipBuiltIn,
             public FloorUniformCudaHipBuiltIn,
             public FmodUniformCudaHipBuiltIn,
             public LogUniformCudaHipBuiltIn,
@@ -0,0 +1,415 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/math/fast/Traits.hpp>
+
+#include <alpaka/core/Unused.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace math
+    {
+        namespace fast
+        {
+            namespace detail
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST inline auto asBits(
+                    float const & x)
+                -> std::int32_t
+                {
+                    std::int32_t bits;
+                    std::memcpy(&bits, &x, sizeof(bits));
+                    return bits;
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST inline auto asFloat(
+                    std::int32_t const & bits)
+                -> float
+                {
+                    float x;
+                    std::memcpy(&x, &bits, sizeof(x));
+                    return x;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return a if the condition holds, else b.
+                //!
+                //! The selection is done with bit operations. Compilers would not if-convert a ternary operator on floats
+                //! whose operands may trap, which keeps loops calling the functions from being vectorized.
+                ALPAKA_FN_HOST inline auto select(
+                    bool const & condition,
+                    float const & a,
+                    float const & b)
+                -> float
+                {
+                    std::int32_t const mask(-static_cast<std::int32_t>(condition));
+                    return asFloat((asBits(a) & mask) | (asBits(b) & ~mask));
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The exp approximation.
+                //!
+                //! The argument is reduced to r = x - n * ln(2) with |r| <= ln(2) / 2 using a two part ln(2).
+                //! exp(r) is evaluated by the minimax polynomial of Cephes and scaled by 2^n.
+                ALPAKA_FN_HOST inline auto exp(
+                    float const & x)
+                -> float
+                {
+                    // Clamping to [-104, 89] lets the scaling overflow to infinity and underflow to zero on its own.
+                    // It works on the bit pattern: as signed integers positive floats are ordered and as unsigned
+                    // integers negative floats are ordered by magnitude. NaN is restored at the end.
+                    std::int32_t const bits(asBits(x));
+                    std::int32_t const upper(bits < 0x42B20000 ? bits : 0x42B20000);
+                    std::uint32_t const lower(
+                        static_cast<std::uint32_t>(upper) < 0xC2D00000u ? static_cast<std::uint32_t>(upper) : 0xC2D00000u);
+                    float const xc(asFloat(static_cast<std::int32_t>(lower)));
+
+                    // Adding 1.5 * 2^23 rounds to the nearest integer which ends up in the low mantissa bits.
+                    float const shifted(xc * 1.44269504088896341f + 12582912.0f);
+                    std::uint32_t const n(
+                        static_cast<std::uint32_t>(asBits(shifted)) - static_cast<std::uint32_t>(asBits(12582912.0f)));
+                    float const nf(shifted - 12582912.0f);
+                    float const r((xc - nf * 0.693359375f) + nf * 2.12194440e-4f);
+                    float const z(r * r);
+                    float const p(
+                        (((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r + 4.1665795894e-2f) * r
+                        + 1.6666665459e-1f) * r + 5.0000001201e-1f) * z + r + 1.0f);
+
+                    // 2^n is applied in two halves as it does not fit into the exponent of a single float for all n.
+                    std::uint32_t const n1(static_cast<std::uint32_t>(static_cast<std::int32_t>(n) >> 1));
+                    std::uint32_t const n2(n - n1);
+                    float const result(
+                        p
+                        * asFloat(static_cast<std::int32_t>((n1 + 127u) << 23))
+                        * asFloat(static_cast<std::int32_t>((n2 + 127u) << 23)));
+                    return select(std::isnan(x), x, result);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The log approximation.
+                //!
+                //! The argument is split into 2^e * m with m in [sqrt(0.5), sqrt(2)).
+                //! log(m) is evaluated by the minimax polynomial of Cephes and e * ln(2) is added using a two part ln(2).
+                ALPAKA_FN_HOST inline auto log(
+                    float const & x)
+                -> float
+                {
+                    std::int32_t const bits(asBits(x));
+                    bool const large((bits & 0x007FFFFF) > 0x003504F3);
+                    std::int32_t const e(((bits >> 23) & 0xFF) - 127 + static_cast<std::int32_t>(large));
+                    float const m(asFloat((bits & 0x007FFFFF) | (0x3F800000 - (static_cast<std::int32_t>(large) << 23))));
+                    float const f(m - 1.0f);
+                    float const z(f * f);
+                    float y(
+                        ((((((((7.0376836292e-2f * f - 1.1514610310e-1f) * f + 1.1676998740e-1f) * f - 1.2420140846e-1f) * f
+                        + 1.4249322787e-1f) * f - 1.6668057665e-1f) * f + 2.0000714765e-1f) * f - 2.4999993993e-1f) * f
+                        + 3.3333331174e-1f) * f * z);
+                    float const ef(static_cast<float>(e));
+                    y += -2.12194440e-4f * ef;
+                    y += -0.5f * z;
+                    float const result((f + y) + 0.693359375f * ef);
+
+                    // Subnormal arguments are treated as zero.
+                    bool const zero((bits & 0x7FFFFFFF) < 0x00800000);
+                    bool const negative(bits < 0);
+                    bool const infOrNan(bits >= 0x7F800000);
+                    float const special(
+                        select(
+                            zero,
+                            -std::numeric_limits<float>::infinity(),
+                            select(negative, std::numeric_limits<float>::quiet_NaN(), x)));
+                    return select(zero | negative | infOrNan, special, result);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The sin and cos approximation.
+                //!
+                //! The argument is reduced to [-pi/4, pi/4] using a three part pi/4 and the octant selects the sin or the
+                //! cos minimax polynomial of Cephes and the sign.
+                //!
+                //! \param quadrantOffset 0 for sin and 2 for cos.
+                //! \param signBits The sign bit of the argument for sin and 0 for cos.
+                ALPAKA_FN_HOST inline auto sinCos(
+                    float const & x,
+                    std::int32_t const & quadrantOffset,
+                    std::int32_t const & signBits)
+                -> float
+                {
+                    std::int32_t const absBits(asBits(x) & 0x7FFFFFFF);
+                    // The clamping keeps the conversion to int defined for huge, infinite and NaN arguments.
+                    float const ax(asFloat(absBits < 0x4A800000 ? absBits : 0x4A800000));
+                    std::int32_t const j((static_cast<std::int32_t>(ax * 1.27323954473516f) + 1) & ~1);
+                    float const y(static_cast<float>(j));
+                    float const r(((ax - y * 0.78515625f) - y * 2.4187564849853515625e-4f) - y * 3.77489497744594108e-8f);
+                    float const z(r * r);
+                    float const s(((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r);
+                    float const c(
+                        ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z
+                        - 0.5f * z + 1.0f);
+                    std::int32_t const q(j + quadrantOffset);
+                    float const v(select((q & 2) != 0, c, s));
+                    // Bit 2 of the octant flips the sign.
+                    float const result(asFloat(asBits(v) ^ (((q & 4) << 29) ^ signBits)));
+                    return select(absBits >= 0x7F800000, std::numeric_limits<float>::quiet_NaN(), result);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The rsqrt approximation.
+                //!
+                //! The initial guess from the bit pattern is refined by three Newton iterations.
+                ALPAKA_FN_HOST inline auto rsqrt(
+                    float const & x)
+                -> float
+                {
+                    std::int32_t const bits(asBits(x));
+                    float const h(0.5f * x);
+                    float r(asFloat(0x5F375A86 - (bits >> 1)));
+                    r = r * (1.5f - h * r * r);
+                    r = r * (1.5f - h * r * r);
+                    r = r * (1.5f - h * r * r);
+
+                    // Subnormal arguments are treated as zero.
+                    bool const zero((bits & 0x7FFFFFFF) < 0x00800000);
+                    bool const negative(bits < 0);
+                    bool const infOrNan(bits >= 0x7F800000);
+                    float const special(
+                        select(
+                            zero,
+                            std::numeric_limits<float>::infinity(),
+                            select(negative, std::numeric_limits<float>::quiet_NaN(), select(bits == 0x7F800000, 0.0f, x))));
+                    return select(zero | negative | infOrNan, special, r);
+                }
+            }
+
+            //#############################################################################
+            //! The standard library based approximate math functions.
+            //!
+            //! The float versions are polynomial approximations, all other types use the standard library functions.
+            class FastStdLib : public concepts::Implements<ConceptMathFast, FastStdLib>
+            {
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //! The standard library exp trait specialization.
+                template<
+                    typename TArg>
+                struct Exp<
+                    FastStdLib,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_arithmetic<TArg>::value>>
+                {
+                    ALPAKA_FN_HOST static auto exp(
+                        FastStdLib const & exp_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(exp_ctx);
+                        return std::exp(arg);
+                    }
+                };
+                //! The approximate exp float specialization.
+                template<>
+                struct Exp<
+                    FastStdLib,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto exp(
+                        FastStdLib const & exp_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(exp_ctx);
+                        return detail::exp(arg);
+                    }
+                };
+                //#############################################################################
+                //! The standard library log trait specialization.
+                template<
+                    typename TArg>
+                struct Log<
+                    FastStdLib,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_arithmetic<TArg>::value>>
+                {
+                    ALPAKA_FN_HOST static auto log(
+                        FastStdLib const & log_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(log_ctx);
+                        return std::log(arg);
+                    }
+                };
+                //! The approximate log float specialization.
+                template<>
+                struct Log<
+                    FastStdLib,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto log(
+                        FastStdLib const & log_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(log_ctx);
+                        return detail::log(arg);
+                    }
+                };
+                //#############################################################################
+                //! The standard library sin trait specialization.
+                template<
+                    typename TArg>
+                struct Sin<
+                    FastStdLib,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_arithmetic<TArg>::value>>
+                {
+                    ALPAKA_FN_HOST static auto sin(
+                        FastStdLib const & sin_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(sin_ctx);
+                        return std::sin(arg);
+                    }
+                };
+                //! The approximate sin float specialization.
+                template<>
+                struct Sin<
+                    FastStdLib,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto sin(
+                        FastStdLib const & sin_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(sin_ctx);
+                        return detail::sinCos(arg, 0, detail::asBits(arg) & static_cast<std::int32_t>(0x80000000u));
+                    }
+                };
+                //#############################################################################
+                //! The standard library cos trait specialization.
+                template<
+                    typename TArg>
+                struct Cos<
+                    FastStdLib,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_arithmetic<TArg>::value>>
+                {
+                    ALPAKA_FN_HOST static auto cos(
+                        FastStdLib const & cos_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(cos_ctx);
+                        return std::cos(arg);
+                    }
+                };
+                //! The approximate cos float specialization.
+                template<>
+                struct Cos<
+                    FastStdLib,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto cos(
+                        FastStdLib const & cos_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(cos_ctx);
+                        return detail::sinCos(arg, 2, 0);
+                    }
+                };
+                //#############################################################################
+                //! The standard library pow trait specialization.
+                template<
+                    typename TBase,
+                    typename TExp>
+                struct Pow<
+                    FastStdLib,
+                    TBase,
+                    TExp,
+                    std::enable_if_t<
+                        std::is_arithmetic<TBase>::value
+                        && std::is_arithmetic<TExp>::value>>
+                {
+                    ALPAKA_FN_HOST static auto pow(
+                        FastStdLib const & pow_ctx,
+                        TBase const & base,
+                        TExp const & exp)
+                    {
+                        alpaka::ignore_unused(pow_ctx);
+                        return std::pow(base, exp);
+                    }
+                };
+                //! The approximate pow float specialization.
+                template<>
+                struct Pow<
+                    FastStdLib,
+                    float,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto pow(
+                        FastStdLib const & pow_ctx,
+                        float const & base,
+                        float const & exp)
+                    -> float
+                    {
+                        alpaka::ignore_unused(pow_ctx);
+                        return detail::exp(exp * detail::log(base));
+                    }
+                };
+                //#############################################################################
+                //! The standard library rsqrt trait specialization.
+                template<
+                    typename TArg>
+                struct Rsqrt<
+                    FastStdLib,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_arithmetic<TArg>::value>>
+                {
+                    ALPAKA_FN_HOST static auto rsqrt(
+                        FastStdLib const & rsqrt_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(rsqrt_ctx);
+                        return static_cast<TArg>(1)/std::sqrt(arg);
+                    }
+                };
+                //! The approximate rsqrt float specialization.
+                template<>
+                struct Rsqrt<
+                    FastStdLib,
+                    float>
+                {
+                    ALPAKA_FN_HOST static auto rsqrt(
+                        FastStdLib const & rsqrt_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(rsqrt_ctx);
+                        return detail::rsqrt(arg);
+                    }
+                };
+            }
+        }
+    }
+}
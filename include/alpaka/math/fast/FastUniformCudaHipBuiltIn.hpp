@@ -0,0 +1,271 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+    #include <cuda_runtime.h>
+    #if !BOOST_LANG_CUDA
+        #error If ALPAKA_ACC_GPU_CUDA_ENABLED is set, the compiler has to support CUDA!
+    #endif
+#endif
+
+#if defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+
+    #if BOOST_COMP_NVCC >= BOOST_VERSION_NUMBER(9, 0, 0)
+        #include <cuda_runtime_api.h>
+    #else
+        #if BOOST_COMP_HIP
+            #include <hip/math_functions.h>
+        #else
+            #include <math_functions.hpp>
+        #endif
+    #endif
+    
+    #if !BOOST_LANG_HIP
+        #error If ALPAKA_ACC_GPU_HIP_ENABLED is set, the compiler has to support HIP!
+    #endif
+#endif
+
+#include <alpaka/math/fast/Traits.hpp>
+
+#include <alpaka/core/Unused.hpp>
+
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace math
+    {
+        namespace fast
+        {
+            //#############################################################################
+            //! The CUDA built in approximate math functions.
+            //!
+            //! The float versions map to the intrinsics, all other types use the accurate functions.
+            class FastUniformCudaHipBuiltIn : public concepts::Implements<ConceptMathFast, FastUniformCudaHipBuiltIn>
+            {
+            };
+
+            namespace traits
+            {
+                //#############################################################################
+                //! The CUDA exp trait specialization.
+                template<
+                    typename TArg>
+                struct Exp<
+                    FastUniformCudaHipBuiltIn,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_floating_point<TArg>::value>>
+                {
+                    __device__ static auto exp(
+                        FastUniformCudaHipBuiltIn const & exp_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(exp_ctx);
+                        return ::exp(arg);
+                    }
+                };
+                //! The CUDA exp float specialization.
+                template<>
+                struct Exp<
+                    FastUniformCudaHipBuiltIn,
+                    float>
+                {
+                    __device__ static auto exp(
+                        FastUniformCudaHipBuiltIn const & exp_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(exp_ctx);
+                        return ::__expf(arg);
+                    }
+                };
+                //#############################################################################
+                //! The CUDA log trait specialization.
+                template<
+                    typename TArg>
+                struct Log<
+                    FastUniformCudaHipBuiltIn,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_floating_point<TArg>::value>>
+                {
+                    __device__ static auto log(
+                        FastUniformCudaHipBuiltIn const & log_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(log_ctx);
+                        return ::log(arg);
+                    }
+                };
+                //! The CUDA log float specialization.
+                template<>
+                struct Log<
+                    FastUniformCudaHipBuiltIn,
+                    float>
+                {
+                    __device__ static auto log(
+                        FastUniformCudaHipBuiltIn const & log_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(log_ctx);
+                        return ::__logf(arg);
+                    }
+                };
+                //#############################################################################
+                //! The CUDA sin trait specialization.
+                template<
+                    typename TArg>
+                struct Sin<
+                    FastUniformCudaHipBuiltIn,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_floating_point<TArg>::value>>
+                {
+                    __device__ static auto sin(
+                        FastUniformCudaHipBuiltIn const & sin_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(sin_ctx);
+                        return ::sin(arg);
+                    }
+                };
+                //! The CUDA sin float specialization.
+                template<>
+                struct Sin<
+                    FastUniformCudaHipBuiltIn,
+                    float>
+                {
+                    __device__ static auto sin(
+                        FastUniformCudaHipBuiltIn const & sin_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(sin_ctx);
+                        return ::__sinf(arg);
+                    }
+                };
+                //#############################################################################
+                //! The CUDA cos trait specialization.
+                template<
+                    typename TArg>
+                struct Cos<
+                    FastUniformCudaHipBuiltIn,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_floating_point<TArg>::value>>
+                {
+                    __device__ static auto cos(
+                        FastUniformCudaHipBuiltIn const & cos_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(cos_ctx);
+                        return ::cos(arg);
+                    }
+                };
+                //! The CUDA cos float specialization.
+                template<>
+                struct Cos<
+                    FastUniformCudaHipBuiltIn,
+                    float>
+                {
+                    __device__ static auto cos(
+                        FastUniformCudaHipBuiltIn const & cos_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(cos_ctx);
+                        return ::__cosf(arg);
+                    }
+                };
+                //#############################################################################
+                //! The CUDA pow trait specialization.
+                template<
+                    typename TBase,
+                    typename TExp>
+                struct Pow<
+                    FastUniformCudaHipBuiltIn,
+                    TBase,
+                    TExp,
+                    std::enable_if_t<
+                        std::is_floating_point<TBase>::value
+                        && std::is_floating_point<TExp>::value>>
+                {
+                    __device__ static auto pow(
+                        FastUniformCudaHipBuiltIn const & pow_ctx,
+                        TBase const & base,
+                        TExp const & exp)
+                    {
+                        alpaka::ignore_unused(pow_ctx);
+                        return ::pow(base, exp);
+                    }
+                };
+                //! The CUDA pow float specialization.
+                template<>
+                struct Pow<
+                    FastUniformCudaHipBuiltIn,
+                    float,
+                    float>
+                {
+                    __device__ static auto pow(
+                        FastUniformCudaHipBuiltIn const & pow_ctx,
+                        float const & base,
+                        float const & exp)
+                    -> float
+                    {
+                        alpaka::ignore_unused(pow_ctx);
+                        return ::__powf(base, exp);
+                    }
+                };
+                //#############################################################################
+                //! The CUDA rsqrt trait specialization.
+                template<
+                    typename TArg>
+                struct Rsqrt<
+                    FastUniformCudaHipBuiltIn,
+                    TArg,
+                    std::enable_if_t<
+                        std::is_floating_point<TArg>::value>>
+                {
+                    __device__ static auto rsqrt(
+                        FastUniformCudaHipBuiltIn const & rsqrt_ctx,
+                        TArg const & arg)
+                    {
+                        alpaka::ignore_unused(rsqrt_ctx);
+                        return ::rsqrt(arg);
+                    }
+                };
+                //! The CUDA rsqrt float specialization.
+                template<>
+                struct Rsqrt<
+                    FastUniformCudaHipBuiltIn,
+                    float>
+                {
+                    __device__ static auto rsqrt(
+                        FastUniformCudaHipBuiltIn const & rsqrt_ctx,
+                        float const & arg)
+                    -> float
+                    {
+                        alpaka::ignore_unused(rsqrt_ctx);
+                        return ::rsqrtf(arg);
+                    }
+                };
+            }
+        }
+    }
+}
+
+#endif
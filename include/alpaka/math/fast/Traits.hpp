@@ -0,0 +1,257 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Concepts.hpp>
+
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace math
+    {
+        //-----------------------------------------------------------------------------
+        //! The approximate math functions.
+        //!
+        //! They trade accuracy for speed at the call site instead of for the whole build.
+        //! The error bounds hold for float arguments. Other argument types are computed with the accurate functions.
+        //! On the CPU the float versions are branch free polynomials which the compiler can inline and vectorize.
+        //! Subnormal arguments and results may be flushed to zero.
+        //! On CUDA and HIP they map to the intrinsics (__expf, __logf, ...) with the error bounds documented there.
+        namespace fast
+        {
+            struct ConceptMathFast{};
+
+            namespace traits
+            {
+                //#############################################################################
+                //! The approximate exp trait.
+                template<
+                    typename T,
+                    typename TArg,
+                    typename TSfinae = void>
+                struct Exp;
+
+                //#############################################################################
+                //! The approximate log trait.
+                template<
+                    typename T,
+                    typename TArg,
+                    typename TSfinae = void>
+                struct Log;
+
+                //#############################################################################
+                //! The approximate sin trait.
+                template<
+                    typename T,
+                    typename TArg,
+                    typename TSfinae = void>
+                struct Sin;
+
+                //#############################################################################
+                //! The approximate cos trait.
+                template<
+                    typename T,
+                    typename TArg,
+                    typename TSfinae = void>
+                struct Cos;
+
+                //#############################################################################
+                //! The approximate pow trait.
+                template<
+                    typename T,
+                    typename TBase,
+                    typename TExp,
+                    typename TSfinae = void>
+                struct Pow;
+
+                //#############################################################################
+                //! The approximate rsqrt trait.
+                template<
+                    typename T,
+                    typename TArg,
+                    typename TSfinae = void>
+                struct Rsqrt;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of e raised to the given power arg.
+            //!
+            //! CPU float error: 1 ulp. Arguments above 88.72 give infinity, arguments below -103.97 give zero.
+            //!
+            //! \tparam T The type of the object specializing Exp.
+            //! \tparam TArg The arg type.
+            //! \param exp_ctx The object specializing Exp.
+            //! \param arg The arg.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TArg>
+            ALPAKA_FN_HOST_ACC auto exp(
+                T const & exp_ctx,
+                TArg const & arg)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Exp<
+                        ImplementationBase,
+                        TArg>
+                    ::exp(
+                        exp_ctx,
+                        arg);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of the natural logarithm of arg.
+            //!
+            //! CPU float error: 1 ulp. Subnormal arguments are treated as zero and give minus infinity.
+            //!
+            //! \tparam T The type of the object specializing Log.
+            //! \tparam TArg The arg type.
+            //! \param log_ctx The object specializing Log.
+            //! \param arg The arg.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TArg>
+            ALPAKA_FN_HOST_ACC auto log(
+                T const & log_ctx,
+                TArg const & arg)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Log<
+                        ImplementationBase,
+                        TArg>
+                    ::log(
+                        log_ctx,
+                        arg);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of the sine of arg (measured in radians).
+            //!
+            //! CPU float error: 2 ulp for |arg| <= pi, an absolute error of 2^-23 for |arg| <= 8192.
+            //! The error grows with the magnitude beyond that.
+            //!
+            //! \tparam T The type of the object specializing Sin.
+            //! \tparam TArg The arg type.
+            //! \param sin_ctx The object specializing Sin.
+            //! \param arg The arg.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TArg>
+            ALPAKA_FN_HOST_ACC auto sin(
+                T const & sin_ctx,
+                TArg const & arg)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Sin<
+                        ImplementationBase,
+                        TArg>
+                    ::sin(
+                        sin_ctx,
+                        arg);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of the cosine of arg (measured in radians).
+            //!
+            //! CPU float error: 2 ulp for |arg| <= pi, an absolute error of 2^-23 for |arg| <= 8192.
+            //! The error grows with the magnitude beyond that.
+            //!
+            //! \tparam T The type of the object specializing Cos.
+            //! \tparam TArg The arg type.
+            //! \param cos_ctx The object specializing Cos.
+            //! \param arg The arg.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TArg>
+            ALPAKA_FN_HOST_ACC auto cos(
+                T const & cos_ctx,
+                TArg const & arg)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Cos<
+                        ImplementationBase,
+                        TArg>
+                    ::cos(
+                        cos_ctx,
+                        arg);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of the value of base raised to the power exp as exp(exp * log(base)).
+            //!
+            //! It is only defined for positive bases.
+            //! CPU float error: 1 + 2 * |exp * log(base)| ulp, the error of log is magnified by the exponent.
+            //!
+            //! \tparam T The type of the object specializing Pow.
+            //! \tparam TBase The base type.
+            //! \tparam TExp The exponent type.
+            //! \param pow_ctx The object specializing Pow.
+            //! \param base The base.
+            //! \param exp The exponent.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TBase,
+                typename TExp>
+            ALPAKA_FN_HOST_ACC auto pow(
+                T const & pow_ctx,
+                TBase const & base,
+                TExp const & exp)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Pow<
+                        ImplementationBase,
+                        TBase,
+                        TExp>
+                    ::pow(
+                        pow_ctx,
+                        base,
+                        exp);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Computes an approximation of the reciprocal of the square root of arg.
+            //!
+            //! CPU float error: 3 ulp. Subnormal arguments are treated as zero and give infinity.
+            //!
+            //! \tparam T The type of the object specializing Rsqrt.
+            //! \tparam TArg The arg type.
+            //! \param rsqrt_ctx The object specializing Rsqrt.
+            //! \param arg The arg.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename T,
+                typename TArg>
+            ALPAKA_FN_HOST_ACC auto rsqrt(
+                T const & rsqrt_ctx,
+                TArg const & arg)
+            {
+                using ImplementationBase = concepts::ImplementationBase<ConceptMathFast, T>;
+                return
+                    traits::Rsqrt<
+                        ImplementationBase,
+                        TArg>
+                    ::rsqrt(
+                        rsqrt_ctx,
+                        arg);
+            }
+        }
+    }
+}
@@ -0,0 +1,392 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/alloc/Traits.hpp>
+#include <alpaka/mem/alloc/AllocCpuAligned.hpp>
+
+#include <alpaka/core/AlignedAlloc.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/core/WorkerPool.hpp>
+
+#if BOOST_OS_LINUX
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>
+#endif
+
+//! The minimal size in MiB of CPU buffers allocated on huge pages. Zero disables huge pages.
+#ifndef ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB
+    #define ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB 0
+#endif
+
+namespace alpaka
+{
+    //#############################################################################
+    //! The kind of pages backing an allocation.
+    enum class HugePageMode
+    {
+        None,           //!< Regular pages.
+        Transparent,    //!< Transparent huge pages requested via madvise(MADV_HUGEPAGE).
+        HugeTlb         //!< Huge pages reserved by the system (hugetlbfs) mapped via MAP_HUGETLB.
+    };
+
+    //#############################################################################
+    //! The configuration of the huge page allocator.
+    struct HugePageConfig
+    {
+        //! Allocations of at least this size are placed on huge pages. Zero disables huge pages.
+        std::size_t m_thresholdBytes = static_cast<std::size_t>(ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB) * 1024u * 1024u;
+#ifdef ALPAKA_CPU_HUGE_PAGE_HUGETLB_ENABLED
+        //! If the reserved huge pages should be tried first. Transparent huge pages are used if none are available.
+        bool m_bHugeTlb = true;
+#else
+        //! If the reserved huge pages should be tried first. Transparent huge pages are used if none are available.
+        bool m_bHugeTlb = false;
+#endif
+#ifdef ALPAKA_CPU_HUGE_PAGE_PREFAULT_ENABLED
+        //! If all pages should be touched in parallel directly after the allocation.
+        bool m_bPrefault = true;
+#else
+        //! If all pages should be touched in parallel directly after the allocation.
+        bool m_bPrefault = false;
+#endif
+    };
+
+    namespace detail
+    {
+        //#############################################################################
+        //! The configuration used by default constructed allocators.
+        struct HugePageConfigState
+        {
+            std::mutex m_mtx;
+            HugePageConfig m_config;
+        };
+
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST inline auto getHugePageConfigState()
+        -> HugePageConfigState &
+        {
+            static HugePageConfigState state;
+            return state;
+        }
+
+        //#############################################################################
+        //! The pages backing an allocation placed on huge pages.
+        struct HugePageAllocation
+        {
+            HugePageMode m_mode;
+            std::size_t m_mappedBytes;  //!< The size of the mapping if it has been mapped via MAP_HUGETLB.
+        };
+
+        //#############################################################################
+        //! The allocations placed on huge pages by any AllocCpuHugePage.
+        //!
+        //! The kind of memory has to be known when freeing it, so it is kept per allocation instead of within the allocator.
+        //! Only large allocations are registered, so the lock is not contended.
+        class HugePageAllocations final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getInstance()
+            -> HugePageAllocations &
+            {
+                static HugePageAllocations allocations;
+                return allocations;
+            }
+
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST auto insert(
+                void const * const ptr,
+                HugePageAllocation const & allocation)
+            -> void
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+                m_allocations.emplace(ptr, allocation);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Removes the allocation starting at ptr.
+            //!
+            //! \param allocation Set to the removed allocation.
+            //! \return If ptr is the start of a registered allocation.
+            ALPAKA_FN_HOST auto extract(
+                void const * const ptr,
+                HugePageAllocation & allocation)
+            -> bool
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+                auto const it(m_allocations.find(ptr));
+                if(it == m_allocations.end())
+                {
+                    return false;
+                }
+                allocation = it->second;
+                m_allocations.erase(it);
+                return true;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The kind of pages backing the allocation starting at ptr.
+            ALPAKA_FN_HOST auto getMode(
+                void const * const ptr)
+            -> HugePageMode
+            {
+                std::lock_guard<std::mutex> lock(m_mtx);
+                auto const it(m_allocations.find(ptr));
+                return (it == m_allocations.end()) ? HugePageMode::None : it->second.m_mode;
+            }
+
+        private:
+            std::mutex m_mtx;
+            std::unordered_map<void const *, HugePageAllocation> m_allocations;
+        };
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \return The configuration used by allocators constructed afterwards (e.g. by BufCpu).
+    //!
+    //! The defaults are given by the CMake options ALPAKA_CPU_HUGE_PAGE_THRESHOLD_MIB, ALPAKA_CPU_HUGE_PAGE_HUGETLB and ALPAKA_CPU_HUGE_PAGE_PREFAULT.
+    ALPAKA_FN_HOST inline auto getHugePageConfig()
+    -> HugePageConfig
+    {
+        auto & state(detail::getHugePageConfigState());
+        std::lock_guard<std::mutex> lock(state.m_mtx);
+        return state.m_config;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Sets the configuration used by allocators constructed afterwards (e.g. by BufCpu).
+    //!
+    //! Allocators which already exist and the allocations made by them are not affected.
+    ALPAKA_FN_HOST inline auto setHugePageConfig(
+        HugePageConfig const & config)
+    -> void
+    {
+        auto & state(detail::getHugePageConfigState());
+        std::lock_guard<std::mutex> lock(state.m_mtx);
+        state.m_config = config;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \return The kind of pages backing the allocation starting at ptr if it has been allocated by an AllocCpuHugePage.
+    ALPAKA_FN_HOST inline auto getHugePageMode(
+        void const * const ptr)
+    -> HugePageMode
+    {
+        return detail::HugePageAllocations::getInstance().getMode(ptr);
+    }
+
+    namespace detail
+    {
+        //! The size of a huge page on x86-64 and the alignment of all huge page allocations.
+        constexpr std::size_t hugePageSize = 2u * 1024u * 1024u;
+        //! Allocations of at least this size per thread are prefaulted by multiple threads.
+        constexpr std::size_t minPrefaultBytesPerThread = 64u * 1024u * 1024u;
+
+        //-----------------------------------------------------------------------------
+        //! \return The size of the regular pages.
+        ALPAKA_FN_HOST inline auto getPageSize()
+        -> std::size_t
+        {
+#if BOOST_OS_LINUX
+            static long const pageSize(::sysconf(_SC_PAGESIZE));
+            if(pageSize > 0)
+            {
+                return static_cast<std::size_t>(pageSize);
+            }
+#endif
+            return 4096u;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Touches every page of the given memory to avoid the page faults at the first access.
+        ALPAKA_FN_HOST inline auto prefaultPages(
+            void * const ptr,
+            std::size_t const sizeBytes,
+            std::size_t const pageSize)
+        -> void
+        {
+            auto const touch(
+                [ptr, pageSize](std::size_t first, std::size_t const last)
+                {
+                    for(; first < last; first += pageSize)
+                    {
+                        static_cast<char volatile *>(ptr)[first] = 0;
+                    }
+                });
+
+            std::size_t const pageCount((sizeBytes + pageSize - 1u) / pageSize);
+            auto & workerPool(core::detail::WorkerPool::getInstance());
+            std::size_t const workerCount(
+                std::max(
+                    std::min(
+                        workerPool.getWorkerCount(),
+                        sizeBytes / minPrefaultBytesPerThread),
+                    static_cast<std::size_t>(1u)));
+            std::size_t const chunkBytes(((pageCount + workerCount - 1u) / workerCount) * pageSize);
+
+            workerPool.run(
+                workerCount,
+                [&](std::size_t const workerIdx) noexcept
+                {
+                    std::size_t const first(std::min(workerIdx * chunkBytes, sizeBytes));
+                    touch(first, std::min(first + chunkBytes, sizeBytes));
+                });
+        }
+    }
+
+    //#############################################################################
+    //! The CPU huge page allocator.
+    //!
+    //! Allocations of at least the configured threshold are aligned to 2 MiB and placed on huge pages which reduces DTLB misses.
+    //! Smaller ones are delegated to AllocCpuAligned.
+    //! The allocator itself is stateless apart from its configuration. The kind of pages backing each large allocation is kept in a global registry
+    //! so that the memory can be freed by any instance and allocations from multiple threads do not interfere.
+    //!
+    //! \tparam TAlignment An integral constant containing the alignment of the small allocations.
+    template<
+        typename TAlignment>
+    class AllocCpuHugePage : public concepts::Implements<ConceptMemAlloc, AllocCpuHugePage<TAlignment>>
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        explicit AllocCpuHugePage(
+            HugePageConfig const & config = getHugePageConfig()) :
+                m_config(config)
+        {}
+
+    public:
+        HugePageConfig const m_config;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CPU huge page allocator memory allocation trait specialization.
+        template<
+            typename T,
+            typename TAlignment>
+        struct Malloc<
+            T,
+            AllocCpuHugePage<TAlignment>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto malloc(
+                AllocCpuHugePage<TAlignment> const & alloc,
+                std::size_t const & sizeElems)
+            -> T *
+            {
+                std::size_t const sizeBytes(sizeElems * sizeof(T));
+
+                if((alloc.m_config.m_thresholdBytes == 0u) || (sizeBytes < alloc.m_config.m_thresholdBytes))
+                {
+                    return alpaka::malloc<T>(AllocCpuAligned<TAlignment>(), sizeElems);
+                }
+
+                // Huge pages can only be used completely.
+                std::size_t const sizeBytesHuge(((sizeBytes + detail::hugePageSize - 1u) / detail::hugePageSize) * detail::hugePageSize);
+                void * ptr(nullptr);
+                detail::HugePageAllocation allocation{HugePageMode::None, 0u};
+
+#if BOOST_OS_LINUX && defined(MAP_HUGETLB)
+                if(alloc.m_config.m_bHugeTlb)
+                {
+                    void * const pMapped(::mmap(nullptr, sizeBytesHuge, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0));
+                    if(pMapped != MAP_FAILED)
+                    {
+                        ptr = pMapped;
+                        allocation.m_mode = HugePageMode::HugeTlb;
+                        allocation.m_mappedBytes = sizeBytesHuge;
+                    }
+                }
+#endif
+                if(ptr == nullptr)
+                {
+                    ptr = core::alignedAlloc(std::max(TAlignment::value, detail::hugePageSize), sizeBytesHuge);
+                    if(ptr == nullptr)
+                    {
+                        return nullptr;
+                    }
+#if BOOST_OS_LINUX && defined(MADV_HUGEPAGE)
+                    // This fails if transparent huge pages are disabled in the kernel.
+                    if(::madvise(ptr, sizeBytesHuge, MADV_HUGEPAGE) == 0)
+                    {
+                        allocation.m_mode = HugePageMode::Transparent;
+                    }
+#endif
+                }
+
+                if(alloc.m_config.m_bPrefault)
+                {
+                    // The kernel may fall back to regular pages for transparent huge pages, so each regular page is touched.
+                    detail::prefaultPages(
+                        ptr,
+                        sizeBytesHuge,
+                        (allocation.m_mode == HugePageMode::HugeTlb) ? detail::hugePageSize : detail::getPageSize());
+                }
+
+                detail::HugePageAllocations::getInstance().insert(ptr, allocation);
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                std::cout << __func__
+                    << " size: " << sizeBytesHuge
+                    << " mode: " << ((allocation.m_mode == HugePageMode::HugeTlb) ? "hugetlb" : ((allocation.m_mode == HugePageMode::Transparent) ? "transparent" : "none"))
+                    << std::endl;
+#endif
+                return static_cast<T *>(ptr);
+            }
+        };
+
+        //#############################################################################
+        //! The CPU huge page allocator memory free trait specialization.
+        template<
+            typename T,
+            typename TAlignment>
+        struct Free<
+            T,
+            AllocCpuHugePage<TAlignment>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto free(
+                AllocCpuHugePage<TAlignment> const & alloc,
+                T const * const ptr)
+            -> void
+            {
+                alpaka::ignore_unused(alloc);
+
+                // Small allocations are not registered and have been made by AllocCpuAligned which uses the same deallocation.
+                detail::HugePageAllocation allocation{HugePageMode::None, 0u};
+                if((ptr != nullptr) && detail::HugePageAllocations::getInstance().extract(ptr, allocation))
+                {
+#if BOOST_OS_LINUX && defined(MAP_HUGETLB)
+                    if(allocation.m_mode == HugePageMode::HugeTlb)
+                    {
+                        ::munmap(const_cast<void *>(static_cast<void const *>(ptr)), allocation.m_mappedBytes);
+                        return;
+                    }
+#endif
+                }
+                core::alignedFree(
+                    const_cast<void *>(
+                        static_cast<void const *>(ptr)));
+            }
+        };
+    }
+}
@@ -25,7 +25,7 @@
     #include <alpaka/core/Hip.hpp>
 #endif
 
-#include <alpaka/mem/alloc/AllocCpuAligned.hpp>
+#include <alpaka/mem/alloc/AllocCpuHugePage.hpp>
 
 #include <alpaka/meta/DependentFalseType.hpp>
 
@@ -38,12 +38,14 @@ namespace alpaka
     {
         //#############################################################################
         //! The CPU memory buffer.
+        //!
+        //! Large buffers are placed on huge pages according to getHugePageConfig().
         template<
             typename TElem,
             typename TDim,
             typename TIdx>
         class BufCpuImpl final :
-            public AllocCpuAligned<std::integral_constant<std::size_t, core::vectorization::defaultAlignment>>
+            public AllocCpuHugePage<std::integral_constant<std::size_t, core::vectorization::defaultAlignment>>
         {
             static_assert(
                 !std::is_const<TElem>::value,
@@ -58,7 +60,7 @@ namespace alpaka
             ALPAKA_FN_HOST BufCpuImpl(
                 DevCpu const & dev,
                 TExtent const & extent) :
-                    AllocCpuAligned<std::integral_constant<std::size_t, core::vectorization::defaultAlignment>>(),
+                    AllocCpuHugePage<std::integral_constant<std::size_t, core::vectorization::defaultAlignment>>(),
                     m_dev(dev),
                     m_extentElements(extent::getExtentVecEnd<TDim>(extent)),
                     m_pMem(alpaka::malloc<TElem>(*this, static_cast<std::size_t>(computeElementCount(extent)))),
@@ -81,6 +83,7 @@ namespace alpaka
                     << " e: " << m_extentElements
                     << " ptr: " << static_cast<void *>(m_pMem)
                     << " pitch: " << m_pitchBytes
+                    << " huge pages: " << static_cast<int>(alpaka::getHugePageMode(m_pMem))
                     << std::endl;
 #endif
             }
@@ -162,6 +165,19 @@ namespace alpaka
         std::shared_ptr<detail::BufCpuImpl<TElem, TDim, TIdx>> m_spBufCpuImpl;
     };
 
+    //-----------------------------------------------------------------------------
+    //! \return The kind of pages backing the memory of the given buffer.
+    template<
+        typename TElem,
+        typename TDim,
+        typename TIdx>
+    ALPAKA_FN_HOST auto getHugePageMode(
+        BufCpu<TElem, TDim, TIdx> const & buf)
+    -> HugePageMode
+    {
+        return getHugePageMode(static_cast<void const *>(buf.m_spBufCpuImpl->m_pMem));
+    }
+
     namespace traits
     {
         //#############################################################################
@@ -607,4 +623,6 @@ namespace alpaka
 }
 
 #include <alpaka/mem/buf/cpu/Copy.hpp>
+#include <alpaka/mem/buf/cpu/CopyBatch.hpp>
 #include <alpaka/mem/buf/cpu/Set.hpp>
+#include <alpaka/mem/buf/cpu/Fill.hpp>
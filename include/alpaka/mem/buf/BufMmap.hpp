@@ -0,0 +1,70 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if BOOST_OS_UNIX || BOOST_OS_MACOS
+
+#include <alpaka/mem/view/ViewMmap.hpp>
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dim/Traits.hpp>
+
+#include <string>
+
+namespace alpaka
+{
+    //#############################################################################
+    //! The memory buffer backed by a memory mapped file.
+    //!
+    //! In contrast to a plain ViewMmap, the file backing the buffer is created with exactly the size required.
+    template<
+        typename TElem,
+        typename TDim,
+        typename TIdx>
+    using BufMmap = view::ViewMmap<TElem, TDim, TIdx>;
+
+    //-----------------------------------------------------------------------------
+    //! Allocates a buffer backed by a memory mapped file.
+    //!
+    //! The file is created or truncated. All writes to the buffer are written back to the file.
+    //!
+    //! \tparam TElem The element type of the returned buffer.
+    //! \tparam TIdx The linear index type of the buffer.
+    //! \tparam TExtent The extent type of the buffer.
+    //! \param dev The device to allocate the buffer on.
+    //! \param fileName The name of the file backing the buffer.
+    //! \param extent The extent of the buffer.
+    //! \return The newly allocated buffer.
+    template<
+        typename TElem,
+        typename TIdx,
+        typename TExtent>
+    ALPAKA_FN_HOST auto allocBufMmap(
+        DevCpu const & dev,
+        std::string const & fileName,
+        TExtent const & extent,
+        view::MmapAdvice const advice = view::MmapAdvice::Normal)
+    -> BufMmap<TElem, Dim<TExtent>, TIdx>
+    {
+        return
+            BufMmap<TElem, Dim<TExtent>, TIdx>(
+                dev,
+                fileName,
+                extent,
+                view::MmapSharing::Shared,
+                advice,
+                0u,
+                true);
+    }
+}
+
+#endif
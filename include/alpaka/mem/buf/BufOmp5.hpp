@@ -653,6 +653,8 @@ namespace alpaka
 }
 
 #include <alpaka/mem/buf/omp5/Copy.hpp>
+#include <alpaka/mem/buf/omp5/CopyBatch.hpp>
 #include <alpaka/mem/buf/omp5/Set.hpp>
+#include <alpaka/mem/buf/omp5/Fill.hpp>
 
 #endif
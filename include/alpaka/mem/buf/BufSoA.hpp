@@ -0,0 +1,631 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/view/AccessorSoA.hpp>
+#include <alpaka/mem/view/Accessor.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/meta/Metafunctions.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Debug.hpp>
+#include <alpaka/core/Vectorize.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace soa
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! \return The size of the member types of a record of pointers.
+            struct GetMemberSizes
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST auto operator()(
+                    TPtrs const & ...) const
+                -> std::array<std::size_t, sizeof...(TPtrs)>
+                {
+                    static_assert(
+                        meta::Conjunction<std::integral_constant<bool, (alignof(std::remove_pointer_t<TPtrs>) <= core::vectorization::defaultAlignment)>...>::value,
+                        "The alignment of the record members must not exceed the default alignment!");
+
+                    return {{sizeof(std::remove_pointer_t<TPtrs>)...}};
+                }
+            };
+
+            //#############################################################################
+            //! Creates a record of pointers to the member arrays located at the given byte offsets.
+            template<
+                typename TRecord>
+            struct MakeRecordFromBytes
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST auto operator()(
+                    TPtrs const & ...) const
+                -> TRecord
+                {
+                    std::size_t i(0u);
+                    // The initializer clauses of a braced-init-list are evaluated in order.
+                    return TRecord{static_cast<TPtrs>(static_cast<void *>(m_pBytes + m_pOffsets[i++]))...};
+                }
+
+                std::uint8_t * m_pBytes;
+                std::size_t const * m_pOffsets;
+            };
+
+            //#############################################################################
+            //! \return The untyped pointers to the member arrays of a record of pointers.
+            struct GetMemberBytes
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST auto operator()(
+                    TPtrs const & ... ptrs) const
+                -> std::array<void *, sizeof...(TPtrs)>
+                {
+                    return {{static_cast<void *>(ptrs)...}};
+                }
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The size of the member arrays rounded up to the default alignment.
+            template<
+                std::size_t TMemberCount>
+            ALPAKA_FN_HOST auto getMemberArrayBytes(
+                std::array<std::size_t, TMemberCount> const & memberSizes,
+                std::size_t const elemCount)
+            -> std::array<std::size_t, TMemberCount>
+            {
+                constexpr std::size_t alignment(core::vectorization::defaultAlignment);
+                std::array<std::size_t, TMemberCount> arrayBytes;
+                for(std::size_t i(0u); i < TMemberCount; ++i)
+                {
+                    arrayBytes[i] = ((memberSizes[i] * elemCount + alignment - 1u) / alignment) * alignment;
+                }
+                return arrayBytes;
+            }
+        }
+    }
+
+    //#############################################################################
+    //! A structure-of-arrays buffer.
+    //!
+    //! Each member of the record is stored in its own array aligned to core::vectorization::defaultAlignment.
+    //! All arrays are allocated in a single buffer so copying the whole container between devices is a single copy.
+    //! Kernels access the elements through view::getAccessor(buf) which returns a view::AccessorSoA.
+    //!
+    //! \tparam TRecord The record class template declaring its members with ALPAKA_SOA_MEMBERS.
+    template<
+        typename TDev,
+        template<template<typename> class> class TRecord,
+        typename TIdx>
+    class BufSoA
+    {
+    public:
+        //! The record of pointers to the member arrays.
+        using Pointers = TRecord<soa::Ptr>;
+        //! The buffer storing the member arrays one after another.
+        using Storage = Buf<TDev, std::uint8_t, DimInt<1u>, TIdx>;
+
+        //-----------------------------------------------------------------------------
+        //! \param extent The number of elements.
+        ALPAKA_FN_HOST BufSoA(
+            TDev const & dev,
+            TIdx const & extent) :
+                m_extent(extent),
+                m_storage(
+                    allocBuf<std::uint8_t, TIdx>(
+                        dev,
+                        static_cast<TIdx>(getStorageBytes(extent)))),
+                m_ptrs(createPointers(view::getPtrNative(m_storage), extent))
+        {}
+
+        //-----------------------------------------------------------------------------
+        //! \return The buffer storing the member arrays.
+        ALPAKA_FN_HOST auto getStorage()
+        -> Storage &
+        {
+            return m_storage;
+        }
+        //-----------------------------------------------------------------------------
+        //! \return The buffer storing the member arrays.
+        ALPAKA_FN_HOST auto getStorage() const
+        -> Storage const &
+        {
+            return m_storage;
+        }
+
+    private:
+        //-----------------------------------------------------------------------------
+        //! \return The number of bytes required to store the member arrays.
+        ALPAKA_FN_HOST static auto getStorageBytes(
+            TIdx const & extent)
+        -> std::size_t
+        {
+            auto const arrayBytes(
+                soa::detail::getMemberArrayBytes(
+                    Pointers{}.applyToMembers(soa::detail::GetMemberSizes()),
+                    static_cast<std::size_t>(extent)));
+            std::size_t storageBytes(0u);
+            for(auto const & bytes : arrayBytes)
+            {
+                storageBytes += bytes;
+            }
+            return storageBytes;
+        }
+        //-----------------------------------------------------------------------------
+        //! \return The pointers to the member arrays stored one after another.
+        ALPAKA_FN_HOST static auto createPointers(
+            std::uint8_t * pBytes,
+            TIdx const & extent)
+        -> Pointers
+        {
+            auto offsets(
+                soa::detail::getMemberArrayBytes(
+                    Pointers{}.applyToMembers(soa::detail::GetMemberSizes()),
+                    static_cast<std::size_t>(extent)));
+            std::size_t offset(0u);
+            for(auto & arrayOffset : offsets)
+            {
+                auto const bytes(arrayOffset);
+                arrayOffset = offset;
+                offset += bytes;
+            }
+            return Pointers{}.applyToMembers(soa::detail::MakeRecordFromBytes<Pointers>{pBytes, offsets.data()});
+        }
+
+    public:
+        TIdx m_extent;
+        Storage m_storage;
+        Pointers m_ptrs;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Allocates a structure-of-arrays buffer on the given device.
+    //!
+    //! \tparam TRecord The record class template declaring its members with ALPAKA_SOA_MEMBERS.
+    //! \tparam TIdx The linear index type of the buffer.
+    //! \param dev The device to allocate the buffer on.
+    //! \param extent The number of elements.
+    template<
+        template<template<typename> class> class TRecord,
+        typename TIdx,
+        typename TDev>
+    ALPAKA_FN_HOST auto allocBufSoA(
+        TDev const & dev,
+        TIdx const & extent)
+    -> BufSoA<TDev, TRecord, TIdx>
+    {
+        return BufSoA<TDev, TRecord, TIdx>(dev, extent);
+    }
+
+    namespace view
+    {
+        //#############################################################################
+        //! A sub-view of a structure-of-arrays buffer.
+        //!
+        //! The sub-view does not own the memory. The parent buffer has to outlive it.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        class ViewSubViewSoA
+        {
+        public:
+            using Pointers = TRecord<soa::Ptr>;
+
+            //-----------------------------------------------------------------------------
+            //! \param view The BufSoA or ViewSubViewSoA this view is a sub-view of.
+            //! \param extent The number of elements of the sub-view.
+            //! \param relativeOffset The index of the first element of the sub-view within the parent view.
+            template<
+                typename TView>
+            ALPAKA_FN_HOST ViewSubViewSoA(
+                TView const & view,
+                TIdx const & extent,
+                TIdx const & relativeOffset = static_cast<TIdx>(0u)) :
+                    m_dev(alpaka::getDev(view)),
+                    m_extent(extent),
+                    m_ptrs(view.m_ptrs.applyToMembers(soa::detail::MakeRecordOffset<Pointers, TIdx>{relativeOffset}))
+            {
+                ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+                ALPAKA_ASSERT(relativeOffset + extent <= extent::getWidth(view));
+            }
+
+        public:
+            TDev m_dev;
+            TIdx m_extent;
+            Pointers m_ptrs;
+        };
+
+        namespace detail
+        {
+            //#############################################################################
+            //! The host memory copy task between structure-of-arrays views.
+            //!
+            //! Copies each member array separately.
+            template<
+                std::size_t TMemberCount>
+            struct TaskCopySoACpu
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()() const
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    for(std::size_t i(0u); i < TMemberCount; ++i)
+                    {
+                        if(m_memberSizes[i] * m_extent != 0u)
+                        {
+                            std::memcpy(m_dstMembers[i], m_srcMembers[i], m_memberSizes[i] * m_extent);
+                        }
+                    }
+                }
+
+                std::array<void *, TMemberCount> m_dstMembers;
+                std::array<void *, TMemberCount> m_srcMembers;
+                std::array<std::size_t, TMemberCount> m_memberSizes;
+                std::size_t m_extent;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The host task copying between the structure-of-arrays views member by member.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TExtent>
+            ALPAKA_FN_HOST auto createTaskCopySoACpu(
+                TViewDst & viewDst,
+                TViewSrc const & viewSrc,
+                TExtent const & extent)
+            {
+                static_assert(
+                    std::is_same<alpaka::Dev<TViewDst>, DevCpu>::value && std::is_same<alpaka::Dev<TViewSrc>, DevCpu>::value,
+                    "Copies between structure-of-arrays sub-views are only supported between CPU views!");
+
+                auto const width(extent::getWidth(extent));
+                if((width > extent::getWidth(viewDst)) || (width > extent::getWidth(viewSrc)))
+                {
+                    throw std::runtime_error("The extent of the copy exceeds the extent of the views!");
+                }
+
+                auto const memberSizes(viewDst.m_ptrs.applyToMembers(soa::detail::GetMemberSizes()));
+                return
+                    TaskCopySoACpu<std::tuple_size<std::decay_t<decltype(memberSizes)>>::value>{
+                        viewDst.m_ptrs.applyToMembers(soa::detail::GetMemberBytes()),
+                        viewSrc.m_ptrs.applyToMembers(soa::detail::GetMemberBytes()),
+                        memberSizes,
+                        static_cast<std::size_t>(width)};
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Trait specializations for BufSoA and ViewSubViewSoA.
+    namespace traits
+    {
+        //#############################################################################
+        //! The BufSoA device type trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct DevType<
+            BufSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TDev;
+        };
+        //#############################################################################
+        //! The ViewSubViewSoA device type trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct DevType<
+            view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TDev;
+        };
+
+        //#############################################################################
+        //! The BufSoA device get trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct GetDev<
+            BufSoA<TDev, TRecord, TIdx>>
+        {
+            ALPAKA_FN_HOST static auto getDev(
+                BufSoA<TDev, TRecord, TIdx> const & buf)
+            -> TDev
+            {
+                return alpaka::getDev(buf.getStorage());
+            }
+        };
+        //#############################################################################
+        //! The ViewSubViewSoA device get trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct GetDev<
+            view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+        {
+            ALPAKA_FN_HOST static auto getDev(
+                view::ViewSubViewSoA<TDev, TRecord, TIdx> const & view)
+            -> TDev
+            {
+                return view.m_dev;
+            }
+        };
+
+        //#############################################################################
+        //! The BufSoA dimension getter trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct DimType<
+            BufSoA<TDev, TRecord, TIdx>>
+        {
+            using type = DimInt<1u>;
+        };
+        //#############################################################################
+        //! The ViewSubViewSoA dimension getter trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct DimType<
+            view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+        {
+            using type = DimInt<1u>;
+        };
+
+        //#############################################################################
+        //! The BufSoA memory element type get trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct ElemType<
+            BufSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TRecord<soa::Value>;
+        };
+        //#############################################################################
+        //! The ViewSubViewSoA memory element type get trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct ElemType<
+            view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TRecord<soa::Value>;
+        };
+
+        //#############################################################################
+        //! The BufSoA idx type trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct IdxType<
+            BufSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TIdx;
+        };
+        //#############################################################################
+        //! The ViewSubViewSoA idx type trait specialization.
+        template<
+            typename TDev,
+            template<template<typename> class> class TRecord,
+            typename TIdx>
+        struct IdxType<
+            view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+    namespace extent
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The BufSoA extent get trait specialization.
+            template<
+                typename TDev,
+                template<template<typename> class> class TRecord,
+                typename TIdx>
+            struct GetExtent<
+                DimInt<0u>,
+                BufSoA<TDev, TRecord, TIdx>>
+            {
+                ALPAKA_FN_HOST static auto getExtent(
+                    BufSoA<TDev, TRecord, TIdx> const & buf)
+                -> TIdx
+                {
+                    return buf.m_extent;
+                }
+            };
+            //#############################################################################
+            //! The ViewSubViewSoA extent get trait specialization.
+            template<
+                typename TDev,
+                template<template<typename> class> class TRecord,
+                typename TIdx>
+            struct GetExtent<
+                DimInt<0u>,
+                view::ViewSubViewSoA<TDev, TRecord, TIdx>>
+            {
+                ALPAKA_FN_HOST static auto getExtent(
+                    view::ViewSubViewSoA<TDev, TRecord, TIdx> const & view)
+                -> TIdx
+                {
+                    return view.m_extent;
+                }
+            };
+        }
+    }
+    namespace view
+    {
+        namespace traits
+        {
+            namespace detail
+            {
+                //#############################################################################
+                //! The accessor get trait implementation for structure-of-arrays views.
+                template<
+                    template<template<typename> class> class TRecord,
+                    typename TIdx>
+                struct GetAccessorSoA
+                {
+                    //-----------------------------------------------------------------------------
+                    //! \return A read-only accessor for const views.
+                    template<
+                        typename TViewQualified>
+                    ALPAKA_FN_HOST static auto getAccessor(
+                        TViewQualified & view)
+                    {
+                        using AccessorType = AccessorSoA<TRecord, TIdx, std::is_const<TViewQualified>::value>;
+
+                        return
+                            AccessorType(
+                                view.m_ptrs.applyToMembers(soa::detail::MakeRecord<typename AccessorType::Pointers>()),
+                                extent::getWidth(view));
+                    }
+                };
+            }
+
+            //#############################################################################
+            //! The BufSoA accessor get trait specialization.
+            template<
+                typename TDev,
+                template<template<typename> class> class TRecord,
+                typename TIdx>
+            struct GetAccessor<
+                BufSoA<TDev, TRecord, TIdx>> : detail::GetAccessorSoA<TRecord, TIdx>
+            {};
+            //#############################################################################
+            //! The ViewSubViewSoA accessor get trait specialization.
+            template<
+                typename TDev,
+                template<template<typename> class> class TRecord,
+                typename TIdx>
+            struct GetAccessor<
+                view::ViewSubViewSoA<TDev, TRecord, TIdx>> : detail::GetAccessorSoA<TRecord, TIdx>
+            {};
+
+            //#############################################################################
+            //! The copy trait specialization between whole BufSoAs.
+            //!
+            //! The storage is copied as a whole so this is supported between all devices.
+            template<
+                typename TDevDst,
+                template<template<typename> class> class TRecord,
+                typename TIdx,
+                typename TDevSrc>
+            struct CreateTaskCopyViews<
+                BufSoA<TDevDst, TRecord, TIdx>,
+                BufSoA<TDevSrc, TRecord, TIdx>>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    BufSoA<TDevDst, TRecord, TIdx> & bufDst,
+                    BufSoA<TDevSrc, TRecord, TIdx> const & bufSrc,
+                    TExtent const & extent)
+                {
+                    auto const width(extent::getWidth(extent));
+                    if((width != bufDst.m_extent) || (width != bufSrc.m_extent))
+                    {
+                        throw std::runtime_error("Copies between structure-of-arrays buffers have to copy the whole buffers! Use sub-views to copy parts of them.");
+                    }
+
+                    return
+                        view::createTaskCopy(
+                            bufDst.getStorage(),
+                            bufSrc.getStorage(),
+                            extent::getExtentVec(bufSrc.getStorage()));
+                }
+            };
+
+            //#############################################################################
+            //! The copy trait specialization into a ViewSubViewSoA.
+            template<
+                typename TDevDst,
+                template<template<typename> class> class TRecord,
+                typename TIdx,
+                typename TViewSrc>
+            struct CreateTaskCopyViews<
+                view::ViewSubViewSoA<TDevDst, TRecord, TIdx>,
+                TViewSrc>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    view::ViewSubViewSoA<TDevDst, TRecord, TIdx> & viewDst,
+                    TViewSrc const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return view::detail::createTaskCopySoACpu(viewDst, viewSrc, extent);
+                }
+            };
+            //#############################################################################
+            //! The copy trait specialization from a ViewSubViewSoA into a BufSoA.
+            template<
+                typename TDevDst,
+                template<template<typename> class> class TRecord,
+                typename TIdx,
+                typename TDevSrc>
+            struct CreateTaskCopyViews<
+                BufSoA<TDevDst, TRecord, TIdx>,
+                view::ViewSubViewSoA<TDevSrc, TRecord, TIdx>>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    BufSoA<TDevDst, TRecord, TIdx> & bufDst,
+                    view::ViewSubViewSoA<TDevSrc, TRecord, TIdx> const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return view::detail::createTaskCopySoACpu(bufDst, viewSrc, extent);
+                }
+            };
+        }
+    }
+}
@@ -758,6 +758,8 @@ namespace alpaka
 }
 
 #include <alpaka/mem/buf/uniformCudaHip/Copy.hpp>
+#include <alpaka/mem/buf/uniformCudaHip/CopyBatch.hpp>
 #include <alpaka/mem/buf/uniformCudaHip/Set.hpp>
+#include <alpaka/mem/buf/uniformCudaHip/Fill.hpp>
 
 #endif
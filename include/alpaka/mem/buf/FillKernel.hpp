@@ -0,0 +1,137 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/buf/SetKernel.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/idx/Accessors.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/meta/Fold.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! The unit of the vector stores of the MemFillKernel.
+            struct alignas(16) MemFillChunk
+            {
+                std::uint8_t m_bytes[16];
+            };
+        }
+
+        //#############################################################################
+        //! any device ND memory fill kernel.
+        //!
+        //! In contrast to the MemSetKernel the value is a whole element.
+        //! Elements which evenly divide 16 bytes are stored as aligned vectors of 16 bytes.
+        class MemFillKernel
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! \return The number of elements in the last dimension each thread should fill.
+            //!
+            //! Each thread stores multiple vectors to amortize its index calculations.
+            template<
+                typename TElem>
+            static constexpr auto getElemsPerThread()
+            -> std::size_t
+            {
+                return std::max(static_cast<std::size_t>(4u), (4u * sizeof(detail::MemFillChunk)) / sizeof(TElem));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! The kernel entry point.
+            //!
+            //! All but the last element of threadElemExtent must be one.
+            //!
+            //! \tparam TAcc The accelerator environment to be executed on.
+            //! \tparam TElem The element type.
+            //! \tparam TExtent extent type.
+            //! \param acc The accelerator to be executed on.
+            //! \param val value to set.
+            //! \param dst target mem ptr.
+            //! \param extent area to fill in elements.
+            //! \param pitch pitches of the target memory in bytes.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TAcc,
+                typename TElem,
+                typename TExtent,
+                typename TPitch>
+            ALPAKA_FN_ACC auto operator()(
+                TAcc const & acc,
+                TElem const val,
+                TElem * dst,
+                TExtent extent,
+                TPitch pitch) const
+            -> void
+            {
+                using Idx = typename alpaka::traits::IdxType<TExtent>::type;
+                auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+                auto const threadElemExtent(alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(acc));
+                auto idxThreadFirstElem = getIdxThreadFirstElem(acc, gridThreadIdx, threadElemExtent);
+                constexpr auto lastDim = Dim<TAcc>::value - 1;
+
+                if( (idxThreadFirstElem < extent).foldrAll(std::logical_and<bool>()) )
+                {
+                    auto const idxFirst(idxThreadFirstElem[lastDim]);
+                    auto const idxLast(idxFirst + std::min(threadElemExtent[lastDim], static_cast<Idx>(extent[lastDim] - idxFirst)));
+
+                    // The byte offset of the row this thread works on.
+                    idxThreadFirstElem[lastDim] = static_cast<Idx>(0u);
+                    auto const rowOffsetBytes(mapIdxPitchBytes<1u, Dim<TAcc>::value>(idxThreadFirstElem, pitch)[0]);
+                    TElem * const row(
+                        static_cast<TElem *>(
+                            static_cast<void *>(
+                                static_cast<std::uint8_t *>(static_cast<void *>(dst)) + rowOffsetBytes)));
+
+                    auto idx(idxFirst);
+                    constexpr auto chunkSize(sizeof(detail::MemFillChunk));
+                    if((chunkSize % sizeof(TElem)) == 0u)
+                    {
+                        // Prologue: single elements until the destination is aligned to the vector size.
+                        for(; (idx < idxLast) && ((reinterpret_cast<std::uintptr_t>(row + idx) % chunkSize) != 0u); ++idx)
+                        {
+                            row[idx] = val;
+                        }
+
+                        // Each vector starts at an element boundary so the pattern is the same for all of them.
+                        detail::MemFillChunk chunk;
+                        for(std::size_t i(0u); i < chunkSize; i += sizeof(TElem))
+                        {
+                            std::memcpy(chunk.m_bytes + i, &val, sizeof(TElem));
+                        }
+
+                        constexpr auto elemsPerChunk(static_cast<Idx>(chunkSize / sizeof(TElem)));
+                        for(; idx + elemsPerChunk <= idxLast; idx += elemsPerChunk)
+                        {
+                            detail::storeAligned(row + idx, chunk);
+                        }
+                    }
+
+                    // Epilogue: the remaining elements.
+                    for(; idx < idxLast; ++idx)
+                    {
+                        row[idx] = val;
+                    }
+                }
+            }
+        };
+    }
+}
@@ -14,11 +14,38 @@
 #include <alpaka/idx/Accessors.hpp>
 #include <alpaka/idx/MapIdx.hpp>
 #include <alpaka/meta/Fold.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+
+#include <cstdint>
+#include <cstring>
 
 namespace alpaka
 {
     namespace view
     {
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! Stores the given word at pDst which has to be aligned to the alignment of TWord.
+            //!
+            //! The memory may hold elements of any type so the word is copied instead of being stored through a TWord pointer.
+            //! With the alignment known the copy is compiled into a single store.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TWord>
+            ALPAKA_FN_HOST_ACC auto storeAligned(
+                void * const pDst,
+                TWord const & word)
+            -> void
+            {
+#if (BOOST_COMP_GNUC || BOOST_COMP_CLANG) && !BOOST_COMP_NVCC
+                std::memcpy(__builtin_assume_aligned(pDst, alignof(TWord)), &word, sizeof(TWord));
+#else
+                std::memcpy(pDst, &word, sizeof(TWord));
+#endif
+            }
+        }
+
         //#############################################################################
         //! any device ND memory set kernel.
         class MemSetKernel
@@ -59,6 +86,23 @@ namespace alpaka
 
                 if( (idxThreadFirstElem < extent).foldrAll(std::logical_and<bool>()) )
                 {
+                    // Store whole words instead of single bytes where the destination is aligned.
+                    using Word = std::uint32_t;
+                    constexpr auto wordSize(static_cast<Idx>(sizeof(Word)));
+
+                    // Prologue: single bytes until the destination is aligned to the word size.
+                    for(; (idx<lastIdx) && ((reinterpret_cast<std::uintptr_t>(dst + idx) % sizeof(Word)) != 0u); ++idx)
+                    {
+                        *(dst + idx) = val;
+                    }
+
+                    Word const word(static_cast<Word>(val) * 0x01010101u);
+                    for(; idx + wordSize <= lastIdx; idx += wordSize)
+                    {
+                        detail::storeAligned(dst + idx, word);
+                    }
+
+                    // Epilogue: the remaining bytes.
                     for(; idx<lastIdx; ++idx)
                     {
                         *(dst + idx) = val;
@@ -12,9 +12,11 @@
 #include <alpaka/core/Assert.hpp>
 #include <alpaka/dim/DimIntegralConst.hpp>
 #include <alpaka/extent/Traits.hpp>
+#include <alpaka/mem/buf/cpu/MemPlan.hpp>
 #include <alpaka/mem/view/Traits.hpp>
 #include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/Integral.hpp>
+#include <alpaka/trace/Trace.hpp>
 
 #include <cstring>
 
@@ -85,7 +87,8 @@ namespace alpaka
                         m_srcPitchBytes(view::getPitchBytesVec(viewSrc)),
 
                         m_dstMemNative(reinterpret_cast<std::uint8_t *>(view::getPtrNative(viewDst))),
-                        m_srcMemNative(reinterpret_cast<std::uint8_t const *>(view::getPtrNative(viewSrc)))
+                        m_srcMemNative(reinterpret_cast<std::uint8_t const *>(view::getPtrNative(viewSrc))),
+                        m_plan(m_extent, sizeof(Elem), m_dstPitchBytes, m_srcPitchBytes)
                 {
                     ALPAKA_ASSERT((castVec<DstSize>(m_extent) <= m_dstExtent).foldrAll(std::logical_or<bool>()));
                     ALPAKA_ASSERT((castVec<SrcSize>(m_extent) <= m_srcExtent).foldrAll(std::logical_or<bool>()));
@@ -111,6 +114,19 @@ namespace alpaka
                 }
 #endif
 
+#ifdef ALPAKA_TRACE_ENABLED
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto describeTrace() const
+                -> std::pair<std::string, std::string>
+                {
+                    return
+                        trace::detail::describeMemOp(
+                            "copy",
+                            m_extent,
+                            static_cast<std::size_t>(m_extent.prod()) * sizeof(Elem));
+                }
+#endif
+
                 Vec<TDim, ExtentSize> const m_extent;
                 ExtentSize const m_extentWidthBytes;
 #if (!defined(NDEBUG)) || (ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL)
@@ -122,6 +138,7 @@ namespace alpaka
 
                 std::uint8_t * const m_dstMemNative;
                 std::uint8_t const * const m_srcMemNative;
+                MemPlanCpu<TDim> const m_plan;
             };
 
 
@@ -135,11 +152,6 @@ namespace alpaka
                 typename TExtent>
             struct TaskCopyCpu : public TaskCopyCpuBase<TDim, TViewDst, TViewSrc, TExtent>
             {
-                using DimMin1 = DimInt<TDim::value - 1u>;
-                using typename TaskCopyCpuBase<TDim, TViewDst, TViewSrc, TExtent>::ExtentSize;
-                using typename TaskCopyCpuBase<TDim, TViewDst, TViewSrc, TExtent>::DstSize;
-                using typename TaskCopyCpuBase<TDim, TViewDst, TViewSrc, TExtent>::SrcSize;
-
                 //-----------------------------------------------------------------------------
                 using TaskCopyCpuBase<TDim, TViewDst, TViewSrc, TExtent>::TaskCopyCpuBase;
 
@@ -148,28 +160,25 @@ namespace alpaka
                 -> void
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+                    ALPAKA_TRACE_SCOPE(
+                        "copy",
+                        [this](){return this->describeTrace();});
 
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                     this->printDebug();
 #endif
-                    // [z, y, x] -> [z, y] because all elements with the innermost x dimension are handled within one iteration.
-                    Vec<DimMin1, ExtentSize> const extentWithoutInnermost(subVecBegin<DimMin1>(this->m_extent));
-                    // [z, y, x] -> [y, x] because the z pitch (the full size of the buffer) is not required.
-                    Vec<DimMin1, DstSize> const dstPitchBytesWithoutOutmost(subVecEnd<DimMin1>(this->m_dstPitchBytes));
-                    Vec<DimMin1, SrcSize> const srcPitchBytesWithoutOutmost(subVecEnd<DimMin1>(this->m_srcPitchBytes));
-
-                    if(static_cast<std::size_t>(this->m_extent.prod()) != 0u)
-                    {
-                        meta::ndLoopIncIdx(
-                            extentWithoutInnermost,
-                            [&](Vec<DimMin1, ExtentSize> const & idx)
-                            {
-                                std::memcpy(
-                                    reinterpret_cast<void *>(this->m_dstMemNative + (castVec<DstSize>(idx) * dstPitchBytesWithoutOutmost).foldrAll(std::plus<DstSize>())),
-                                    reinterpret_cast<void const *>(this->m_srcMemNative + (castVec<SrcSize>(idx) * srcPitchBytesWithoutOutmost).foldrAll(std::plus<SrcSize>())),
-                                    static_cast<std::size_t>(this->m_extentWidthBytes));
-                            });
-                    }
+                    this->m_plan.dispatchRowBytes(
+                        [this](auto const rowBytes)
+                        {
+                            this->m_plan.forEachRow(
+                                [this, rowBytes](std::size_t const dstOffsetBytes, std::size_t const srcOffsetBytes)
+                                {
+                                    std::memcpy(
+                                        reinterpret_cast<void *>(this->m_dstMemNative + dstOffsetBytes),
+                                        reinterpret_cast<void const *>(this->m_srcMemNative + srcOffsetBytes),
+                                        static_cast<std::size_t>(rowBytes));
+                                });
+                        });
                 }
             };
 
@@ -193,6 +202,9 @@ namespace alpaka
                 -> void
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+                    ALPAKA_TRACE_SCOPE(
+                        "copy",
+                        [this](){return this->describeTrace();});
 
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                     this->printDebug();
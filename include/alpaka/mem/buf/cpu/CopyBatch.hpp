@@ -0,0 +1,55 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/view/CopyBatch.hpp>
+
+namespace alpaka
+{
+    class DevCpu;
+}
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU device batched memory copy trait specialization.
+            //!
+            //! The regions are copied by the threads of the worker pool.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevCpu,
+                DevCpu>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchParallel(
+                            viewDst,
+                            viewSrc,
+                            regions);
+                }
+            };
+        }
+    }
+}
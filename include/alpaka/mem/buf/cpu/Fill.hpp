@@ -0,0 +1,321 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/core/WorkerPool.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/meta/Integral.hpp>
+#include <alpaka/trace/Trace.hpp>
+
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+    #include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace alpaka
+{
+    class DevCpu;
+}
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! Fills count elements starting at pDst with the given value.
+            //!
+            //! If bNonTemporal is set, the stores bypass the caches where this is supported.
+            //! This is faster for fills much larger than the last level cache because the destination is not read before being written.
+            template<
+                typename TElem>
+            ALPAKA_FN_HOST auto fillCpu(
+                TElem * pDst,
+                std::size_t count,
+                TElem const & value,
+                bool const bNonTemporal)
+            -> void
+            {
+#if BOOST_HW_SIMD_X86 >= BOOST_HW_SIMD_X86_SSE2_VERSION
+                constexpr std::size_t vecSize(sizeof(__m128i));
+                if(bNonTemporal
+                    && ((vecSize % sizeof(TElem)) == 0u)
+                    && ((reinterpret_cast<std::uintptr_t>(pDst) % sizeof(TElem)) == 0u))
+                {
+                    // Prologue: single elements until the destination is aligned to the vector size.
+                    for(; (count > 0u) && ((reinterpret_cast<std::uintptr_t>(pDst) % vecSize) != 0u); --count, ++pDst)
+                    {
+                        *pDst = value;
+                    }
+
+                    // Each vector starts at an element boundary so the pattern is the same for all of them.
+                    alignas(vecSize) std::uint8_t pattern[vecSize];
+                    for(std::size_t i(0u); i < vecSize; i += sizeof(TElem))
+                    {
+                        std::memcpy(pattern + i, &value, sizeof(TElem));
+                    }
+                    __m128i const vec(_mm_load_si128(static_cast<__m128i const *>(static_cast<void const *>(pattern))));
+
+                    constexpr std::size_t elemsPerVec(vecSize / sizeof(TElem));
+                    __m128i * pVec(static_cast<__m128i *>(static_cast<void *>(pDst)));
+                    std::size_t const vecCount(count / elemsPerVec);
+                    for(std::size_t i(0u); i < vecCount; ++i)
+                    {
+                        _mm_stream_si128(pVec + i, vec);
+                    }
+                    // Non-temporal stores are weakly ordered.
+                    _mm_sfence();
+
+                    // Epilogue: the remaining elements.
+                    std::fill(pDst + vecCount * elemsPerVec, pDst + count, value);
+                    return;
+                }
+#else
+                alpaka::ignore_unused(bNonTemporal);
+#endif
+                std::fill(pDst, pDst + count, value);
+            }
+
+            //#############################################################################
+            //! The CPU device ND memory fill task.
+            template<
+                typename TDim,
+                typename TView,
+                typename TExtent>
+            struct TaskFillCpu
+            {
+                using ExtentSize = Idx<TExtent>;
+                using DstSize = Idx<TView>;
+                using Elem = alpaka::Elem<TView>;
+
+                static_assert(
+                    !std::is_const<TView>::value,
+                    "The destination view can not be const!");
+
+                static_assert(
+                    Dim<TView>::value == Dim<TExtent>::value,
+                    "The destination view and the extent are required to have the same dimensionality!");
+                static_assert(
+                    Dim<TView>::value == TDim::value,
+                    "The destination view and the input TDim are required to have the same dimensionality!");
+
+                static_assert(
+                    meta::IsIntegralSuperset<DstSize, ExtentSize>::value,
+                    "The view and the extent are required to have compatible idx type!");
+
+                //! Fills of at least this size are distributed onto multiple workers of the shared worker pool.
+                static constexpr std::size_t s_minBytesPerThread = 4u * 1024u * 1024u;
+                //! Fills of at least this size use non-temporal stores.
+                static constexpr std::size_t s_minBytesNonTemporal = 32u * 1024u * 1024u;
+
+                //-----------------------------------------------------------------------------
+                TaskFillCpu(
+                    TView & view,
+                    Elem const & value,
+                    TExtent const & extent) :
+                        m_value(value),
+                        m_extent(extent::getExtentVec(extent)),
+#if (!defined(NDEBUG)) || (ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL)
+                        m_dstExtent(extent::getExtentVec(view)),
+#endif
+                        m_dstPitchBytes(view::getPitchBytesVec(view)),
+                        m_dstMemNative(reinterpret_cast<std::uint8_t *>(view::getPtrNative(view)))
+                {
+                    ALPAKA_ASSERT((castVec<DstSize>(m_extent) <= m_dstExtent).foldrAll(std::logical_or<bool>()));
+                    ALPAKA_ASSERT(static_cast<DstSize>(m_extent[TDim::value - 1u]) * static_cast<DstSize>(sizeof(Elem)) <= m_dstPitchBytes[TDim::value - 1u]);
+                }
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto printDebug() const
+                -> void
+                {
+                    std::cout << __func__
+                        << " e: " << this->m_extent
+                        << " de: " << this->m_dstExtent
+                        << " dptr: " << reinterpret_cast<void *>(this->m_dstMemNative)
+                        << " dpitchb: " << this->m_dstPitchBytes
+                        << std::endl;
+                }
+#endif
+
+#ifdef ALPAKA_TRACE_ENABLED
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto describeTrace() const
+                -> std::pair<std::string, std::string>
+                {
+                    return
+                        trace::detail::describeMemOp(
+                            "fill",
+                            m_extent,
+                            static_cast<std::size_t>(m_extent.prod()) * sizeof(Elem));
+                }
+#endif
+
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()() const
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+                    ALPAKA_TRACE_SCOPE(
+                        "fill",
+                        [this](){return this->describeTrace();});
+
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
+                    this->printDebug();
+#endif
+                    std::size_t const elemCount(static_cast<std::size_t>(m_extent.prod()));
+                    if(elemCount == 0u)
+                    {
+                        return;
+                    }
+
+                    // If the rows are stored without padding, the whole region is filled as a single row.
+                    bool const bContiguous(isContiguous());
+                    std::size_t const rowElemCount(bContiguous ? elemCount : static_cast<std::size_t>(m_extent[TDim::value - 1u]));
+
+                    // Fills elements [first, last) of the region given in row major order.
+                    auto const fillRange(
+                        [&](std::size_t first, std::size_t const last, bool const bNonTemporal)
+                        {
+                            while(first < last)
+                            {
+                                std::size_t const row(first / rowElemCount);
+                                std::size_t const col(first % rowElemCount);
+                                std::size_t const count(std::min(rowElemCount - col, last - first));
+
+                                fillCpu(
+                                    static_cast<Elem *>(static_cast<void *>(m_dstMemNative + getRowOffsetBytes(row))) + col,
+                                    count,
+                                    m_value,
+                                    bNonTemporal);
+
+                                first += count;
+                            }
+                        });
+
+                    std::size_t const bytes(elemCount * sizeof(Elem));
+                    bool const bNonTemporal(bytes >= s_minBytesNonTemporal);
+                    auto & workerPool(core::detail::WorkerPool::getInstance());
+                    std::size_t const workerCount(
+                        std::max(
+                            std::min(
+                                workerPool.getWorkerCount(),
+                                bytes / s_minBytesPerThread),
+                            static_cast<std::size_t>(1u)));
+
+                    if(workerCount == 1u)
+                    {
+                        fillRange(0u, elemCount, bNonTemporal);
+                    }
+                    else
+                    {
+                        std::size_t const chunkSize((elemCount + workerCount - 1u) / workerCount);
+                        workerPool.run(
+                            workerCount,
+                            [&](std::size_t const workerIdx)
+                            {
+                                std::size_t const first(std::min(workerIdx * chunkSize, elemCount));
+                                std::size_t const last(std::min(first + chunkSize, elemCount));
+                                fillRange(first, last, bNonTemporal);
+                            });
+                    }
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! \return The byte offset of the row with the given linear index.
+                ALPAKA_FN_HOST auto getRowOffsetBytes(
+                    std::size_t row) const
+                -> DstSize
+                {
+                    DstSize rowOffsetBytes(0u);
+                    for(std::size_t d(TDim::value - 1u); d > 0u; --d)
+                    {
+                        std::size_t const extent(static_cast<std::size_t>(m_extent[d - 1u]));
+                        rowOffsetBytes = static_cast<DstSize>(rowOffsetBytes + static_cast<DstSize>(row % extent) * m_dstPitchBytes[d]);
+                        row /= extent;
+                    }
+                    return rowOffsetBytes;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return If the region to fill is stored without any padding between its rows.
+                ALPAKA_FN_HOST auto isContiguous() const
+                -> bool
+                {
+                    DstSize requiredPitchBytes(static_cast<DstSize>(m_extent[TDim::value - 1u]) * static_cast<DstSize>(sizeof(Elem)));
+                    for(std::size_t d(TDim::value - 1u); d > 0u; --d)
+                    {
+                        if(m_dstPitchBytes[d] != requiredPitchBytes)
+                        {
+                            return false;
+                        }
+                        requiredPitchBytes = static_cast<DstSize>(requiredPitchBytes * static_cast<DstSize>(m_extent[d - 1u]));
+                    }
+                    return true;
+                }
+
+                Elem const m_value;
+                Vec<TDim, ExtentSize> const m_extent;
+#if (!defined(NDEBUG)) || (ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL)
+                Vec<TDim, DstSize> const m_dstExtent;
+#endif
+                Vec<TDim, DstSize> const m_dstPitchBytes;
+                std::uint8_t * const m_dstMemNative;
+            };
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU device memory fill trait specialization.
+            template<
+                typename TDim>
+            struct CreateTaskFill<
+                TDim,
+                DevCpu>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent,
+                    typename TView>
+                ALPAKA_FN_HOST static auto createTaskFill(
+                    TView & view,
+                    Elem<TView> const & value,
+                    TExtent const & extent)
+                -> view::detail::TaskFillCpu<
+                    TDim,
+                    TView,
+                    TExtent>
+                {
+                    return
+                        view::detail::TaskFillCpu<
+                            TDim,
+                            TView,
+                            TExtent>(
+                                view,
+                                value,
+                                extent);
+                }
+            };
+        }
+    }
+}
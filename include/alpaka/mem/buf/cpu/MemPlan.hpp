@@ -0,0 +1,233 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! The plan of a CPU memory copy or set operation.
+            //!
+            //! The N-dimensional region is reduced to a minimal number of outer dimensions with rows of contiguous bytes:
+            //! - Dimensions with an extent of one are dropped.
+            //! - Dimensions whose pitch equals the bytes of the inner row are merged into the row.
+            //!   A copy of a whole buffer without padding is therefore a single bulk operation.
+            //! - Outer dimensions that are contiguous with respect to each other are merged into one dimension.
+            //!
+            //! The plan is computed once when the task is created.
+            //!
+            //! \tparam TDim The dimensionality of the region.
+            template<
+                typename TDim>
+            class MemPlanCpu
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param extent The extent of the region in elements.
+                //! \param elemBytes The size of an element in bytes.
+                //! \param dstPitchBytes The pitches of the destination as returned by view::getPitchBytesVec.
+                //! \param srcPitchBytes The pitches of the source as returned by view::getPitchBytesVec.
+                template<
+                    typename TExtentVec,
+                    typename TDstPitchVec,
+                    typename TSrcPitchVec>
+                ALPAKA_FN_HOST MemPlanCpu(
+                    TExtentVec const & extent,
+                    std::size_t const elemBytes,
+                    TDstPitchVec const & dstPitchBytes,
+                    TSrcPitchVec const & srcPitchBytes) :
+                        m_rowBytes(static_cast<std::size_t>(extent[TDim::value - 1u]) * elemBytes),
+                        m_outerDimCount(0u),
+                        m_outerExtent(),
+                        m_dstOuterPitchBytes(),
+                        m_srcOuterPitchBytes()
+                {
+                    if(static_cast<std::size_t>(extent.prod()) == 0u)
+                    {
+                        m_rowBytes = 0u;
+                        return;
+                    }
+
+                    // The dimensions are collected from the innermost to the outermost one.
+                    std::array<std::size_t, TDim::value> outerExtent{};
+                    std::array<std::size_t, TDim::value> dstPitch{};
+                    std::array<std::size_t, TDim::value> srcPitch{};
+                    std::size_t count(0u);
+                    for(std::size_t i(1u); i < TDim::value; ++i)
+                    {
+                        std::size_t const d(TDim::value - 1u - i);
+                        std::size_t const e(static_cast<std::size_t>(extent[d]));
+                        // The distance between consecutive elements of dimension d is the pitch of dimension d + 1.
+                        std::size_t const dp(static_cast<std::size_t>(dstPitchBytes[d + 1u]));
+                        std::size_t const sp(static_cast<std::size_t>(srcPitchBytes[d + 1u]));
+
+                        if(e == 1u)
+                        {
+                            continue;
+                        }
+                        if((count == 0u) && (dp == m_rowBytes) && (sp == m_rowBytes))
+                        {
+                            m_rowBytes *= e;
+                        }
+                        else if((count > 0u)
+                            && (dp == dstPitch[count - 1u] * outerExtent[count - 1u])
+                            && (sp == srcPitch[count - 1u] * outerExtent[count - 1u]))
+                        {
+                            outerExtent[count - 1u] *= e;
+                        }
+                        else
+                        {
+                            outerExtent[count] = e;
+                            dstPitch[count] = dp;
+                            srcPitch[count] = sp;
+                            ++count;
+                        }
+                    }
+
+                    // Store the outer dimensions from the outermost to the innermost one.
+                    m_outerDimCount = count;
+                    for(std::size_t i(0u); i < count; ++i)
+                    {
+                        m_outerExtent[i] = outerExtent[count - 1u - i];
+                        m_dstOuterPitchBytes[i] = dstPitch[count - 1u - i];
+                        m_srcOuterPitchBytes[i] = srcPitch[count - 1u - i];
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return If the region is a single contiguous block of bytes in both memories.
+                ALPAKA_FN_HOST auto isBulk() const
+                -> bool
+                {
+                    return (m_outerDimCount == 0u) && (m_rowBytes != 0u);
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of contiguous bytes of each row.
+                ALPAKA_FN_HOST auto getRowBytes() const
+                -> std::size_t
+                {
+                    return m_rowBytes;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of dimensions iterated to visit all rows.
+                ALPAKA_FN_HOST auto getOuterDimCount() const
+                -> std::size_t
+                {
+                    return m_outerDimCount;
+                }
+                //-----------------------------------------------------------------------------
+                //! \return The number of rows.
+                ALPAKA_FN_HOST auto getRowCount() const
+                -> std::size_t
+                {
+                    std::size_t rowCount(m_rowBytes == 0u ? 0u : 1u);
+                    for(std::size_t i(0u); i < m_outerDimCount; ++i)
+                    {
+                        rowCount *= m_outerExtent[i];
+                    }
+                    return rowCount;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Calls the operation with the number of bytes of a row.
+                //!
+                //! Narrow rows of a power of two size are passed as std::integral_constant so that the
+                //! compiler can replace the std::memcpy or std::memset by inline moves.
+                template<
+                    typename TFnOp>
+                ALPAKA_FN_HOST auto dispatchRowBytes(
+                    TFnOp const & fnOp) const
+                -> void
+                {
+                    switch(m_rowBytes)
+                    {
+                    case 1u: fnOp(std::integral_constant<std::size_t, 1u>()); break;
+                    case 2u: fnOp(std::integral_constant<std::size_t, 2u>()); break;
+                    case 4u: fnOp(std::integral_constant<std::size_t, 4u>()); break;
+                    case 8u: fnOp(std::integral_constant<std::size_t, 8u>()); break;
+                    case 16u: fnOp(std::integral_constant<std::size_t, 16u>()); break;
+                    default: fnOp(m_rowBytes); break;
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Calls the function with the destination and source byte offsets of each row.
+                template<
+                    typename TFnRow>
+                ALPAKA_FN_HOST auto forEachRow(
+                    TFnRow const & fnRow) const
+                -> void
+                {
+                    if(m_rowBytes == 0u)
+                    {
+                        return;
+                    }
+                    if(m_outerDimCount == 0u)
+                    {
+                        fnRow(std::size_t(0u), std::size_t(0u));
+                        return;
+                    }
+
+                    std::size_t const innermost(m_outerDimCount - 1u);
+                    std::array<std::size_t, TDim::value> idx{};
+                    for(;;)
+                    {
+                        std::size_t dstOffsetBytes(0u);
+                        std::size_t srcOffsetBytes(0u);
+                        for(std::size_t i(0u); i < innermost; ++i)
+                        {
+                            dstOffsetBytes += idx[i] * m_dstOuterPitchBytes[i];
+                            srcOffsetBytes += idx[i] * m_srcOuterPitchBytes[i];
+                        }
+
+                        for(std::size_t j(0u); j < m_outerExtent[innermost]; ++j)
+                        {
+                            fnRow(
+                                dstOffsetBytes + j * m_dstOuterPitchBytes[innermost],
+                                srcOffsetBytes + j * m_srcOuterPitchBytes[innermost]);
+                        }
+
+                        // Advance the index of the remaining outer dimensions.
+                        std::size_t d(innermost);
+                        for(;;)
+                        {
+                            if(d == 0u)
+                            {
+                                return;
+                            }
+                            --d;
+                            if(++idx[d] < m_outerExtent[d])
+                            {
+                                break;
+                            }
+                            idx[d] = 0u;
+                        }
+                    }
+                }
+
+            private:
+                std::size_t m_rowBytes;
+                std::size_t m_outerDimCount;
+                std::array<std::size_t, TDim::value> m_outerExtent;
+                std::array<std::size_t, TDim::value> m_dstOuterPitchBytes;
+                std::array<std::size_t, TDim::value> m_srcOuterPitchBytes;
+            };
+        }
+    }
+}
@@ -12,9 +12,11 @@
 #include <alpaka/core/Assert.hpp>
 #include <alpaka/dim/DimIntegralConst.hpp>
 #include <alpaka/extent/Traits.hpp>
+#include <alpaka/mem/buf/cpu/MemPlan.hpp>
 #include <alpaka/mem/view/Traits.hpp>
 #include <alpaka/meta/NdLoop.hpp>
 #include <alpaka/meta/Integral.hpp>
+#include <alpaka/trace/Trace.hpp>
 
 #include <cstring>
 
@@ -68,7 +70,8 @@ namespace alpaka
                         m_dstExtent(extent::getExtentVec(view)),
 #endif
                         m_dstPitchBytes(view::getPitchBytesVec(view)),
-                        m_dstMemNative(reinterpret_cast<std::uint8_t *>(view::getPtrNative(view)))
+                        m_dstMemNative(reinterpret_cast<std::uint8_t *>(view::getPtrNative(view))),
+                        m_plan(m_extent, sizeof(Elem), m_dstPitchBytes, m_dstPitchBytes)
                 {
                     ALPAKA_ASSERT((castVec<DstSize>(m_extent) <= m_dstExtent).foldrAll(std::logical_or<bool>()));
                     ALPAKA_ASSERT(m_extentWidthBytes <= m_dstPitchBytes[TDim::value - 1u]);
@@ -89,6 +92,19 @@ namespace alpaka
                 }
 #endif
 
+#ifdef ALPAKA_TRACE_ENABLED
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto describeTrace() const
+                -> std::pair<std::string, std::string>
+                {
+                    return
+                        trace::detail::describeMemOp(
+                            "set",
+                            m_extent,
+                            static_cast<std::size_t>(m_extent.prod()) * sizeof(Elem));
+                }
+#endif
+
                 std::uint8_t const m_byte;
                 Vec<TDim, ExtentSize> const m_extent;
                 ExtentSize const m_extentWidthBytes;
@@ -97,6 +113,7 @@ namespace alpaka
 #endif
                 Vec<TDim, DstSize> const m_dstPitchBytes;
                 std::uint8_t * const m_dstMemNative;
+                MemPlanCpu<TDim> const m_plan;
             };
 
             //#############################################################################
@@ -107,10 +124,6 @@ namespace alpaka
                 typename TExtent>
             struct TaskSetCpu : public TaskSetCpuBase<TDim, TView, TExtent>
             {
-                using DimMin1 = DimInt<TDim::value - 1u>;
-                using typename TaskSetCpuBase<TDim, TView, TExtent>::ExtentSize;
-                using typename TaskSetCpuBase<TDim, TView, TExtent>::DstSize;
-
                 //-----------------------------------------------------------------------------
                 using TaskSetCpuBase<TDim, TView, TExtent>::TaskSetCpuBase;
 
@@ -119,28 +132,25 @@ namespace alpaka
                 -> void
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+                    ALPAKA_TRACE_SCOPE(
+                        "set",
+                        [this](){return this->describeTrace();});
 
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                     this->printDebug();
 #endif
-                    // [z, y, x] -> [z, y] because all elements with the innermost x dimension are handled within one iteration.
-                    Vec<DimMin1, ExtentSize> const extentWithoutInnermost(subVecBegin<DimMin1>(this->m_extent));
-                    // [z, y, x] -> [y, x] because the z pitch (the full idx of the buffer) is not required.
-                    Vec<DimMin1, DstSize> const dstPitchBytesWithoutOutmost(subVecEnd<DimMin1>(this->m_dstPitchBytes));
-
-                    if(static_cast<std::size_t>(this->m_extent.prod()) != 0u)
-                    {
-                        meta::ndLoopIncIdx(
-                            extentWithoutInnermost,
-                            [&](Vec<DimMin1, ExtentSize> const & idx)
-                            {
-
-                                memset(
-                                    reinterpret_cast<void *>(this->m_dstMemNative + (castVec<DstSize>(idx) * dstPitchBytesWithoutOutmost).foldrAll(std::plus<DstSize>())),
-                                    this->m_byte,
-                                    static_cast<std::size_t>(this->m_extentWidthBytes));
-                            });
-                    }
+                    this->m_plan.dispatchRowBytes(
+                        [this](auto const rowBytes)
+                        {
+                            this->m_plan.forEachRow(
+                                [this, rowBytes](std::size_t const dstOffsetBytes, std::size_t const)
+                                {
+                                    std::memset(
+                                        reinterpret_cast<void *>(this->m_dstMemNative + dstOffsetBytes),
+                                        this->m_byte,
+                                        static_cast<std::size_t>(rowBytes));
+                                });
+                        });
                 }
             };
 
@@ -162,6 +172,9 @@ namespace alpaka
                 -> void
                 {
                     ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+                    ALPAKA_TRACE_SCOPE(
+                        "set",
+                        [this](){return this->describeTrace();});
 
 #if ALPAKA_DEBUG >= ALPAKA_DEBUG_FULL
                     this->printDebug();
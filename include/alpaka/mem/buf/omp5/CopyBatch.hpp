@@ -0,0 +1,119 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_ANY_BT_OMP5_ENABLED
+
+#if _OPENMP < 201307
+    #error If ALPAKA_ACC_ANY_BT_OMP5_ENABLED is set, the compiler has to support OpenMP 4.0 or higher!
+#endif
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/DevOmp5.hpp>
+#include <alpaka/mem/buf/omp5/Copy.hpp>
+#include <alpaka/mem/view/CopyBatch.hpp>
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CPU to Omp5 batched memory copy trait specialization.
+            //!
+            //! The copies of the regions are issued concurrently by the threads of the worker pool.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevOmp5,
+                DevCpu>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchParallel(
+                            viewDst,
+                            viewSrc,
+                            regions);
+                }
+            };
+
+            //#############################################################################
+            //! The Omp5 to CPU batched memory copy trait specialization.
+            //!
+            //! The copies of the regions are issued concurrently by the threads of the worker pool.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevCpu,
+                DevOmp5>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchParallel(
+                            viewDst,
+                            viewSrc,
+                            regions);
+                }
+            };
+
+            //#############################################################################
+            //! The Omp5 to Omp5 batched memory copy trait specialization.
+            //!
+            //! The copies of the regions are issued concurrently by the threads of the worker pool.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevOmp5,
+                DevOmp5>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchParallel(
+                            viewDst,
+                            viewSrc,
+                            regions);
+                }
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#ifdef ALPAKA_ACC_ANY_BT_OMP5_ENABLED
+
+#if _OPENMP < 201307
+    #error If ALPAKA_ACC_ANY_BT_OMP5_ENABLED is set, the compiler has to support OpenMP 4.0 or higher!
+#endif
+
+#include <alpaka/dev/DevOmp5.hpp>
+#include <alpaka/kernel/TaskKernelOmp5.hpp>
+#include <alpaka/queue/QueueOmp5Blocking.hpp>
+#include <alpaka/mem/buf/FillKernel.hpp>
+
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/idx/Accessors.hpp>
+#include <alpaka/workdiv/WorkDivHelpers.hpp>
+
+namespace alpaka
+{
+    class DevOmp5;
+}
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The OMP5 device memory fill trait specialization.
+            template<
+                typename TDim>
+            struct CreateTaskFill<
+                TDim,
+                DevOmp5>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent,
+                    typename TView>
+                ALPAKA_FN_HOST static auto createTaskFill(
+                    TView & view,
+                    Elem<TView> const & value,
+                    TExtent const & extent)
+                {
+                    using Idx = typename alpaka::traits::IdxType<TExtent>::type;
+                    auto pitch = view::getPitchBytesVec(view);
+                    auto elemExtent = extent::getExtentVec(extent);
+                    constexpr auto lastDim = TDim::value - 1;
+
+                    if(pitch[0] == 0)
+                    {
+                        return createTaskKernel<AccOmp5<TDim,Idx>>(
+                                WorkDivMembers<TDim, Idx>(
+                                    Vec<TDim, Idx>::zeros(),
+                                    Vec<TDim, Idx>::zeros(),
+                                    Vec<TDim, Idx>::zeros()),
+                                view::MemFillKernel(),
+                                value,
+                                alpaka::view::getPtrNative(view),
+                                elemExtent,
+                                pitch
+                            ); // NOP if size is zero
+                    }
+
+                    auto elementsPerThread = Vec<TDim, Idx>::all(static_cast<Idx>(1u));
+                    elementsPerThread[lastDim] = static_cast<Idx>(view::MemFillKernel::getElemsPerThread<Elem<TView>>());
+                    // Let alpaka calculate good block and grid sizes given our full problem extent
+                    WorkDivMembers<TDim, Idx> const workDiv(
+                        getValidWorkDiv<AccOmp5<TDim,Idx>>(
+                            getDev(view),
+                            elemExtent,
+                            elementsPerThread,
+                            false,
+                            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+                    return
+                        createTaskKernel<AccOmp5<TDim,Idx>>(
+                                workDiv,
+                                view::MemFillKernel(),
+                                value,
+                                alpaka::view::getPtrNative(view),
+                                elemExtent,
+                                pitch
+                            );
+                }
+            };
+        }
+    }
+}
+
+#endif
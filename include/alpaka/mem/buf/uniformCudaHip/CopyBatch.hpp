@@ -0,0 +1,488 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) && !BOOST_LANG_CUDA
+#error If ALPAKA_ACC_GPU_CUDA_ENABLED is set, the compiler has to support CUDA!
+#endif
+
+#if defined(ALPAKA_ACC_GPU_HIP_ENABLED) && !BOOST_LANG_HIP
+#error If ALPAKA_ACC_GPU_HIP_ENABLED is set, the compiler has to support HIP!
+#endif
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/DevUniformCudaHipRt.hpp>
+#include <alpaka/mem/buf/uniformCudaHip/Copy.hpp>
+#include <alpaka/mem/view/CopyBatch.hpp>
+#include <alpaka/queue/QueueUniformCudaHipRtBlocking.hpp>
+#include <alpaka/queue/QueueUniformCudaHipRtNonBlocking.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+#include <alpaka/core/Debug.hpp>
+// Backend specific includes.
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+    #include <alpaka/core/Cuda.hpp>
+#else
+    #include <alpaka/core/Hip.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A region of a batched copy as read by the gather kernel.
+            template<
+                typename TDim>
+            struct CopyBatchRegionUniformCudaHip
+            {
+                std::uint8_t * m_dst;
+                std::uint8_t const * m_src;
+                //! The extent of the region. The last dimension is given in bytes.
+                Vec<TDim, std::size_t> m_extentBytes;
+                //! The distances in bytes between consecutive elements of all but the last dimension.
+                Vec<TDim, std::size_t> m_dstStrideBytes;
+                Vec<TDim, std::size_t> m_srcStrideBytes;
+                //! If the pointers, the row width and the strides are multiples of four bytes.
+                bool m_isWordAligned;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! Copies the words of a region with the given index and stride.
+            template<
+                typename TWord,
+                typename TDim>
+            __device__ auto copyBatchRegion(
+                CopyBatchRegionUniformCudaHip<TDim> const & region,
+                std::size_t const firstWordIdx,
+                std::size_t const wordIdxStride)
+            -> void
+            {
+                constexpr auto lastDim = TDim::value - 1u;
+
+                std::size_t const rowWordCount(region.m_extentBytes[lastDim] / sizeof(TWord));
+                std::size_t rowCount(1u);
+                for(std::size_t d(0u); d < lastDim; ++d)
+                {
+                    rowCount *= region.m_extentBytes[d];
+                }
+
+                for(std::size_t wordIdx(firstWordIdx); wordIdx < rowCount * rowWordCount; wordIdx += wordIdxStride)
+                {
+                    // Map the linear row index to the offsets of the outer dimensions.
+                    std::size_t rowIdx(wordIdx / rowWordCount);
+                    std::size_t dstOffsetBytes((wordIdx % rowWordCount) * sizeof(TWord));
+                    std::size_t srcOffsetBytes(dstOffsetBytes);
+                    for(std::size_t d(lastDim); d > 0u; --d)
+                    {
+                        std::size_t const idx(rowIdx % region.m_extentBytes[d - 1u]);
+                        rowIdx /= region.m_extentBytes[d - 1u];
+                        dstOffsetBytes += idx * region.m_dstStrideBytes[d - 1u];
+                        srcOffsetBytes += idx * region.m_srcStrideBytes[d - 1u];
+                    }
+
+                    *reinterpret_cast<TWord *>(region.m_dst + dstOffsetBytes) = *reinterpret_cast<TWord const *>(region.m_src + srcOffsetBytes);
+                }
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Copies all regions of a batch.
+            //!
+            //! The x dimension of the grid strides over the regions and the blocks of the y dimension share the words of a region.
+            template<
+                typename TDim>
+            __global__ void copyBatchKernel(
+                CopyBatchRegionUniformCudaHip<TDim> const * const regions,
+                std::size_t const regionCount)
+            {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                std::size_t const firstWordIdx(static_cast<std::size_t>(blockIdx.y) * blockDim.x + threadIdx.x);
+                std::size_t const wordIdxStride(static_cast<std::size_t>(gridDim.y) * blockDim.x);
+                std::size_t const firstRegionIdx(blockIdx.x);
+                std::size_t const regionIdxStride(gridDim.x);
+#else
+                std::size_t const firstWordIdx(static_cast<std::size_t>(hipBlockIdx_y) * hipBlockDim_x + hipThreadIdx_x);
+                std::size_t const wordIdxStride(static_cast<std::size_t>(hipGridDim_y) * hipBlockDim_x);
+                std::size_t const firstRegionIdx(hipBlockIdx_x);
+                std::size_t const regionIdxStride(hipGridDim_x);
+#endif
+                for(std::size_t regionIdx(firstRegionIdx); regionIdx < regionCount; regionIdx += regionIdxStride)
+                {
+                    auto const & region(regions[regionIdx]);
+                    if(region.m_isWordAligned)
+                    {
+                        copyBatchRegion<std::uint32_t>(region, firstWordIdx, wordIdxStride);
+                    }
+                    else
+                    {
+                        copyBatchRegion<std::uint8_t>(region, firstWordIdx, wordIdxStride);
+                    }
+                }
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The address of the host memory usable by kernels or nullptr if the memory is not mapped into the device address space.
+            ALPAKA_FN_HOST inline auto getMappedDevicePtr(
+                void const * const pHost)
+            -> void const *
+            {
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                cudaPointerAttributes attributes;
+#else
+                hipPointerAttribute_t attributes;
+#endif
+                // Pageable memory is unknown to the runtime. Older runtimes report this as an error which has to be reset.
+                if(ALPAKA_API_PREFIX(PointerGetAttributes)(&attributes, pHost) != ALPAKA_API_PREFIX(Success))
+                {
+                    ALPAKA_API_PREFIX(GetLastError)();
+                    return nullptr;
+                }
+                return attributes.devicePointer;
+            }
+
+            //#############################################################################
+            //! The CUDA/HIP batched memory copy task.
+            //!
+            //! If the memory of both views can be accessed by the device the copy task is executing, all regions are copied by a single gather kernel.
+            //! The region table of the kernel is uploaded once when the task is created so that repeatedly enqueueing the task costs a single launch.
+            //! Otherwise the asynchronous copies of all regions are issued back to back.
+            template<
+                typename TDim,
+                typename TTask>
+            struct TaskCopyBatchUniformCudaHip
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TQueue>
+                ALPAKA_FN_HOST auto enqueue(
+                    TQueue & queue) const
+                -> void
+                {
+                    if(m_spRegions && (getDev(queue).m_iDevice == m_iDevice))
+                    {
+                        using dim3Value_t = std::remove_reference_t<decltype(std::declval<dim3>().x)>;
+
+                        // Use more than one block per region when the regions are large.
+                        std::size_t const blockThreadCount(256u);
+                        dim3 const block(static_cast<dim3Value_t>(blockThreadCount));
+                        dim3 const grid(
+                            static_cast<dim3Value_t>(std::min(m_regionCount, static_cast<std::size_t>(65535u))),
+                            static_cast<dim3Value_t>(std::min(divUp(m_regionBytesMax, blockThreadCount * sizeof(std::uint32_t) * 16u), static_cast<std::size_t>(64u))));
+
+                        ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                            ALPAKA_API_PREFIX(SetDevice)(
+                                m_iDevice));
+                        auto const * const pRegions(static_cast<CopyBatchRegionUniformCudaHip<TDim> const *>(m_spRegions.get()));
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED)
+                        copyBatchKernel<TDim><<<
+                            grid, block, 0, queue.m_spQueueImpl->m_UniformCudaHipQueue>>>(
+                                pRegions, m_regionCount);
+#else
+                        hipLaunchKernelGGL(
+                            HIP_KERNEL_NAME(copyBatchKernel<TDim>),
+                            grid, block, 0, queue.m_spQueueImpl->m_UniformCudaHipQueue,
+                            pRegions, m_regionCount);
+#endif
+                        ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                            ALPAKA_API_PREFIX(GetLastError)());
+                    }
+                    else
+                    {
+                        for(auto const & taskRegion : m_tasks)
+                        {
+                            taskRegion.enqueue(queue);
+                        }
+                    }
+                }
+
+                //! The copy tasks of the regions used when the gather kernel can not be used.
+                std::vector<TTask> m_tasks;
+                //! The device executing the gather kernel.
+                int m_iDevice;
+                //! The region table of the gather kernel in device memory. Empty if the kernel can not be used.
+                std::shared_ptr<void> m_spRegions;
+                std::size_t m_regionCount;
+                std::size_t m_regionBytesMax;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! Creates the batched memory copy task.
+            //!
+            //! \param iDevice The device executing the gather kernel.
+            //! \param pDst The address of the destination view usable by kernels on the device or nullptr.
+            //! \param pSrc The address of the source view usable by kernels on the device or nullptr.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TRegions>
+            ALPAKA_FN_HOST auto createTaskCopyBatchUniformCudaHip(
+                TViewDst & viewDst,
+                TViewSrc const & viewSrc,
+                TRegions const & regions,
+                int const iDevice,
+                void * const pDst,
+                void const * const pSrc)
+            {
+                using Dim = alpaka::Dim<TViewDst>;
+                using Elem = alpaka::Elem<TViewDst>;
+                using Region = CopyBatchRegionUniformCudaHip<Dim>;
+                constexpr auto lastDim = Dim::value - 1u;
+
+                auto tasks(view::detail::createTasksCopyRegions(viewDst, viewSrc, regions));
+                using Task = TaskCopyBatchUniformCudaHip<Dim, typename decltype(tasks)::value_type>;
+                Task task{std::move(tasks), iDevice, nullptr, 0u, 0u};
+
+                if((pDst == nullptr) || (pSrc == nullptr) || regions.empty())
+                {
+                    return task;
+                }
+
+                auto const dstPitchBytes(view::getPitchBytesVec(viewDst));
+                auto const srcPitchBytes(view::getPitchBytesVec(viewSrc));
+
+                std::vector<Region> regionsKernel;
+                regionsKernel.reserve(regions.size());
+                for(auto const & region : regions)
+                {
+                    Region regionKernel{
+                        static_cast<std::uint8_t *>(pDst) + getRegionOffsetBytes<Elem>(dstPitchBytes, region.m_dstOffset),
+                        static_cast<std::uint8_t const *>(pSrc) + getRegionOffsetBytes<Elem>(srcPitchBytes, region.m_srcOffset),
+                        Vec<Dim, std::size_t>::zeros(),
+                        Vec<Dim, std::size_t>::zeros(),
+                        Vec<Dim, std::size_t>::zeros(),
+                        false};
+                    std::size_t alignmentMask(
+                        reinterpret_cast<std::uintptr_t>(regionKernel.m_dst)
+                        | reinterpret_cast<std::uintptr_t>(regionKernel.m_src));
+                    for(std::size_t d(0u); d < Dim::value; ++d)
+                    {
+                        regionKernel.m_extentBytes[d] = static_cast<std::size_t>(region.m_extent[d]);
+                        if(d < lastDim)
+                        {
+                            regionKernel.m_dstStrideBytes[d] = static_cast<std::size_t>(dstPitchBytes[d + 1u]);
+                            regionKernel.m_srcStrideBytes[d] = static_cast<std::size_t>(srcPitchBytes[d + 1u]);
+                            alignmentMask |= regionKernel.m_dstStrideBytes[d] | regionKernel.m_srcStrideBytes[d];
+                        }
+                    }
+                    regionKernel.m_extentBytes[lastDim] *= sizeof(Elem);
+                    alignmentMask |= regionKernel.m_extentBytes[lastDim];
+                    regionKernel.m_isWordAligned = ((alignmentMask % sizeof(std::uint32_t)) == 0u);
+
+                    std::size_t const regionBytes(regionKernel.m_extentBytes.prod());
+                    if(regionBytes > 0u)
+                    {
+                        task.m_regionBytesMax = std::max(task.m_regionBytesMax, regionBytes);
+                        regionsKernel.push_back(regionKernel);
+                    }
+                }
+                if(regionsKernel.empty())
+                {
+                    return task;
+                }
+
+                ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                    ALPAKA_API_PREFIX(SetDevice)(
+                        iDevice));
+                void * pRegions(nullptr);
+                ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                    ALPAKA_API_PREFIX(Malloc)(
+                        &pRegions,
+                        regionsKernel.size() * sizeof(Region)));
+                task.m_spRegions = std::shared_ptr<void>(
+                    pRegions,
+                    [iDevice](void * const ptr)
+                    {
+                        ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                            ALPAKA_API_PREFIX(SetDevice)(
+                                iDevice));
+                        ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                            ALPAKA_API_PREFIX(Free)(
+                                ptr));
+                    });
+                ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                    ALPAKA_API_PREFIX(Memcpy)(
+                        pRegions,
+                        regionsKernel.data(),
+                        regionsKernel.size() * sizeof(Region),
+                        ALPAKA_API_PREFIX(MemcpyHostToDevice)));
+                task.m_regionCount = regionsKernel.size();
+
+                return task;
+            }
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The CUDA/HIP device to device batched memory copy trait specialization.
+            //!
+            //! The gather kernel is used if both views are located on the same device.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevUniformCudaHipRt,
+                DevUniformCudaHipRt>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    int const iDevice(getDev(viewDst).m_iDevice);
+                    bool const isSameDevice(getDev(viewSrc).m_iDevice == iDevice);
+
+                    return
+                        view::detail::createTaskCopyBatchUniformCudaHip(
+                            viewDst,
+                            viewSrc,
+                            regions,
+                            iDevice,
+                            isSameDevice ? static_cast<void *>(view::getPtrNative(viewDst)) : nullptr,
+                            isSameDevice ? static_cast<void const *>(view::getPtrNative(viewSrc)) : nullptr);
+                }
+            };
+
+            //#############################################################################
+            //! The CPU to CUDA/HIP batched memory copy trait specialization.
+            //!
+            //! The gather kernel is used if the host memory is pinned and mapped into the device address space.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevUniformCudaHipRt,
+                DevCpu>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchUniformCudaHip(
+                            viewDst,
+                            viewSrc,
+                            regions,
+                            getDev(viewDst).m_iDevice,
+                            view::getPtrNative(viewDst),
+                            view::detail::getMappedDevicePtr(view::getPtrNative(viewSrc)));
+                }
+            };
+
+            //#############################################################################
+            //! The CUDA/HIP to CPU batched memory copy trait specialization.
+            //!
+            //! The gather kernel is used if the host memory is pinned and mapped into the device address space.
+            template<
+                typename TDim>
+            struct CreateTaskCopyBatch<
+                TDim,
+                DevCpu,
+                DevUniformCudaHipRt>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    return
+                        view::detail::createTaskCopyBatchUniformCudaHip(
+                            viewDst,
+                            viewSrc,
+                            regions,
+                            getDev(viewSrc).m_iDevice,
+                            const_cast<void *>(view::detail::getMappedDevicePtr(view::getPtrNative(viewDst))),
+                            view::getPtrNative(viewSrc));
+                }
+            };
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The CUDA/HIP non-blocking device queue batched copy enqueue trait specialization.
+        template<
+            typename TDim,
+            typename TTask>
+        struct Enqueue<
+            QueueUniformCudaHipRtNonBlocking,
+            view::detail::TaskCopyBatchUniformCudaHip<TDim, TTask>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                QueueUniformCudaHipRtNonBlocking & queue,
+                view::detail::TaskCopyBatchUniformCudaHip<TDim, TTask> const & task)
+            -> void
+            {
+                ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+                task.enqueue(queue);
+            }
+        };
+        //#############################################################################
+        //! The CUDA/HIP blocking device queue batched copy enqueue trait specialization.
+        //!
+        //! The queue is synchronized once after the whole batch has been issued.
+        template<
+            typename TDim,
+            typename TTask>
+        struct Enqueue<
+            QueueUniformCudaHipRtBlocking,
+            view::detail::TaskCopyBatchUniformCudaHip<TDim, TTask>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                QueueUniformCudaHipRtBlocking & queue,
+                view::detail::TaskCopyBatchUniformCudaHip<TDim, TTask> const & task)
+            -> void
+            {
+                ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+                task.enqueue(queue);
+
+                ALPAKA_UNIFORM_CUDA_HIP_RT_CHECK(
+                    ALPAKA_API_PREFIX(StreamSynchronize)(
+                        queue.m_spQueueImpl->m_UniformCudaHipQueue));
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,92 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if !BOOST_LANG_CUDA && !BOOST_LANG_HIP
+    #error Compiler has to support CUDA/HIP!
+#endif
+
+#include <alpaka/acc/AccGpuUniformCudaHipRt.hpp>
+#include <alpaka/dev/DevUniformCudaHipRt.hpp>
+#include <alpaka/kernel/TaskKernelGpuUniformCudaHipRt.hpp>
+#include <alpaka/mem/buf/FillKernel.hpp>
+
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/workdiv/WorkDivHelpers.hpp>
+
+namespace alpaka
+{
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The CUDA/HIP device memory fill trait specialization.
+            //!
+            //! The memset functions of the runtime can only store single bytes. Therefore a kernel storing whole elements is used.
+            template<
+                typename TDim>
+            struct CreateTaskFill<
+                TDim,
+                DevUniformCudaHipRt>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent,
+                    typename TView>
+                ALPAKA_FN_HOST static auto createTaskFill(
+                    TView & view,
+                    Elem<TView> const & value,
+                    TExtent const & extent)
+                {
+                    using Idx = typename alpaka::traits::IdxType<TExtent>::type;
+                    using Acc = AccGpuUniformCudaHipRt<TDim, Idx>;
+
+                    auto const pitch(view::getPitchBytesVec(view));
+                    auto const elemExtent(extent::getExtentVec(extent));
+                    constexpr auto lastDim = TDim::value - 1;
+
+                    auto elementsPerThread = Vec<TDim, Idx>::all(static_cast<Idx>(1u));
+                    elementsPerThread[lastDim] = static_cast<Idx>(view::MemFillKernel::getElemsPerThread<Elem<TView>>());
+                    // Let alpaka calculate good block and grid sizes given our full problem extent
+                    WorkDivMembers<TDim, Idx> const workDiv(
+                        (elemExtent.prod() == static_cast<Idx>(0u))
+                        ? WorkDivMembers<TDim, Idx>(
+                            Vec<TDim, Idx>::zeros(),
+                            Vec<TDim, Idx>::zeros(),
+                            Vec<TDim, Idx>::zeros())
+                        : getValidWorkDiv<Acc>(
+                            getDev(view),
+                            elemExtent,
+                            elementsPerThread,
+                            false,
+                            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+                    return
+                        createTaskKernel<Acc>(
+                            workDiv,
+                            view::MemFillKernel(),
+                            value,
+                            alpaka::view::getPtrNative(view),
+                            elemExtent,
+                            pitch);
+                }
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,234 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/view/Layout.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/meta/Metafunctions.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace alpaka
+{
+    namespace view
+    {
+        //#############################################################################
+        //! A typed N dimensional accessor to the elements of a memory view.
+        //!
+        //! The accessor only stores the native pointer and the layout mapping and can be passed to kernels by value.
+        //! Kernels written against accessors do not depend on the memory layout of the view.
+        //!
+        //! \tparam TElem The element type. Use a const type for read-only access.
+        //! \tparam TMapping The layout mapping of the view, e.g. layout::RowMajor::Mapping<TDim, TIdx>.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TMapping>
+        class Accessor
+        {
+        public:
+            using Mapping = TMapping;
+
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST_ACC Accessor(
+                TElem * pMem,
+                TMapping const & mapping) :
+                    m_pMem(pMem),
+                    m_mapping(mapping)
+            {}
+
+            //-----------------------------------------------------------------------------
+            //! \return The element at the given index.
+            ALPAKA_FN_HOST_ACC auto operator()(
+                Vec<TDim, TIdx> const & idx) const
+            -> TElem &
+            {
+                return m_pMem[m_mapping(idx)];
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The element at the given index given as one value per dimension.
+            template<
+                typename... TIdxs,
+                typename = std::enable_if_t<
+                    sizeof...(TIdxs) == TDim::value
+                    && meta::Conjunction<std::is_integral<TIdxs>...>::value>>
+            ALPAKA_FN_HOST_ACC auto operator()(
+                TIdxs const & ... idxs) const
+            -> TElem &
+            {
+                return (*this)(Vec<TDim, TIdx>(static_cast<TIdx>(idxs)...));
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The number of elements in each dimension.
+            ALPAKA_FN_HOST_ACC auto getExtent() const
+            -> Vec<TDim, TIdx> const &
+            {
+                return m_mapping.m_extent;
+            }
+
+        public:
+            TElem * m_pMem;
+            TMapping m_mapping;
+        };
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The accessor get trait.
+            //!
+            //! The default implementation accesses the native memory of the view with a pitched row-major mapping.
+            template<
+                typename TView,
+                typename TSfinae = void>
+            struct GetAccessor
+            {
+                using Mapping = layout::RowMajor::Mapping<Dim<TView>, Idx<TView>>;
+
+                //-----------------------------------------------------------------------------
+                //! \tparam TViewQualified The possibly const qualified view type.
+                template<
+                    typename TViewQualified>
+                ALPAKA_FN_HOST static auto getAccessor(
+                    TViewQualified & view)
+                {
+                    using Elem = std::remove_pointer_t<decltype(view::getPtrNative(view))>;
+
+                    return
+                        Accessor<Elem, Dim<TView>, Idx<TView>, Mapping>(
+                            view::getPtrNative(view),
+                            Mapping(
+                                extent::getExtentVec(view),
+                                getPitchElems(view, std::make_index_sequence<Dim<TView>::value>())));
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                template<
+                    std::size_t... TIndices>
+                ALPAKA_FN_HOST static auto getPitchElems(
+                    TView const & view,
+                    std::index_sequence<TIndices...> const &)
+                -> Vec<Dim<TView>, Idx<TView>>
+                {
+                    Vec<Dim<TView>, Idx<TView>> const pitchBytes(
+                        view::getPitchBytes<TIndices + 1u>(view)...);
+
+                    auto pitchElems(Vec<Dim<TView>, Idx<TView>>::zeros());
+                    for(std::size_t d(0u); d < Dim<TView>::value; ++d)
+                    {
+                        if((pitchBytes[d] % static_cast<Idx<TView>>(sizeof(alpaka::Elem<TView>))) != static_cast<Idx<TView>>(0u))
+                        {
+                            throw std::runtime_error("The pitch of the view is not a multiple of the element size!");
+                        }
+                        pitchElems[d] = static_cast<Idx<TView>>(pitchBytes[d] / static_cast<Idx<TView>>(sizeof(alpaka::Elem<TView>)));
+                    }
+                    return pitchElems;
+                }
+            };
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return An accessor to the elements of the view.
+        //!
+        //! The accessor to a const view grants read-only access.
+        template<
+            typename TView>
+        ALPAKA_FN_HOST auto getAccessor(
+            TView & view)
+        {
+            return
+                traits::GetAccessor<
+                    std::remove_const_t<TView>>
+                ::getAccessor(
+                    view);
+        }
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The Accessor dimension get trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TMapping>
+        struct DimType<
+            view::Accessor<TElem, TDim, TIdx, TMapping>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The Accessor memory element type get trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TMapping>
+        struct ElemType<
+            view::Accessor<TElem, TDim, TIdx, TMapping>>
+        {
+            using type = TElem;
+        };
+
+        //#############################################################################
+        //! The Accessor idx type trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TMapping>
+        struct IdxType<
+            view::Accessor<TElem, TDim, TIdx, TMapping>>
+        {
+            using type = TIdx;
+        };
+    }
+    namespace extent
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The Accessor extent get trait specialization.
+            template<
+                typename TIdxIntegralConst,
+                typename TElem,
+                typename TDim,
+                typename TIdx,
+                typename TMapping>
+            struct GetExtent<
+                TIdxIntegralConst,
+                view::Accessor<TElem, TDim, TIdx, TMapping>,
+                std::enable_if_t<(TDim::value > TIdxIntegralConst::value)>>
+            {
+                ALPAKA_NO_HOST_ACC_WARNING
+                ALPAKA_FN_HOST_ACC static auto getExtent(
+                    view::Accessor<TElem, TDim, TIdx, TMapping> const & accessor)
+                -> TIdx
+                {
+                    return accessor.getExtent()[TIdxIntegralConst::value];
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,368 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+//-----------------------------------------------------------------------------
+//! Declares the members of a structure-of-arrays record.
+//!
+//! A record is a class template parametrized on the kind of its members, e.g.:
+//! \code
+//! template<
+//!     template<typename> class TMember>
+//! struct Particle
+//! {
+//!     TMember<float> x;
+//!     TMember<float> y;
+//!     TMember<std::int32_t> id;
+//!
+//!     ALPAKA_SOA_MEMBERS(x, y, id)
+//! };
+//! \endcode
+//! The members have to be listed in the order of their declaration.
+#define ALPAKA_SOA_MEMBERS(...)\
+    ALPAKA_NO_HOST_ACC_WARNING\
+    template<\
+        typename TFn>\
+    ALPAKA_FN_HOST_ACC auto applyToMembers(\
+        TFn const & fn) const\
+    -> decltype(auto)\
+    {\
+        return fn(__VA_ARGS__);\
+    }
+
+namespace alpaka
+{
+    //-----------------------------------------------------------------------------
+    //! The structure-of-arrays specifics.
+    namespace soa
+    {
+        //! The member kind of a record holding the element values.
+        template<
+            typename T>
+        using Value = T;
+        //! The member kind of a record referencing the members of an element.
+        template<
+            typename T>
+        using Ref = T &;
+        //! The member kind of a record referencing the members of an element read-only.
+        template<
+            typename T>
+        using ConstRef = T const &;
+        //! The member kind of a record pointing to the member arrays.
+        template<
+            typename T>
+        using Ptr = T *;
+        //! The member kind of a record pointing to the member arrays read-only.
+        template<
+            typename T>
+        using ConstPtr = T const *;
+
+        namespace detail
+        {
+            //#############################################################################
+            //! The member kinds of the accessors.
+            template<
+                bool TConst>
+            struct Kinds
+            {
+                template<
+                    typename T>
+                using Ptr = soa::Ptr<T>;
+                template<
+                    typename T>
+                using Ref = soa::Ref<T>;
+            };
+            //#############################################################################
+            template<>
+            struct Kinds<true>
+            {
+                template<
+                    typename T>
+                using Ptr = soa::ConstPtr<T>;
+                template<
+                    typename T>
+                using Ref = soa::ConstRef<T>;
+            };
+
+            //#############################################################################
+            //! Creates a record from the values of the members of another record.
+            template<
+                typename TRecord>
+            struct MakeRecord
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename... TMembers>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TMembers const & ... members) const
+                -> TRecord
+                {
+                    return TRecord{members...};
+                }
+            };
+
+            //#############################################################################
+            //! Creates a record from the elements at the given index of the member arrays.
+            template<
+                typename TRecord,
+                typename TIdx>
+            struct MakeRecordAt
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TPtrs const & ... ptrs) const
+                -> TRecord
+                {
+                    return TRecord{ptrs[m_idx]...};
+                }
+
+                TIdx m_idx;
+            };
+
+            //#############################################################################
+            //! Creates a record of pointers advanced by the given number of elements.
+            template<
+                typename TRecord,
+                typename TIdx>
+            struct MakeRecordOffset
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TPtrs const & ... ptrs) const
+                -> TRecord
+                {
+                    return TRecord{(ptrs + m_offset)...};
+                }
+
+                TIdx m_offset;
+            };
+
+            //#############################################################################
+            //! Assigns the given values to the elements at the given index of the member arrays.
+            template<
+                typename TIdx,
+                typename... TValues>
+            struct AssignAt
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename... TPtrs>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TPtrs const & ... ptrs) const
+                -> void
+                {
+                    assign(std::index_sequence_for<TPtrs...>(), ptrs...);
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    std::size_t... TIndices,
+                    typename... TPtrs>
+                ALPAKA_FN_HOST_ACC auto assign(
+                    std::index_sequence<TIndices...> const &,
+                    TPtrs const & ... ptrs) const
+                -> void
+                {
+                    using Expander = int[];
+                    static_cast<void>(Expander{0, ((ptrs[m_idx] = std::get<TIndices>(m_values)), 0)...});
+                }
+
+            public:
+                TIdx m_idx;
+                std::tuple<TValues const & ...> m_values;
+            };
+
+            //#############################################################################
+            //! Assigns the values of the members of a record to the elements at the given index of the member arrays.
+            template<
+                typename TPtrRecord,
+                typename TIdx>
+            struct StoreAt
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename... TValues>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TValues const & ... values) const
+                -> void
+                {
+                    m_ptrs.applyToMembers(AssignAt<TIdx, TValues...>{m_idx, std::tuple<TValues const & ...>(values...)});
+                }
+
+                TPtrRecord const & m_ptrs;
+                TIdx m_idx;
+            };
+        }
+    }
+
+    namespace view
+    {
+        //#############################################################################
+        //! The accessor to the elements of a structure-of-arrays view.
+        //!
+        //! Each member of the record is stored in its own array.
+        //! The element access accessor[i] returns a record of references to the members of the element i,
+        //! so kernels can be written as for an array of structures: accessor[i].x = accessor[i].y.
+        //! Consecutive indices access consecutive memory locations of each member.
+        //!
+        //! \tparam TRecord The record class template declaring its members with ALPAKA_SOA_MEMBERS.
+        //! \tparam TConst If the accessor is read-only.
+        template<
+            template<template<typename> class> class TRecord,
+            typename TIdx,
+            bool TConst = false>
+        class AccessorSoA
+        {
+        public:
+            //! The record of pointers to the member arrays.
+            using Pointers = TRecord<soa::detail::Kinds<TConst>::template Ptr>;
+            //! The record of references to the members of an element.
+            using Reference = TRecord<soa::detail::Kinds<TConst>::template Ref>;
+            //! The record of values of the members of an element.
+            using Value = TRecord<soa::Value>;
+
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST_ACC AccessorSoA(
+                Pointers const & ptrs,
+                TIdx const & extent) :
+                    m_ptrs(ptrs),
+                    m_extent(extent)
+            {}
+
+            //-----------------------------------------------------------------------------
+            //! \return The record of references to the members of the element.
+            ALPAKA_FN_HOST_ACC auto operator[](
+                TIdx const & idx) const
+            -> Reference
+            {
+                return m_ptrs.applyToMembers(soa::detail::MakeRecordAt<Reference, TIdx>{idx});
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The values of the members of the element.
+            ALPAKA_FN_HOST_ACC auto load(
+                TIdx const & idx) const
+            -> Value
+            {
+                return m_ptrs.applyToMembers(soa::detail::MakeRecordAt<Value, TIdx>{idx});
+            }
+            //-----------------------------------------------------------------------------
+            //! Sets the values of the members of the element.
+            ALPAKA_FN_HOST_ACC auto store(
+                TIdx const & idx,
+                Value const & value) const
+            -> void
+            {
+                static_assert(
+                    !TConst,
+                    "Elements can not be stored through a read-only accessor!");
+
+                value.applyToMembers(soa::detail::StoreAt<Pointers, TIdx>{m_ptrs, idx});
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The number of elements.
+            ALPAKA_FN_HOST_ACC auto getExtent() const
+            -> TIdx
+            {
+                return m_extent;
+            }
+
+        public:
+            Pointers m_ptrs;
+            TIdx m_extent;
+        };
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The AccessorSoA dimension get trait specialization.
+        template<
+            template<template<typename> class> class TRecord,
+            typename TIdx,
+            bool TConst>
+        struct DimType<
+            view::AccessorSoA<TRecord, TIdx, TConst>>
+        {
+            using type = DimInt<1u>;
+        };
+
+        //#############################################################################
+        //! The AccessorSoA memory element type get trait specialization.
+        template<
+            template<template<typename> class> class TRecord,
+            typename TIdx,
+            bool TConst>
+        struct ElemType<
+            view::AccessorSoA<TRecord, TIdx, TConst>>
+        {
+            using type = TRecord<soa::Value>;
+        };
+
+        //#############################################################################
+        //! The AccessorSoA idx type trait specialization.
+        template<
+            template<template<typename> class> class TRecord,
+            typename TIdx,
+            bool TConst>
+        struct IdxType<
+            view::AccessorSoA<TRecord, TIdx, TConst>>
+        {
+            using type = TIdx;
+        };
+    }
+    namespace extent
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The AccessorSoA extent get trait specialization.
+            template<
+                template<template<typename> class> class TRecord,
+                typename TIdx,
+                bool TConst>
+            struct GetExtent<
+                DimInt<0u>,
+                view::AccessorSoA<TRecord, TIdx, TConst>>
+            {
+                ALPAKA_NO_HOST_ACC_WARNING
+                ALPAKA_FN_HOST_ACC static auto getExtent(
+                    view::AccessorSoA<TRecord, TIdx, TConst> const & accessor)
+                -> TIdx
+                {
+                    return accessor.getExtent();
+                }
+            };
+        }
+    }
+}
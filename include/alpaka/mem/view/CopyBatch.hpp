@@ -0,0 +1,398 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/mem/view/ViewPlainPtr.hpp>
+
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/elem/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/BoostPredef.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Debug.hpp>
+#include <alpaka/core/WorkerPool.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace alpaka
+{
+    namespace view
+    {
+        //#############################################################################
+        //! A region of a batched copy.
+        //!
+        //! The offsets are relative to the destination and source views of the batch.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct CopyRegion
+        {
+            //! The offset of the region within the destination view.
+            Vec<TDim, TIdx> m_dstOffset;
+            //! The offset of the region within the source view.
+            Vec<TDim, TIdx> m_srcOffset;
+            //! The extent of the region.
+            Vec<TDim, TIdx> m_extent;
+        };
+
+        namespace detail
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The distance in bytes of the element at the given offset from the first element of a view with the given pitches.
+            template<
+                typename TElem,
+                typename TPitchBytes,
+                typename TOffset>
+            ALPAKA_FN_HOST auto getRegionOffsetBytes(
+                TPitchBytes const & pitchBytes,
+                TOffset const & offset)
+            -> std::size_t
+            {
+                constexpr auto lastDim = Dim<TOffset>::value - 1u;
+
+                // The distance between consecutive elements of dimension d is the pitch of dimension d + 1.
+                auto offsetBytes(static_cast<std::size_t>(offset[lastDim]) * sizeof(TElem));
+                for(std::size_t d(0u); d < lastDim; ++d)
+                {
+                    offsetBytes += static_cast<std::size_t>(offset[d]) * static_cast<std::size_t>(pitchBytes[d + 1u]);
+                }
+                return offsetBytes;
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Throws if the region at the given offset exceeds the view.
+            template<
+                typename TView,
+                typename TOffset,
+                typename TExtent>
+            ALPAKA_FN_HOST auto checkRegion(
+                TView const & view,
+                TOffset const & offset,
+                TExtent const & extent)
+            -> void
+            {
+                auto const viewExtent(extent::getExtentVec(view));
+                for(std::size_t d(0u); d < Dim<TOffset>::value; ++d)
+                {
+                    if((offset[d] > viewExtent[d]) || (extent[d] > viewExtent[d] - offset[d]))
+                    {
+                        throw std::runtime_error("A region of the batched copy exceeds the extent of its view!");
+                    }
+                }
+            }
+
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align" // "cast from 'std::uint8_t*' to 'TElem*' increases required alignment of target type"
+#endif
+            //-----------------------------------------------------------------------------
+            //! \return A view of the region of the view starting at the given offset.
+            template<
+                typename TElem,
+                typename TView,
+                typename TOffset,
+                typename TExtent>
+            ALPAKA_FN_HOST auto createRegionView(
+                TView & view,
+                TOffset const & offset,
+                TExtent const & extent)
+            -> ViewPlainPtr<Dev<std::decay_t<TView>>, TElem, Dim<std::decay_t<TView>>, Idx<std::decay_t<TView>>>
+            {
+                using Dev = alpaka::Dev<std::decay_t<TView>>;
+                using Dim = alpaka::Dim<std::decay_t<TView>>;
+                using Idx = alpaka::Idx<std::decay_t<TView>>;
+
+                auto const pitchBytes(view::getPitchBytesVec(view));
+
+                using Byte = std::conditional_t<std::is_const<TElem>::value, std::uint8_t const, std::uint8_t>;
+                auto * const pBytes(reinterpret_cast<Byte *>(view::getPtrNative(view)) + getRegionOffsetBytes<TElem>(pitchBytes, offset));
+
+                return
+                    ViewPlainPtr<Dev, TElem, Dim, Idx>(
+                        reinterpret_cast<TElem *>(pBytes),
+                        getDev(view),
+                        extent,
+                        pitchBytes);
+            }
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic pop
+#endif
+
+            //#############################################################################
+            //! The batched memory copy task.
+            //!
+            //! Executes the copy tasks of all regions in order as a single task.
+            template<
+                typename TTask>
+            struct TaskCopyBatch
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()() const
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    for(auto const & task : m_tasks)
+                    {
+                        task();
+                    }
+                }
+
+                std::vector<TTask> m_tasks;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The copy tasks of all regions.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TRegions>
+            ALPAKA_FN_HOST auto createTasksCopyRegions(
+                TViewDst & viewDst,
+                TViewSrc const & viewSrc,
+                TRegions const & regions)
+            {
+                using Elem = alpaka::Elem<TViewDst>;
+                using ViewDst = ViewPlainPtr<Dev<TViewDst>, Elem, Dim<TViewDst>, Idx<TViewDst>>;
+                using ViewSrc = ViewPlainPtr<Dev<TViewSrc>, Elem const, Dim<TViewSrc>, Idx<TViewSrc>>;
+                using Extent = Vec<Dim<TViewDst>, Idx<TViewDst>>;
+                using Task = decltype(view::createTaskCopy(std::declval<ViewDst &>(), std::declval<ViewSrc const &>(), std::declval<Extent const &>()));
+
+                std::vector<Task> tasks;
+                tasks.reserve(regions.size());
+                for(auto const & region : regions)
+                {
+                    checkRegion(viewDst, region.m_dstOffset, region.m_extent);
+                    checkRegion(viewSrc, region.m_srcOffset, region.m_extent);
+
+                    auto regionDst(createRegionView<Elem>(viewDst, region.m_dstOffset, region.m_extent));
+                    auto const regionSrc(createRegionView<Elem const>(viewSrc, region.m_srcOffset, region.m_extent));
+                    tasks.emplace_back(view::createTaskCopy(regionDst, regionSrc, region.m_extent));
+                }
+                return tasks;
+            }
+
+            //#############################################################################
+            //! The batched memory copy task of devices whose copies are issued by host threads.
+            //!
+            //! Distributes the regions across the threads of the worker pool in contiguous chunks of about the same number of bytes.
+            template<
+                typename TTask>
+            struct TaskCopyBatchParallel
+            {
+                //! The minimal number of bytes copied by a thread.
+                static constexpr std::size_t minBytesPerThread = 64u * 1024u;
+
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()() const
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    std::size_t totalBytes(0u);
+                    for(auto const & bytes : m_regionBytes)
+                    {
+                        totalBytes += bytes;
+                    }
+
+                    auto & workerPool(core::detail::WorkerPool::getInstance());
+                    std::size_t const threadCount(
+                        std::min(
+                            {
+                                workerPool.getWorkerCount(),
+                                m_tasks.size(),
+                                totalBytes / minBytesPerThread
+                            }));
+
+                    if(threadCount <= 1u)
+                    {
+                        copyRegions(0u, m_tasks.size());
+                        return;
+                    }
+
+                    // Split the regions at the multiples of the bytes per thread.
+                    std::vector<std::size_t> chunkBegins;
+                    chunkBegins.reserve(threadCount + 1u);
+                    chunkBegins.push_back(0u);
+                    std::size_t cumulativeBytes(0u);
+                    for(std::size_t i(0u); i < m_tasks.size(); ++i)
+                    {
+                        cumulativeBytes += m_regionBytes[i];
+                        while((chunkBegins.size() < threadCount) && (cumulativeBytes * threadCount >= totalBytes * chunkBegins.size()))
+                        {
+                            chunkBegins.push_back(i + 1u);
+                        }
+                    }
+                    chunkBegins.resize(threadCount + 1u, m_tasks.size());
+
+                    workerPool.run(
+                        threadCount,
+                        [this, &chunkBegins](std::size_t const workerIdx)
+                        {
+                            copyRegions(chunkBegins[workerIdx], chunkBegins[workerIdx + 1u]);
+                        });
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto copyRegions(
+                    std::size_t const begin,
+                    std::size_t const end) const
+                -> void
+                {
+                    for(std::size_t i(begin); i < end; ++i)
+                    {
+                        m_tasks[i]();
+                    }
+                }
+
+            public:
+                std::vector<TTask> m_tasks;
+                //! The number of bytes of each region.
+                std::vector<std::size_t> m_regionBytes;
+            };
+            template<
+                typename TTask>
+            constexpr std::size_t TaskCopyBatchParallel<TTask>::minBytesPerThread;
+
+            //-----------------------------------------------------------------------------
+            //! \return The batched memory copy task executing the copy tasks of the regions in parallel.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TRegions>
+            ALPAKA_FN_HOST auto createTaskCopyBatchParallel(
+                TViewDst & viewDst,
+                TViewSrc const & viewSrc,
+                TRegions const & regions)
+            {
+                auto tasks(createTasksCopyRegions(viewDst, viewSrc, regions));
+
+                std::vector<std::size_t> regionBytes;
+                regionBytes.reserve(regions.size());
+                for(auto const & region : regions)
+                {
+                    regionBytes.push_back(static_cast<std::size_t>(region.m_extent.prod()) * sizeof(Elem<TViewDst>));
+                }
+
+                return
+                    TaskCopyBatchParallel<typename decltype(tasks)::value_type>{
+                        std::move(tasks),
+                        std::move(regionBytes)};
+            }
+        }
+
+        namespace traits
+        {
+            //#############################################################################
+            //! The batched memory copy task trait.
+            //!
+            //! The default implementation executes the copy tasks of the regions one after another within a single task.
+            template<
+                typename TDim,
+                typename TDevDst,
+                typename TDevSrc,
+                typename TSfinae = void>
+            struct CreateTaskCopyBatch
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewDst,
+                    typename TViewSrc,
+                    typename TRegions>
+                ALPAKA_FN_HOST static auto createTaskCopyBatch(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TRegions const & regions)
+                {
+                    auto tasks(view::detail::createTasksCopyRegions(viewDst, viewSrc, regions));
+                    return view::detail::TaskCopyBatch<typename decltype(tasks)::value_type>{std::move(tasks)};
+                }
+            };
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Creates a task copying many regions between two views.
+        //!
+        //! Enqueueing a single task for many small regions, e.g. halos or sub-blocks, avoids the overhead of a task per region.
+        //!
+        //! \param viewDst The destination memory view.
+        //! \param viewSrc The source memory view.
+        //! \param regions The container of CopyRegion<Dim, Idx> describing the regions to copy.
+        //!        The destination regions must not overlap.
+        template<
+            typename TViewDst,
+            typename TViewSrc,
+            typename TRegions>
+        ALPAKA_FN_HOST auto createTaskCopyBatch(
+            TViewDst & viewDst,
+            TViewSrc const & viewSrc,
+            TRegions const & regions)
+        {
+            static_assert(
+                Dim<TViewDst>::value == Dim<TViewSrc>::value,
+                "The source and the destination view are required to have the same dimensionality!");
+            static_assert(
+                std::is_same<Elem<TViewDst>, std::remove_const_t<Elem<TViewSrc>>>::value,
+                "The source and the destination view are required to have the same element type!");
+            static_assert(
+                std::is_same<typename TRegions::value_type, CopyRegion<Dim<TViewDst>, Idx<TViewDst>>>::value,
+                "The regions are required to be of the dimensionality and the idx type of the views!");
+
+            return
+                traits::CreateTaskCopyBatch<
+                    Dim<TViewDst>,
+                    Dev<TViewDst>,
+                    Dev<TViewSrc>>
+                ::createTaskCopyBatch(
+                    viewDst,
+                    viewSrc,
+                    regions);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Copies many regions between two views possibly in different memory spaces as a single task.
+        //!
+        //! \param queue The queue to enqueue the batched copy task into.
+        //! \param viewDst The destination memory view.
+        //! \param viewSrc The source memory view.
+        //! \param regions The container of CopyRegion<Dim, Idx> describing the regions to copy.
+        template<
+            typename TViewDst,
+            typename TViewSrc,
+            typename TRegions,
+            typename TQueue>
+        ALPAKA_FN_HOST auto copyBatch(
+            TQueue & queue,
+            TViewDst & viewDst,
+            TViewSrc const & viewSrc,
+            TRegions const & regions)
+        -> void
+        {
+            enqueue(
+                queue,
+                view::createTaskCopyBatch(
+                    viewDst,
+                    viewSrc,
+                    regions));
+        }
+    }
+}
@@ -0,0 +1,310 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/idx/MapIdx.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace alpaka
+{
+    namespace view
+    {
+        //-----------------------------------------------------------------------------
+        //! The memory layouts mapping N dimensional element indices to linear element offsets.
+        //!
+        //! Each layout policy provides a nested Mapping<TDim, TIdx> class template.
+        //! A mapping is created from the extent of the view and provides:
+        //! * operator()(Vec<TDim, TIdx> idx) returning the element offset of the index.
+        //! * getElemCount() returning the number of elements the storage requires including padding.
+        //! Mappings are trivially copyable so they can be passed to kernels as part of an Accessor.
+        namespace layout
+        {
+            namespace detail
+            {
+                //-----------------------------------------------------------------------------
+                //! \return The product of the values.
+                template<
+                    std::size_t... Tvals>
+                constexpr auto product()
+                -> std::size_t
+                {
+                    std::size_t result(1u);
+                    for(std::size_t const val : {Tvals...})
+                    {
+                        result *= val;
+                    }
+                    return result;
+                }
+            }
+
+            //#############################################################################
+            //! The row-major layout where the last dimension is contiguous.
+            //!
+            //! This is the native layout of all alpaka buffers and views.
+            //! The rows can be padded by a pitch.
+            struct RowMajor
+            {
+                //#############################################################################
+                template<
+                    typename TDim,
+                    typename TIdx>
+                class Mapping
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    //! Creates a mapping without padding.
+                    ALPAKA_FN_HOST_ACC explicit Mapping(
+                        Vec<TDim, TIdx> const & extent) :
+                            m_extent(extent),
+                            m_pitchElems(Vec<TDim, TIdx>::ones())
+                    {
+                        for(std::size_t d(TDim::value); d > 1u; --d)
+                        {
+                            m_pitchElems[d - 2u] = static_cast<TIdx>(m_pitchElems[d - 1u] * m_extent[d - 1u]);
+                        }
+                    }
+                    //-----------------------------------------------------------------------------
+                    //! Creates a mapping with the given distances between consecutive elements in each dimension.
+                    ALPAKA_FN_HOST_ACC Mapping(
+                        Vec<TDim, TIdx> const & extent,
+                        Vec<TDim, TIdx> const & pitchElems) :
+                            m_extent(extent),
+                            m_pitchElems(pitchElems)
+                    {}
+
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto operator()(
+                        Vec<TDim, TIdx> const & idx) const
+                    -> TIdx
+                    {
+                        TIdx offset(static_cast<TIdx>(0u));
+                        for(std::size_t d(0u); d < TDim::value; ++d)
+                        {
+                            offset = static_cast<TIdx>(offset + idx[d] * m_pitchElems[d]);
+                        }
+                        return offset;
+                    }
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto getElemCount() const
+                    -> TIdx
+                    {
+                        return static_cast<TIdx>(m_extent[0u] * m_pitchElems[0u]);
+                    }
+
+                    Vec<TDim, TIdx> m_extent;
+                    //! The distance in elements between two consecutive elements in each dimension.
+                    Vec<TDim, TIdx> m_pitchElems;
+                };
+            };
+
+            //#############################################################################
+            //! The column-major layout where the first dimension is contiguous.
+            struct ColMajor
+            {
+                //#############################################################################
+                template<
+                    typename TDim,
+                    typename TIdx>
+                class Mapping
+                {
+                public:
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC explicit Mapping(
+                        Vec<TDim, TIdx> const & extent) :
+                            m_extent(extent)
+                    {}
+
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto operator()(
+                        Vec<TDim, TIdx> const & idx) const
+                    -> TIdx
+                    {
+                        TIdx offset(static_cast<TIdx>(0u));
+                        for(std::size_t d(TDim::value); d > 0u; --d)
+                        {
+                            offset = static_cast<TIdx>(offset * m_extent[d - 1u] + idx[d - 1u]);
+                        }
+                        return offset;
+                    }
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto getElemCount() const
+                    -> TIdx
+                    {
+                        return m_extent.prod();
+                    }
+
+                    Vec<TDim, TIdx> m_extent;
+                };
+            };
+
+            //#############################################################################
+            //! The tiled layout storing row-major tiles of the given extent one after another in row-major order.
+            //!
+            //! Elements close to each other in all dimensions share cache lines and pages.
+            //! The extent is padded to a multiple of the tile extent.
+            //!
+            //! \tparam TtileExtent The tile extent in each dimension.
+            template<
+                std::size_t... TtileExtent>
+            struct Tiled
+            {
+                //#############################################################################
+                template<
+                    typename TDim,
+                    typename TIdx>
+                class Mapping
+                {
+                    static_assert(
+                        TDim::value == sizeof...(TtileExtent),
+                        "The dimension of the tile extent has to be identical to the dimension of the view!");
+
+                public:
+                    using TileExtent = std::integer_sequence<TIdx, static_cast<TIdx>(TtileExtent)...>;
+
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC explicit Mapping(
+                        Vec<TDim, TIdx> const & extent) :
+                            m_extent(extent),
+                            m_tileGridExtent(Vec<TDim, TIdx>::zeros())
+                    {
+                        Vec<TDim, TIdx> const tileExtent(static_cast<TIdx>(TtileExtent)...);
+                        for(std::size_t d(0u); d < TDim::value; ++d)
+                        {
+                            m_tileGridExtent[d] = static_cast<TIdx>((m_extent[d] + tileExtent[d] - 1u) / tileExtent[d]);
+                        }
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto operator()(
+                        Vec<TDim, TIdx> const & idx) const
+                    -> TIdx
+                    {
+                        Vec<TDim, TIdx> const tileExtent(static_cast<TIdx>(TtileExtent)...);
+                        Vec<TDim, TIdx> tileIdx(Vec<TDim, TIdx>::zeros());
+                        Vec<TDim, TIdx> tileElemIdx(Vec<TDim, TIdx>::zeros());
+                        for(std::size_t d(0u); d < TDim::value; ++d)
+                        {
+                            tileIdx[d] = static_cast<TIdx>(idx[d] / tileExtent[d]);
+                            tileElemIdx[d] = static_cast<TIdx>(idx[d] % tileExtent[d]);
+                        }
+                        return
+                            static_cast<TIdx>(
+                                mapIdx<1u>(tileIdx, m_tileGridExtent)[0u] * tileElemCount
+                                + mapIdx<1u>(tileElemIdx, TileExtent())[0u]);
+                    }
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto getElemCount() const
+                    -> TIdx
+                    {
+                        return static_cast<TIdx>(m_tileGridExtent.prod() * tileElemCount);
+                    }
+
+                    //! The number of elements of a tile.
+                    static constexpr TIdx tileElemCount = static_cast<TIdx>(detail::product<TtileExtent...>());
+
+                    Vec<TDim, TIdx> m_extent;
+                    //! The number of tiles in each dimension.
+                    Vec<TDim, TIdx> m_tileGridExtent;
+                };
+            };
+            template<
+                std::size_t... TtileExtent>
+            template<
+                typename TDim,
+                typename TIdx>
+            constexpr TIdx Tiled<TtileExtent...>::Mapping<TDim, TIdx>::tileElemCount;
+
+            //#############################################################################
+            //! The Z-order (Morton) layout interleaving the bits of the indices of all dimensions.
+            //!
+            //! Elements close to each other in all dimensions are close in memory on all scales.
+            //! The extent of each dimension is padded to the smallest power of two containing it.
+            //! The bits of a dimension are only interleaved as long as the dimension has bits left, the remaining bits of the longer dimensions follow each other.
+            //! Therefore elongated extents are not padded to a cube.
+            struct Morton
+            {
+                //#############################################################################
+                template<
+                    typename TDim,
+                    typename TIdx>
+                class Mapping
+                {
+                    static_assert(
+                        TDim::value > 0u && TDim::value <= 3u,
+                        "The Morton layout supports one to three dimensions!");
+
+                public:
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC explicit Mapping(
+                        Vec<TDim, TIdx> const & extent) :
+                            m_extent(extent),
+                            m_bitCounts(Vec<TDim, TIdx>::zeros()),
+                            m_bitCountMax(0u),
+                            m_bitCountSum(0u)
+                    {
+                        for(std::size_t d(0u); d < TDim::value; ++d)
+                        {
+                            while((static_cast<TIdx>(1u) << m_bitCounts[d]) < m_extent[d])
+                            {
+                                ++m_bitCounts[d];
+                            }
+                            m_bitCountMax = (static_cast<std::size_t>(m_bitCounts[d]) > m_bitCountMax) ? static_cast<std::size_t>(m_bitCounts[d]) : m_bitCountMax;
+                            m_bitCountSum += static_cast<std::size_t>(m_bitCounts[d]);
+                        }
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto operator()(
+                        Vec<TDim, TIdx> const & idx) const
+                    -> TIdx
+                    {
+                        // The last dimension occupies the lowest bit of each group as it is the fastest dimension of the row-major index space.
+                        TIdx offset(static_cast<TIdx>(0u));
+                        std::size_t offsetBit(0u);
+                        for(std::size_t b(0u); b < m_bitCountMax; ++b)
+                        {
+                            for(std::size_t d(TDim::value); d > 0u; --d)
+                            {
+                                if(b < static_cast<std::size_t>(m_bitCounts[d - 1u]))
+                                {
+                                    TIdx const bit(static_cast<TIdx>((idx[d - 1u] >> b) & static_cast<TIdx>(1u)));
+                                    offset = static_cast<TIdx>(offset | (bit << offsetBit));
+                                    ++offsetBit;
+                                }
+                            }
+                        }
+                        return offset;
+                    }
+                    //-----------------------------------------------------------------------------
+                    ALPAKA_FN_HOST_ACC auto getElemCount() const
+                    -> TIdx
+                    {
+                        return (m_extent.prod() == static_cast<TIdx>(0u)) ? static_cast<TIdx>(0u) : static_cast<TIdx>(static_cast<TIdx>(1u) << m_bitCountSum);
+                    }
+
+                    Vec<TDim, TIdx> m_extent;
+                    //! The number of bits of the padded extent in each dimension.
+                    Vec<TDim, TIdx> m_bitCounts;
+                    //! The maximum number of bits of all dimensions.
+                    std::size_t m_bitCountMax;
+                    //! The number of bits of all dimensions together.
+                    std::size_t m_bitCountSum;
+                };
+            };
+        }
+    }
+}
@@ -145,6 +145,16 @@ namespace alpaka
                 typename TSfinae = void>
             struct CreateTaskSet;
 
+            //#############################################################################
+            //! The memory fill task trait.
+            //!
+            //! Fills the view with copies of an element value.
+            template<
+                typename TDim,
+                typename TDev,
+                typename TSfinae = void>
+            struct CreateTaskFill;
+
             //#############################################################################
             //! The memory copy task trait.
             //!
@@ -156,6 +166,37 @@ namespace alpaka
                 typename TSfinae = void>
             struct CreateTaskCopy;
 
+            //#############################################################################
+            //! The memory copy task trait for a pair of view types.
+            //!
+            //! The default implementation forwards to the CreateTaskCopy trait of the dimension and the devices.
+            //! It is specialized for views whose elements are not stored in pitched row-major order.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TSfinae = void>
+            struct CreateTaskCopyViews
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    TViewDst & viewDst,
+                    TViewSrc const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return
+                        CreateTaskCopy<
+                            Dim<TViewDst>,
+                            Dev<TViewDst>,
+                            Dev<TViewSrc>>
+                        ::createTaskCopy(
+                            viewDst,
+                            viewSrc,
+                            extent);
+                }
+            };
+
             //#############################################################################
             //! The static device memory view creation trait.
             template<
@@ -317,6 +358,87 @@ namespace alpaka
                     extent));
         }
 
+        //-----------------------------------------------------------------------------
+        //! Creates a memory fill task.
+        //!
+        //! In contrast to a memory set task, each element of the view is set to the given value instead of each byte.
+        //!
+        //! \param view The memory view to fill.
+        //! \param value Value to set for each element of the specified view.
+        //! \param extent The extent of the view to fill.
+        template<
+            typename TExtent,
+            typename TView>
+        ALPAKA_FN_HOST auto createTaskFill(
+            TView & view,
+            Elem<TView> const & value,
+            TExtent const & extent)
+        {
+            static_assert(
+                Dim<TView>::value == Dim<TExtent>::value,
+                "The view and the extent are required to have the same dimensionality!");
+            static_assert(
+                std::is_trivially_copyable<Elem<TView>>::value,
+                "Only views with trivially copyable elements can be filled!");
+
+            return
+                traits::CreateTaskFill<
+                    Dim<TView>,
+                    Dev<TView>>
+                ::createTaskFill(
+                    view,
+                    value,
+                    extent);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Fills the memory with the given element value.
+        //!
+        //! \param queue The queue to enqueue the view fill task into.
+        //! \param view The memory view to fill.
+        //! \param value Value to set for each element of the specified view.
+        //! \param extent The extent of the view to fill.
+        template<
+            typename TExtent,
+            typename TView,
+            typename TQueue>
+        ALPAKA_FN_HOST auto fill(
+            TQueue & queue,
+            TView & view,
+            Elem<TView> const & value,
+            TExtent const & extent)
+        -> void
+        {
+            enqueue(
+                queue,
+                view::createTaskFill(
+                    view,
+                    value,
+                    extent));
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Fills the whole memory view with the given element value.
+        //!
+        //! \param queue The queue to enqueue the view fill task into.
+        //! \param view The memory view to fill.
+        //! \param value Value to set for each element of the view.
+        template<
+            typename TView,
+            typename TQueue>
+        ALPAKA_FN_HOST auto fill(
+            TQueue & queue,
+            TView & view,
+            Elem<TView> const & value)
+        -> void
+        {
+            view::fill(
+                queue,
+                view,
+                value,
+                extent::getExtentVec(view));
+        }
+
         //-----------------------------------------------------------------------------
         //! Creates a memory copy task.
         //!
@@ -343,10 +465,9 @@ namespace alpaka
                 "The source and the destination view are required to have the same element type!");
 
             return
-                traits::CreateTaskCopy<
-                    Dim<TViewDst>,
-                    Dev<TViewDst>,
-                    Dev<TViewSrc>>
+                traits::CreateTaskCopyViews<
+                    TViewDst,
+                    TViewSrc>
                 ::createTaskCopy(
                     viewDst,
                     viewSrc,
@@ -0,0 +1,470 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/mem/view/Accessor.hpp>
+#include <alpaka/mem/view/Layout.hpp>
+#include <alpaka/mem/view/Traits.hpp>
+#include <alpaka/mem/buf/Traits.hpp>
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dim/DimIntegralConst.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/meta/NdLoop.hpp>
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Debug.hpp>
+
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace view
+    {
+        //#############################################################################
+        //! A memory view owning a buffer whose elements are stored in the given layout.
+        //!
+        //! The elements are stored in a one dimensional buffer of the size required by the layout mapping.
+        //! Kernels access the elements through view::getAccessor(view).
+        //! Copies between views of the same layout copy the storage and are supported between all devices.
+        //! Copies converting between different layouts are executed element-wise on the host and require CPU devices.
+        //!
+        //! \tparam TLayout The layout policy, e.g. layout::RowMajor, layout::ColMajor, layout::Tiled<...> or layout::Morton.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        class ViewLayout
+        {
+        public:
+            using Layout = TLayout;
+            using Mapping = typename TLayout::template Mapping<TDim, TIdx>;
+            using Storage = Buf<TDev, TElem, DimInt<1u>, TIdx>;
+
+            //-----------------------------------------------------------------------------
+            template<
+                typename TExtent>
+            ALPAKA_FN_HOST ViewLayout(
+                TDev const & dev,
+                TExtent const & extent) :
+                    m_mapping(extent::getExtentVecEnd<TDim>(extent)),
+                    m_storage(
+                        allocBuf<TElem, TIdx>(
+                            dev,
+                            Vec<DimInt<1u>, TIdx>(m_mapping.getElemCount())))
+            {}
+
+            //-----------------------------------------------------------------------------
+            //! \return The one dimensional buffer storing the elements.
+            ALPAKA_FN_HOST auto getStorage()
+            -> Storage &
+            {
+                return m_storage;
+            }
+            //-----------------------------------------------------------------------------
+            //! \return The one dimensional buffer storing the elements.
+            ALPAKA_FN_HOST auto getStorage() const
+            -> Storage const &
+            {
+                return m_storage;
+            }
+
+        public:
+            Mapping m_mapping;
+            Storage m_storage;
+        };
+
+        //-----------------------------------------------------------------------------
+        //! Allocates a view storing its elements in the given layout.
+        //!
+        //! \tparam TElem The element type of the returned view.
+        //! \tparam TIdx The linear index type of the view.
+        //! \tparam TLayout The layout policy of the view.
+        //! \param dev The device to allocate the view on.
+        //! \param extent The extent of the view.
+        template<
+            typename TElem,
+            typename TIdx,
+            typename TLayout,
+            typename TExtent,
+            typename TDev>
+        ALPAKA_FN_HOST auto allocBufLayout(
+            TDev const & dev,
+            TExtent const & extent = TExtent())
+        -> ViewLayout<TDev, TElem, Dim<TExtent>, TIdx, TLayout>
+        {
+            return ViewLayout<TDev, TElem, Dim<TExtent>, TIdx, TLayout>(dev, extent);
+        }
+
+        namespace detail
+        {
+            //#############################################################################
+            //! The host memory copy task converting between layouts.
+            //!
+            //! Copies element-wise from one accessor to another.
+            template<
+                typename TAccessorDst,
+                typename TAccessorSrc>
+            struct TaskCopyLayoutCpu
+            {
+                using Dim = alpaka::Dim<TAccessorDst>;
+                using Idx = alpaka::Idx<TAccessorDst>;
+
+                //-----------------------------------------------------------------------------
+                TaskCopyLayoutCpu(
+                    TAccessorDst const & accessorDst,
+                    TAccessorSrc const & accessorSrc,
+                    Vec<Dim, Idx> const & extent) :
+                        m_accessorDst(accessorDst),
+                        m_accessorSrc(accessorSrc),
+                        m_extent(extent)
+                {}
+
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST auto operator()() const
+                -> void
+                {
+                    ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                    meta::ndLoopIncIdx(
+                        m_extent,
+                        [this](Vec<Dim, Idx> const & idx)
+                        {
+                            m_accessorDst(idx) = m_accessorSrc(idx);
+                        });
+                }
+
+                TAccessorDst const m_accessorDst;
+                TAccessorSrc const m_accessorSrc;
+                Vec<Dim, Idx> const m_extent;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The host task copying between the views element-wise.
+            template<
+                typename TViewDst,
+                typename TViewSrc,
+                typename TExtent>
+            ALPAKA_FN_HOST auto createTaskCopyLayoutCpu(
+                TViewDst & viewDst,
+                TViewSrc const & viewSrc,
+                TExtent const & extent)
+            {
+                static_assert(
+                    std::is_same<alpaka::Dev<TViewDst>, DevCpu>::value && std::is_same<alpaka::Dev<TViewSrc>, DevCpu>::value,
+                    "Copies converting between different memory layouts are only supported between CPU views!");
+
+                auto const accessorDst(view::getAccessor(viewDst));
+                auto const accessorSrc(view::getAccessor(viewSrc));
+                auto const extentVec(extent::getExtentVec(extent));
+
+                if(!(extentVec <= extent::getExtentVec(viewDst)).foldrAll(std::logical_and<bool>())
+                    || !(extentVec <= extent::getExtentVec(viewSrc)).foldrAll(std::logical_and<bool>()))
+                {
+                    throw std::runtime_error("The extent of the copy exceeds the extent of the views!");
+                }
+
+                return
+                    TaskCopyLayoutCpu<
+                        std::decay_t<decltype(accessorDst)>,
+                        std::decay_t<decltype(accessorSrc)>>(
+                            accessorDst,
+                            accessorSrc,
+                            extentVec);
+            }
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    // Trait specializations for ViewLayout.
+    namespace traits
+    {
+        //#############################################################################
+        //! The ViewLayout device type trait specialization.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        struct DevType<
+            view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+        {
+            using type = alpaka::Dev<TDev>;
+        };
+
+        //#############################################################################
+        //! The ViewLayout device get trait specialization.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        struct GetDev<
+            view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+        {
+            ALPAKA_FN_HOST static auto getDev(
+                view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout> const & view)
+            -> alpaka::Dev<TDev>
+            {
+                return alpaka::getDev(view.getStorage());
+            }
+        };
+
+        //#############################################################################
+        //! The ViewLayout dimension getter trait.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        struct DimType<
+            view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The ViewLayout memory element type get trait specialization.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        struct ElemType<
+            view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+        {
+            using type = TElem;
+        };
+
+        //#############################################################################
+        //! The ViewLayout idx type trait specialization.
+        template<
+            typename TDev,
+            typename TElem,
+            typename TDim,
+            typename TIdx,
+            typename TLayout>
+        struct IdxType<
+            view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+        {
+            using type = TIdx;
+        };
+    }
+    namespace extent
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The ViewLayout extent get trait specialization.
+            template<
+                typename TIdxIntegralConst,
+                typename TDev,
+                typename TElem,
+                typename TDim,
+                typename TIdx,
+                typename TLayout>
+            struct GetExtent<
+                TIdxIntegralConst,
+                view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>,
+                std::enable_if_t<(TDim::value > TIdxIntegralConst::value)>>
+            {
+                ALPAKA_FN_HOST static auto getExtent(
+                    view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout> const & view)
+                -> TIdx
+                {
+                    return view.m_mapping.m_extent[TIdxIntegralConst::value];
+                }
+            };
+        }
+    }
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The ViewLayout native pointer get trait specialization.
+            //!
+            //! The native pointer points to the beginning of the storage.
+            template<
+                typename TDev,
+                typename TElem,
+                typename TDim,
+                typename TIdx,
+                typename TLayout>
+            struct GetPtrNative<
+                view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+            {
+                ALPAKA_FN_HOST static auto getPtrNative(
+                    view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout> const & view)
+                -> TElem const *
+                {
+                    return view::getPtrNative(view.getStorage());
+                }
+                ALPAKA_FN_HOST static auto getPtrNative(
+                    view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout> & view)
+                -> TElem *
+                {
+                    return view::getPtrNative(view.getStorage());
+                }
+            };
+
+            //#############################################################################
+            //! The ViewLayout accessor get trait specialization.
+            template<
+                typename TDev,
+                typename TElem,
+                typename TDim,
+                typename TIdx,
+                typename TLayout>
+            struct GetAccessor<
+                view::ViewLayout<TDev, TElem, TDim, TIdx, TLayout>>
+            {
+                using Mapping = typename TLayout::template Mapping<TDim, TIdx>;
+
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TViewQualified>
+                ALPAKA_FN_HOST static auto getAccessor(
+                    TViewQualified & view)
+                {
+                    using Elem = std::remove_pointer_t<decltype(view::getPtrNative(view))>;
+
+                    return
+                        Accessor<Elem, TDim, TIdx, Mapping>(
+                            view::getPtrNative(view),
+                            view.m_mapping);
+                }
+            };
+
+            //#############################################################################
+            //! The copy trait specialization into a ViewLayout.
+            template<
+                typename TDevDst,
+                typename TElemDst,
+                typename TDim,
+                typename TIdxDst,
+                typename TLayoutDst,
+                typename TViewSrc>
+            struct CreateTaskCopyViews<
+                view::ViewLayout<TDevDst, TElemDst, TDim, TIdxDst, TLayoutDst>,
+                TViewSrc>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    view::ViewLayout<TDevDst, TElemDst, TDim, TIdxDst, TLayoutDst> & viewDst,
+                    TViewSrc const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return view::detail::createTaskCopyLayoutCpu(viewDst, viewSrc, extent);
+                }
+            };
+
+            //#############################################################################
+            //! The copy trait specialization from a ViewLayout.
+            template<
+                typename TViewDst,
+                typename TDevSrc,
+                typename TElemSrc,
+                typename TDim,
+                typename TIdxSrc,
+                typename TLayoutSrc>
+            struct CreateTaskCopyViews<
+                TViewDst,
+                view::ViewLayout<TDevSrc, TElemSrc, TDim, TIdxSrc, TLayoutSrc>>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    TViewDst & viewDst,
+                    view::ViewLayout<TDevSrc, TElemSrc, TDim, TIdxSrc, TLayoutSrc> const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return view::detail::createTaskCopyLayoutCpu(viewDst, viewSrc, extent);
+                }
+            };
+
+            //#############################################################################
+            //! The copy trait specialization between ViewLayouts of different layouts.
+            template<
+                typename TDevDst,
+                typename TElemDst,
+                typename TDim,
+                typename TIdxDst,
+                typename TLayoutDst,
+                typename TDevSrc,
+                typename TElemSrc,
+                typename TIdxSrc,
+                typename TLayoutSrc>
+            struct CreateTaskCopyViews<
+                view::ViewLayout<TDevDst, TElemDst, TDim, TIdxDst, TLayoutDst>,
+                view::ViewLayout<TDevSrc, TElemSrc, TDim, TIdxSrc, TLayoutSrc>>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    view::ViewLayout<TDevDst, TElemDst, TDim, TIdxDst, TLayoutDst> & viewDst,
+                    view::ViewLayout<TDevSrc, TElemSrc, TDim, TIdxSrc, TLayoutSrc> const & viewSrc,
+                    TExtent const & extent)
+                {
+                    return view::detail::createTaskCopyLayoutCpu(viewDst, viewSrc, extent);
+                }
+            };
+
+            //#############################################################################
+            //! The copy trait specialization between ViewLayouts of the same layout.
+            //!
+            //! The storage is copied as a whole so this is supported between all devices.
+            template<
+                typename TDevDst,
+                typename TElem,
+                typename TDim,
+                typename TIdx,
+                typename TLayout,
+                typename TDevSrc>
+            struct CreateTaskCopyViews<
+                view::ViewLayout<TDevDst, TElem, TDim, TIdx, TLayout>,
+                view::ViewLayout<TDevSrc, TElem, TDim, TIdx, TLayout>>
+            {
+                //-----------------------------------------------------------------------------
+                template<
+                    typename TExtent>
+                ALPAKA_FN_HOST static auto createTaskCopy(
+                    view::ViewLayout<TDevDst, TElem, TDim, TIdx, TLayout> & viewDst,
+                    view::ViewLayout<TDevSrc, TElem, TDim, TIdx, TLayout> const & viewSrc,
+                    TExtent const & extent)
+                {
+                    auto const extentVec(extent::getExtentVec(extent));
+                    if(!(extentVec == extent::getExtentVec(viewDst)) || !(extentVec == extent::getExtentVec(viewSrc)))
+                    {
+                        throw std::runtime_error("Copies between views of the same layout have to copy the whole views!");
+                    }
+
+                    return
+                        view::createTaskCopy(
+                            viewDst.getStorage(),
+                            viewSrc.getStorage(),
+                            extent::getExtentVec(viewSrc.getStorage()));
+                }
+            };
+        }
+    }
+}
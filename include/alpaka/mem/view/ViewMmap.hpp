@@ -0,0 +1,501 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if BOOST_OS_UNIX || BOOST_OS_MACOS
+
+#include <alpaka/mem/view/Traits.hpp>
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace view
+    {
+        //#############################################################################
+        //! The visibility of changes to a memory mapped file.
+        enum class MmapSharing
+        {
+            Shared,     //!< Changes are written back to the file and are visible to other mappings of the file.
+            Private     //!< Changes are private copy-on-write pages and never written back to the file.
+        };
+
+        //#############################################################################
+        //! The access pattern hint given to the operating system for a memory mapped file.
+        enum class MmapAdvice
+        {
+            Normal,     //!< No special treatment.
+            Sequential, //!< The memory is accessed sequentially. Aggressive read-ahead, pages can be freed soon after being read.
+            Random,     //!< The memory is accessed randomly. Read-ahead is disabled.
+            WillNeed    //!< The whole memory will be accessed soon. Reading it from the file is started immediately.
+        };
+    }
+
+    namespace detail
+    {
+        //#############################################################################
+        //! A memory mapped file region.
+        class MmapFileImpl final
+        {
+        public:
+            //-----------------------------------------------------------------------------
+            //! Maps sizeBytes bytes of the file starting at offsetBytes.
+            //!
+            //! \param bWritable If the mapped memory can be written.
+            //! \param bCreate If the file should be created (or truncated) with a size of offsetBytes + sizeBytes.
+            ALPAKA_FN_HOST MmapFileImpl(
+                std::string const & fileName,
+                std::size_t const offsetBytes,
+                std::size_t const sizeBytes,
+                bool const bWritable,
+                view::MmapSharing const sharing,
+                view::MmapAdvice const advice,
+                bool const bCreate) :
+                    m_fd(-1),
+                    m_pMapping(nullptr),
+                    m_mappingSizeBytes(0u),
+                    m_pMem(nullptr),
+                    m_sizeBytes(sizeBytes)
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                int const openFlags(
+                    bCreate
+                    ? (O_RDWR | O_CREAT | O_TRUNC)
+                    : ((bWritable && sharing == view::MmapSharing::Shared) ? O_RDWR : O_RDONLY));
+
+                m_fd = ::open(fileName.c_str(), openFlags, 0644);
+                if(m_fd == -1)
+                {
+                    throw std::runtime_error("Could not open the file '" + fileName + "' for memory mapping: " + std::strerror(errno));
+                }
+
+                try
+                {
+                    if(bCreate)
+                    {
+                        if(::ftruncate(m_fd, static_cast<off_t>(offsetBytes + sizeBytes)) != 0)
+                        {
+                            throw std::runtime_error("Could not resize the file '" + fileName + "': " + std::strerror(errno));
+                        }
+                    }
+                    else
+                    {
+                        struct stat fileStat;
+                        if(::fstat(m_fd, &fileStat) != 0)
+                        {
+                            throw std::runtime_error("Could not query the size of the file '" + fileName + "': " + std::strerror(errno));
+                        }
+                        if(static_cast<std::size_t>(fileStat.st_size) < offsetBytes + sizeBytes)
+                        {
+                            throw std::runtime_error("The file '" + fileName + "' is smaller than the region to be mapped!");
+                        }
+                    }
+
+                    // A mapping of zero bytes is not possible.
+                    if(sizeBytes > 0u)
+                    {
+                        // The offset of the mapping has to be a multiple of the page size.
+                        std::size_t const pageSize(static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)));
+                        std::size_t const mappingOffsetBytes((offsetBytes / pageSize) * pageSize);
+                        std::size_t const mappingPaddingBytes(offsetBytes - mappingOffsetBytes);
+                        m_mappingSizeBytes = mappingPaddingBytes + sizeBytes;
+
+                        int const prot(bWritable ? (PROT_READ | PROT_WRITE) : PROT_READ);
+                        int const flags((sharing == view::MmapSharing::Shared) ? MAP_SHARED : MAP_PRIVATE);
+
+                        void * const pMapping(::mmap(nullptr, m_mappingSizeBytes, prot, flags, m_fd, static_cast<off_t>(mappingOffsetBytes)));
+                        if(pMapping == MAP_FAILED)
+                        {
+                            throw std::runtime_error("Could not memory map the file '" + fileName + "': " + std::strerror(errno));
+                        }
+                        m_pMapping = pMapping;
+                        m_pMem = static_cast<std::uint8_t *>(pMapping) + mappingPaddingBytes;
+
+                        advise(advice);
+                    }
+                }
+                catch(...)
+                {
+                    ::close(m_fd);
+                    throw;
+                }
+            }
+            //-----------------------------------------------------------------------------
+            MmapFileImpl(MmapFileImpl const &) = delete;
+            //-----------------------------------------------------------------------------
+            MmapFileImpl(MmapFileImpl &&) = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(MmapFileImpl const &) -> MmapFileImpl & = delete;
+            //-----------------------------------------------------------------------------
+            auto operator=(MmapFileImpl &&) -> MmapFileImpl & = delete;
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST ~MmapFileImpl()
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                if(m_pMapping != nullptr)
+                {
+                    ::munmap(m_pMapping, m_mappingSizeBytes);
+                }
+                ::close(m_fd);
+            }
+
+            //-----------------------------------------------------------------------------
+            //! Gives the operating system a hint how the mapped memory will be accessed.
+            ALPAKA_FN_HOST auto advise(
+                view::MmapAdvice const advice) const
+            -> void
+            {
+                if(m_pMapping == nullptr)
+                {
+                    return;
+                }
+
+                int adv(MADV_NORMAL);
+                switch(advice)
+                {
+                case view::MmapAdvice::Normal: adv = MADV_NORMAL; break;
+                case view::MmapAdvice::Sequential: adv = MADV_SEQUENTIAL; break;
+                case view::MmapAdvice::Random: adv = MADV_RANDOM; break;
+                case view::MmapAdvice::WillNeed: adv = MADV_WILLNEED; break;
+                }
+
+                // The advice is only a hint. Ignore failures.
+                ::madvise(m_pMapping, m_mappingSizeBytes, adv);
+            }
+
+        private:
+            int m_fd;
+            void * m_pMapping;
+            std::size_t m_mappingSizeBytes;
+
+        public:
+            void * m_pMem;
+            std::size_t const m_sizeBytes;
+        };
+    }
+
+    namespace view
+    {
+        //#############################################################################
+        //! The memory view of a memory mapped file.
+        //!
+        //! The access mode is part of the type: a view with a const element type maps the file read-only
+        //! and only gives access to const elements, so it can not be used as destination of a copy or set.
+        //! The elements are stored densely (without row padding) in the file in row-major order.
+        //! The mapping is kept alive as long as any copy of the view exists.
+        //! The view belongs to a DevCpu and can therefore be used with all CPU accelerators and copied to and from any other device.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        class ViewMmap final
+        {
+            static_assert(
+                !std::is_const<TIdx>::value,
+                "The idx type of the view can not be const!");
+            static_assert(
+                std::is_trivially_copyable<TElem>::value,
+                "The elem type of the memory mapped view has to be trivially copyable!");
+
+        public:
+            //-----------------------------------------------------------------------------
+            //! Maps the given region of an existing file.
+            //!
+            //! \param offsetBytes The offset of the first element within the file.
+            //!        It does not need to be page aligned but has to be a multiple of the alignment of the element type.
+            template<
+                typename TExtent>
+            ALPAKA_FN_HOST ViewMmap(
+                DevCpu const & dev,
+                std::string const & fileName,
+                TExtent const & extent,
+                MmapSharing const sharing = MmapSharing::Shared,
+                MmapAdvice const advice = MmapAdvice::Normal,
+                std::size_t const offsetBytes = 0u) :
+                    ViewMmap(dev, fileName, extent, sharing, advice, offsetBytes, false)
+            {}
+
+            //-----------------------------------------------------------------------------
+            //! \param bCreate If the file should be created with exactly the size required for the view.
+            template<
+                typename TExtent>
+            ALPAKA_FN_HOST ViewMmap(
+                DevCpu const & dev,
+                std::string const & fileName,
+                TExtent const & extent,
+                MmapSharing const sharing,
+                MmapAdvice const advice,
+                std::size_t const offsetBytes,
+                bool const bCreate) :
+                    m_dev(dev),
+                    m_extentElements(extent::getExtentVecEnd<TDim>(extent)),
+                    m_pitchBytes(calculatePitchesFromExtents(m_extentElements)),
+                    m_spMmapFileImpl(
+                        std::make_shared<alpaka::detail::MmapFileImpl>(
+                            fileName,
+                            checkOffsetBytes(offsetBytes),
+                            static_cast<std::size_t>(m_extentElements.prod()) * sizeof(TElem),
+                            !std::is_const<TElem>::value,
+                            sharing,
+                            advice,
+                            bCreate))
+            {
+                static_assert(
+                    TDim::value == Dim<TExtent>::value,
+                    "The dimensionality of TExtent and the dimensionality of the TDim template parameter have to be identical!");
+            }
+            //-----------------------------------------------------------------------------
+            ViewMmap(ViewMmap const &) = default;
+            //-----------------------------------------------------------------------------
+            ViewMmap(ViewMmap &&) = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(ViewMmap const &) -> ViewMmap & = default;
+            //-----------------------------------------------------------------------------
+            auto operator=(ViewMmap &&) -> ViewMmap & = default;
+            //-----------------------------------------------------------------------------
+            ~ViewMmap() = default;
+
+            //-----------------------------------------------------------------------------
+            //! Gives the operating system a new hint how the mapped memory will be accessed.
+            ALPAKA_FN_HOST auto advise(
+                MmapAdvice const advice) const
+            -> void
+            {
+                m_spMmapFileImpl->advise(advice);
+            }
+
+        private:
+            //-----------------------------------------------------------------------------
+            //! \return The offset if the elements mapped at it are properly aligned.
+            ALPAKA_FN_HOST static auto checkOffsetBytes(
+                std::size_t const offsetBytes)
+            -> std::size_t
+            {
+                // The mapping itself is page aligned.
+                if((offsetBytes % alignof(TElem)) != 0u)
+                {
+                    throw std::invalid_argument(
+                        "The offset of a memory mapped view (" + std::to_string(offsetBytes)
+                        + " bytes) has to be a multiple of the alignment of the element type (" + std::to_string(alignof(TElem)) + " bytes)!");
+                }
+                return offsetBytes;
+            }
+            //-----------------------------------------------------------------------------
+            //! Calculate the pitches purely from the extents.
+            ALPAKA_FN_HOST static auto calculatePitchesFromExtents(
+                Vec<TDim, TIdx> const & extent)
+            -> Vec<TDim, TIdx>
+            {
+                Vec<TDim, TIdx> pitchBytes(Vec<TDim, TIdx>::all(0));
+                pitchBytes[TDim::value - 1u] = extent[TDim::value - 1u] * static_cast<TIdx>(sizeof(TElem));
+                for(TIdx i = TDim::value - 1u; i > static_cast<TIdx>(0u); --i)
+                {
+                    pitchBytes[i-1] = extent[i-1] * pitchBytes[i];
+                }
+                return pitchBytes;
+            }
+
+        public:
+            DevCpu m_dev;
+            Vec<TDim, TIdx> m_extentElements;
+            Vec<TDim, TIdx> m_pitchBytes;
+            std::shared_ptr<alpaka::detail::MmapFileImpl> m_spMmapFileImpl;
+        };
+    }
+
+    //-----------------------------------------------------------------------------
+    // Trait specializations for ViewMmap.
+    namespace traits
+    {
+        //#############################################################################
+        //! The ViewMmap device type trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct DevType<
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            using type = DevCpu;
+        };
+
+        //#############################################################################
+        //! The ViewMmap device get trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct GetDev<
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            ALPAKA_FN_HOST static auto getDev(
+                view::ViewMmap<TElem, TDim, TIdx> const & view)
+            -> DevCpu
+            {
+                return view.m_dev;
+            }
+        };
+
+        //#############################################################################
+        //! The ViewMmap dimension getter trait.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct DimType<
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The ViewMmap memory element type get trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct ElemType<
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            using type = TElem;
+        };
+    }
+    namespace extent
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The ViewMmap extent get trait specialization.
+            template<
+                typename TIdxIntegralConst,
+                typename TElem,
+                typename TDim,
+                typename TIdx>
+            struct GetExtent<
+                TIdxIntegralConst,
+                view::ViewMmap<TElem, TDim, TIdx>,
+                std::enable_if_t<(TDim::value > TIdxIntegralConst::value)>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getExtent(
+                    view::ViewMmap<TElem, TDim, TIdx> const & extent)
+                -> TIdx
+                {
+                    return extent.m_extentElements[TIdxIntegralConst::value];
+                }
+            };
+        }
+    }
+    namespace view
+    {
+        namespace traits
+        {
+            //#############################################################################
+            //! The ViewMmap native pointer get trait specialization.
+            template<
+                typename TElem,
+                typename TDim,
+                typename TIdx>
+            struct GetPtrNative<
+                view::ViewMmap<TElem, TDim, TIdx>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getPtrNative(
+                    view::ViewMmap<TElem, TDim, TIdx> const & view)
+                -> TElem const *
+                {
+                    return static_cast<TElem const *>(view.m_spMmapFileImpl->m_pMem);
+                }
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getPtrNative(
+                    view::ViewMmap<TElem, TDim, TIdx> & view)
+                -> TElem *
+                {
+                    return static_cast<TElem *>(view.m_spMmapFileImpl->m_pMem);
+                }
+            };
+
+            //#############################################################################
+            //! The ViewMmap memory pitch get trait specialization.
+            template<
+                typename TIdxIntegralConst,
+                typename TElem,
+                typename TDim,
+                typename TIdx>
+            struct GetPitchBytes<
+                TIdxIntegralConst,
+                view::ViewMmap<TElem, TDim, TIdx>,
+                std::enable_if_t<TIdxIntegralConst::value < TDim::value>>
+            {
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST static auto getPitchBytes(
+                    view::ViewMmap<TElem, TDim, TIdx> const & view)
+                -> TIdx
+                {
+                    return view.m_pitchBytes[TIdxIntegralConst::value];
+                }
+            };
+        }
+    }
+    namespace traits
+    {
+        //#############################################################################
+        //! The ViewMmap offset get trait specialization.
+        template<
+            typename TIdxIntegralConst,
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct GetOffset<
+            TIdxIntegralConst,
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getOffset(
+                view::ViewMmap<TElem, TDim, TIdx> const &)
+            -> TIdx
+            {
+                return 0u;
+            }
+        };
+
+        //#############################################################################
+        //! The ViewMmap idx type trait specialization.
+        template<
+            typename TElem,
+            typename TDim,
+            typename TIdx>
+        struct IdxType<
+            view::ViewMmap<TElem, TDim, TIdx>>
+        {
+            using type = TIdx;
+        };
+    }
+}
+
+#endif
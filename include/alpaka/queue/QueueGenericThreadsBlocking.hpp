@@ -17,6 +17,7 @@
 #include <alpaka/wait/Traits.hpp>
 
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+#include <alpaka/trace/Trace.hpp>
 
 #include <atomic>
 #include <mutex>
@@ -185,7 +186,11 @@ namespace alpaka
 
                 queue.m_spQueueImpl->m_bCurrentlyExecutingTask = true;
 
-                task();
+                {
+                    ALPAKA_TRACE_QUEUE_SCOPE(queue.m_spQueueImpl.get());
+
+                    task();
+                }
 
                 queue.m_spQueueImpl->m_bCurrentlyExecutingTask = false;
             }
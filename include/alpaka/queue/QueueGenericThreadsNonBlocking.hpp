@@ -17,6 +17,7 @@
 
 #include <alpaka/core/ConcurrentExecPool.hpp>
 #include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+#include <alpaka/trace/Trace.hpp>
 
 #include <type_traits>
 #include <thread>
@@ -43,7 +44,9 @@ namespace alpaka
             //! The CPU device queue implementation.
             template<
                 typename TDev>
-            class QueueGenericThreadsNonBlockingImpl final : public IGenericThreadsQueue<TDev>
+            class QueueGenericThreadsNonBlockingImpl final
+                : public IGenericThreadsQueue<TDev>
+                , public std::enable_shared_from_this<QueueGenericThreadsNonBlockingImpl<TDev>>
 #if BOOST_COMP_CLANG
 #pragma clang diagnostic pop
 #endif
@@ -196,8 +199,19 @@ namespace alpaka
             {
 // Workaround: Clang can not support this when natively compiling device code. See ConcurrentExecPool.hpp.
 #if !(BOOST_COMP_CLANG_CUDA && BOOST_ARCH_PTX)
+#ifdef ALPAKA_TRACE_ENABLED
+                auto const pQueueImpl(queue.m_spQueueImpl.get());
+                queue.m_spQueueImpl->m_workerThread.enqueueTask(
+                    [pQueueImpl, task]()
+                    {
+                        ALPAKA_TRACE_QUEUE_SCOPE(pQueueImpl);
+
+                        task();
+                    });
+#else
                 queue.m_spQueueImpl->m_workerThread.enqueueTask(
                     task);
+#endif
 #else
                 alpaka::ignore_unused(queue);
                 alpaka::ignore_unused(task);
@@ -16,12 +16,614 @@
 #endif
 
 #include <alpaka/dev/DevOmp5.hpp>
+#include <alpaka/event/EventGenericThreads.hpp>
 
-#include <alpaka/queue/QueueGenericThreadsNonBlocking.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/event/Traits.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/wait/Traits.hpp>
+#include <alpaka/core/Unused.hpp>
+
+#include <alpaka/queue/cpu/IGenericThreadsQueue.hpp>
+#include <alpaka/trace/Trace.hpp>
+
+#include <omp.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+    #include <iostream>
+#endif
 
 namespace alpaka
 {
-    using QueueOmp5NonBlocking = QueueGenericThreadsNonBlocking<DevOmp5>;
+    namespace omp5
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A dependency holding back all submissions enqueued after it until it is resolved.
+            struct QueueOmp5NonBlockingDependency
+            {
+                bool m_bResolved = false;   //!< If the dependency has been resolved.
+            };
+
+#if BOOST_COMP_CLANG
+// avoid diagnostic warning: "has no out-of-line virtual method definitions; its vtable will be emitted in every translation unit [-Werror,-Wweak-vtables]"
+// https://stackoverflow.com/a/29288300
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif
+            //#############################################################################
+            //! The OpenMP 5.0 non-blocking device queue implementation.
+            //!
+            //! All work is issued as OpenMP tasks (kernels as `target nowait`) which depend (inout) on a single per-queue dependency object.
+            //! They are issued by a single thread owned by the queue which waits for each of them before issuing the next one,
+            //! so the host thread enqueuing them is never blocked and the tasks of different queues overlap.
+            //! The first exception thrown by a host task is rethrown by the next wait for the queue.
+            class QueueOmp5NonBlockingImpl final
+                : public IGenericThreadsQueue<DevOmp5>
+                , public std::enable_shared_from_this<QueueOmp5NonBlockingImpl>
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+            {
+            private:
+                //#############################################################################
+                //! A submission is either a function issuing OpenMP tasks or a dependency.
+                struct Submission
+                {
+                    std::function<void(char *)> m_issue;
+                    std::shared_ptr<QueueOmp5NonBlockingDependency> m_spDependency;
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                explicit QueueOmp5NonBlockingImpl(
+                    DevOmp5 const & dev) :
+                        m_dev(dev),
+                        m_dependency(0),
+                        m_enqueueCount(0u),
+                        m_finishedCount(0u),
+                        m_bShutdown(false),
+                        m_issueThread([this](){this->issueLoop();})
+                {}
+                //-----------------------------------------------------------------------------
+                QueueOmp5NonBlockingImpl(QueueOmp5NonBlockingImpl const &) = delete;
+                //-----------------------------------------------------------------------------
+                QueueOmp5NonBlockingImpl(QueueOmp5NonBlockingImpl &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(QueueOmp5NonBlockingImpl const &) -> QueueOmp5NonBlockingImpl & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(QueueOmp5NonBlockingImpl &&) -> QueueOmp5NonBlockingImpl & = delete;
+                //-----------------------------------------------------------------------------
+                ~QueueOmp5NonBlockingImpl() override
+                {
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+                        m_bShutdown = true;
+                    }
+                    m_cvSubmission.notify_one();
+
+                    // The end of the parallel region waits for all tasks already issued.
+                    m_issueThread.join();
+                }
+
+                //-----------------------------------------------------------------------------
+                void enqueue(EventGenericThreads<DevOmp5> & ev) final
+                {
+                    alpaka::enqueue(*this, ev);
+                }
+
+                //-----------------------------------------------------------------------------
+                void wait(EventGenericThreads<DevOmp5> const & ev) final
+                {
+                    alpaka::wait(*this, ev);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Enqueues the given host task as an OpenMP task depending on the previous submissions.
+                template<
+                    typename TTask>
+                auto enqueueTask(
+                    TTask const & task,
+                    bool const bCounted = true)
+                -> void
+                {
+                    if(bCounted)
+                    {
+                        ++m_enqueueCount;
+                    }
+                    std::function<void()> hostTaskFn(task);
+                    submit(
+                        [this, hostTaskFn, bCounted](char * const pDependency)
+                        {
+                            // The task has to own copies because this function object is destroyed as soon as the task is issued.
+                            auto hostTask(hostTaskFn);
+                            bool const bCountedTask(bCounted);
+                            auto const pQueueImpl(this);
+                            #pragma omp task depend(inout: pDependency[0]) firstprivate(hostTask, bCountedTask, pQueueImpl)
+                            {
+                                ALPAKA_TRACE_QUEUE_SCOPE(pQueueImpl);
+                                // Exceptions must not leave an OpenMP task. They are kept until the next wait for the queue.
+                                try
+                                {
+                                    hostTask();
+                                }
+                                catch(...)
+                                {
+#if ALPAKA_DEBUG >= ALPAKA_DEBUG_MINIMAL
+                                    std::cerr << "Exception thrown by a task of QueueOmp5NonBlocking!" << std::endl;
+#endif
+                                    pQueueImpl->setException(std::current_exception());
+                                }
+                                if(bCountedTask)
+                                {
+                                    ++pQueueImpl->m_finishedCount;
+                                }
+                            }
+                        },
+                        nullptr);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Enqueues the given launch function.
+                //!
+                //! The function is called by the issuing thread with the dependency object of this queue.
+                //! It has to issue exactly one deferred task depending (inout) on this object, e.g. a `target nowait` region.
+                //! The function may wait for the task itself, e.g. to measure its execution time.
+                auto enqueueLaunch(
+                    std::function<void(char *)> launch)
+                -> void
+                {
+                    ++m_enqueueCount;
+                    submit(
+                        [this, launch](char * const pDependency)
+                        {
+                            {
+                                ALPAKA_TRACE_QUEUE_SCOPE(this);
+                                launch(pDependency);
+                            }
+
+                            // Marks the completion of the launch.
+                            auto const pQueueImpl(this);
+                            #pragma omp task depend(inout: pDependency[0]) firstprivate(pQueueImpl)
+                            {
+                                ++pQueueImpl->m_finishedCount;
+                            }
+                        },
+                        nullptr);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Enqueues a dependency.
+                //!
+                //! No further submissions are issued until the dependency has been resolved via resolveDependency.
+                //! The tasks issued before keep executing.
+                auto enqueueDependency()
+                -> std::shared_ptr<QueueOmp5NonBlockingDependency>
+                {
+                    auto spDependency(std::make_shared<QueueOmp5NonBlockingDependency>());
+                    submit(nullptr, spDependency);
+                    return spDependency;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Resolves the given dependency and releases the submissions enqueued after it.
+                auto resolveDependency(
+                    std::shared_ptr<QueueOmp5NonBlockingDependency> const & spDependency)
+                -> void
+                {
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+                        spDependency->m_bResolved = true;
+                    }
+                    m_cvSubmission.notify_one();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Rethrows the first exception thrown by a host task since the last call.
+                auto rethrowException()
+                -> void
+                {
+                    std::exception_ptr exception;
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+                        std::swap(exception, m_exception);
+                    }
+                    if(exception)
+                    {
+                        std::rethrow_exception(exception);
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return If all counted tasks enqueued up to now have been finished.
+                auto isIdle() const
+                -> bool
+                {
+                    return m_finishedCount == m_enqueueCount;
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                //! Keeps the given exception if it is the first one since the last wait.
+                auto setException(
+                    std::exception_ptr const & exception)
+                -> void
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+                    if(!m_exception)
+                    {
+                        m_exception = exception;
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                auto submit(
+                    std::function<void(char *)> issue,
+                    std::shared_ptr<QueueOmp5NonBlockingDependency> spDependency)
+                -> void
+                {
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+                        m_submissions.push_back(Submission{std::move(issue), std::move(spDependency)});
+                    }
+                    m_cvSubmission.notify_one();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return If the first submission can be issued. The mutex has to be locked by the caller.
+                auto isReadyToIssue() const
+                -> bool
+                {
+                    return
+                        (!m_submissions.empty())
+                        && ((!m_submissions.front().m_spDependency) || m_submissions.front().m_spDependency->m_bResolved);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! The function executed by the issue thread.
+                //!
+                //! The tasks are executed in order anyway, so waiting for each of them before issuing the next one does not lose any concurrency
+                //! but allows the thread issuing them to be the only thread owned by the queue.
+                auto issueLoop()
+                -> void
+                {
+                    char * const pDependency(&m_dependency);
+
+                    std::unique_lock<std::mutex> lk(m_mutex);
+                    while(true)
+                    {
+                        if(!isReadyToIssue())
+                        {
+                            if(m_bShutdown)
+                            {
+                                // Submissions held back by unresolved dependencies are dropped.
+                                break;
+                            }
+                            m_cvSubmission.wait(lk);
+                            continue;
+                        }
+
+                        auto submission(std::move(m_submissions.front()));
+                        m_submissions.pop_front();
+                        if(submission.m_issue)
+                        {
+                            lk.unlock();
+                            submission.m_issue(pDependency);
+                            #pragma omp taskwait
+                            lk.lock();
+                        }
+                    }
+                }
+
+            public:
+                DevOmp5 const m_dev;            //!< The device this queue is bound to.
+
+            private:
+                char m_dependency;              //!< The object all tasks of this queue depend on.
+                std::atomic<std::size_t> m_enqueueCount;
+                std::atomic<std::size_t> m_finishedCount;
+
+                std::mutex m_mutex;
+                std::condition_variable m_cvSubmission;
+                std::deque<Submission> m_submissions;
+                std::exception_ptr m_exception;
+                bool m_bShutdown;
+
+                std::thread m_issueThread;
+            };
+        }
+    }
+
+    //#############################################################################
+    //! The OpenMP 5.0 non-blocking device queue.
+    class QueueOmp5NonBlocking final
+        : public concepts::Implements<ConceptCurrentThreadWaitFor, QueueOmp5NonBlocking>
+        , public concepts::Implements<ConceptQueue, QueueOmp5NonBlocking>
+        , public concepts::Implements<ConceptGetDev, QueueOmp5NonBlocking>
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        explicit QueueOmp5NonBlocking(
+            DevOmp5 const & dev) :
+                m_spQueueImpl(std::make_shared<omp5::detail::QueueOmp5NonBlockingImpl>(dev))
+        {
+            ALPAKA_DEBUG_FULL_LOG_SCOPE;
+
+            dev.registerQueue(m_spQueueImpl);
+        }
+        //-----------------------------------------------------------------------------
+        QueueOmp5NonBlocking(QueueOmp5NonBlocking const &) = default;
+        //-----------------------------------------------------------------------------
+        QueueOmp5NonBlocking(QueueOmp5NonBlocking &&) = default;
+        //-----------------------------------------------------------------------------
+        auto operator=(QueueOmp5NonBlocking const &) -> QueueOmp5NonBlocking & = default;
+        //-----------------------------------------------------------------------------
+        auto operator=(QueueOmp5NonBlocking &&) -> QueueOmp5NonBlocking & = default;
+        //-----------------------------------------------------------------------------
+        auto operator==(QueueOmp5NonBlocking const & rhs) const
+        -> bool
+        {
+            return (m_spQueueImpl == rhs.m_spQueueImpl);
+        }
+        //-----------------------------------------------------------------------------
+        auto operator!=(QueueOmp5NonBlocking const & rhs) const
+        -> bool
+        {
+            return !((*this) == rhs);
+        }
+        //-----------------------------------------------------------------------------
+        ~QueueOmp5NonBlocking() = default;
+
+    public:
+        std::shared_ptr<omp5::detail::QueueOmp5NonBlockingImpl> m_spQueueImpl;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue device type trait specialization.
+        template<>
+        struct DevType<
+            QueueOmp5NonBlocking>
+        {
+            using type = DevOmp5;
+        };
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue device get trait specialization.
+        template<>
+        struct GetDev<
+            QueueOmp5NonBlocking>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto getDev(
+                QueueOmp5NonBlocking const & queue)
+            -> DevOmp5
+            {
+                return queue.m_spQueueImpl->m_dev;
+            }
+        };
+
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue event type trait specialization.
+        template<>
+        struct EventType<
+            QueueOmp5NonBlocking>
+        {
+            using type = EventGenericThreads<DevOmp5>;
+        };
+
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue enqueue trait specialization.
+        //! This default implementation for all tasks invokes the function call operator of the task within an OpenMP task.
+        template<
+            typename TTask>
+        struct Enqueue<
+            QueueOmp5NonBlocking,
+            TTask>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                QueueOmp5NonBlocking & queue,
+                TTask const & task)
+            -> void
+            {
+                queue.m_spQueueImpl->enqueueTask(task);
+            }
+        };
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue test trait specialization.
+        template<>
+        struct Empty<
+            QueueOmp5NonBlocking>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto empty(
+                QueueOmp5NonBlocking const & queue)
+            -> bool
+            {
+                return queue.m_spQueueImpl->isIdle();
+            }
+        };
+
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue event enqueue trait specialization.
+        //!
+        //! The event is set ready by a task depending on all tasks enqueued before.
+        template<>
+        struct Enqueue<
+            omp5::detail::QueueOmp5NonBlockingImpl,
+            EventGenericThreads<DevOmp5>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                omp5::detail::QueueOmp5NonBlockingImpl & queueImpl,
+                EventGenericThreads<DevOmp5> & event)
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                // Copy the shared pointer of the event implementation.
+                // This is forwarded to the task to ensure that the event implementation is alive as long as it is enqueued.
+                auto spEventImpl(event.m_spEventImpl);
+
+                // Setting the event state and enqueuing it has to be atomic.
+                std::lock_guard<std::mutex> lk(spEventImpl->m_mutex);
+
+                ++spEventImpl->m_enqueueCount;
+
+                auto const enqueueCount = spEventImpl->m_enqueueCount;
+
+                // The future is only used by threads waiting for the event.
+                auto spPromise(std::make_shared<std::promise<void>>());
+                spEventImpl->m_future = spPromise->get_future().share();
+
+                // The event task itself does not count as work for Empty.
+                queueImpl.enqueueTask(
+                    [spEventImpl, enqueueCount, spPromise]()
+                    {
+                        ALPAKA_TRACE_SCOPE(
+                            "event",
+                            [&](){return std::make_pair(std::string("event"), trace::detail::Args().add("enqueueCount", enqueueCount).str());});
+
+                        auto const timePoint(std::chrono::steady_clock::now());
+
+                        std::vector<std::function<void()>> vReadyContinuations;
+                        {
+                            std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
+
+                            // Nothing to do if it has been re-enqueued to a later position in the queue.
+                            if(enqueueCount == spEventImpl->m_enqueueCount)
+                            {
+                                vReadyContinuations = spEventImpl->setReady(timePoint);
+                            }
+                        }
+                        spPromise->set_value();
+
+                        // Release the queues waiting for this event.
+                        for(auto && continuation : vReadyContinuations)
+                        {
+                            continuation();
+                        }
+                    },
+                    false);
+            }
+        };
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue event enqueue trait specialization.
+        template<>
+        struct Enqueue<
+            QueueOmp5NonBlocking,
+            EventGenericThreads<DevOmp5>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                QueueOmp5NonBlocking & queue,
+                EventGenericThreads<DevOmp5> & event)
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                alpaka::enqueue(*queue.m_spQueueImpl, event);
+            }
+        };
+
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue event wait trait specialization.
+        //!
+        //! Events of the same queue are already ordered by the task dependencies.
+        //! OpenMP task dependencies can not span the teams of different queues, so the submissions enqueued after this point are held back
+        //! by a queue dependency which is resolved by the event itself. The tasks issued before keep executing.
+        template<>
+        struct WaiterWaitFor<
+            omp5::detail::QueueOmp5NonBlockingImpl,
+            EventGenericThreads<DevOmp5>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto waiterWaitFor(
+                omp5::detail::QueueOmp5NonBlockingImpl & queueImpl,
+                EventGenericThreads<DevOmp5> const & event)
+            -> void
+            {
+                auto spEventImpl(event.m_spEventImpl);
+
+                std::lock_guard<std::mutex> lk(spEventImpl->m_mutex);
+
+                if(!spEventImpl->isReady())
+                {
+                    auto spDependency(queueImpl.enqueueDependency());
+
+                    // The queue may be destroyed before the event is ready.
+                    std::weak_ptr<omp5::detail::QueueOmp5NonBlockingImpl> wpQueueImpl(queueImpl.shared_from_this());
+
+                    spEventImpl->m_vContinuations.emplace_back(
+                        spEventImpl->m_enqueueCount,
+                        [wpQueueImpl, spDependency]()
+                        {
+                            if(auto spQueueImpl = wpQueueImpl.lock())
+                            {
+                                spQueueImpl->resolveDependency(spDependency);
+                            }
+                        });
+                }
+            }
+        };
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue event wait trait specialization.
+        template<>
+        struct WaiterWaitFor<
+            QueueOmp5NonBlocking,
+            EventGenericThreads<DevOmp5>>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto waiterWaitFor(
+                QueueOmp5NonBlocking & queue,
+                EventGenericThreads<DevOmp5> const & event)
+            -> void
+            {
+                wait(*queue.m_spQueueImpl, event);
+            }
+        };
+
+        //#############################################################################
+        //! The OpenMP 5.0 non-blocking device queue thread wait trait specialization.
+        //!
+        //! Blocks execution of the calling thread until the queue has finished processing all previously requested tasks (kernels, data copies, ...)
+        //! The first exception thrown by a host task since the last wait is rethrown.
+        template<>
+        struct CurrentThreadWaitFor<
+            QueueOmp5NonBlocking>
+        {
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto currentThreadWaitFor(
+                QueueOmp5NonBlocking const & queue)
+            -> void
+            {
+                EventGenericThreads<DevOmp5> event(
+                    getDev(queue));
+                alpaka::enqueue(
+                    const_cast<QueueOmp5NonBlocking &>(queue),
+                    event);
+                wait(
+                    event);
+
+                queue.m_spQueueImpl->rethrowException();
+            }
+        };
+    }
 }
 
 #endif
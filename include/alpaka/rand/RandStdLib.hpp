@@ -11,10 +11,12 @@
 
 #include <alpaka/rand/Traits.hpp>
 #include <alpaka/rand/TinyMT/Engine.hpp>
+#include <alpaka/rand/Ziggurat.hpp>
 
 #include <alpaka/core/Common.hpp>
 #include <alpaka/core/Unused.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <random>
 #include <type_traits>
@@ -140,6 +142,10 @@ namespace alpaka
             {
                 //#############################################################################
                 //! The CPU random number normal distribution.
+                //!
+                //! It uses the Ziggurat method with 128 layers.
+                //! Contrary to std::normal_distribution it has no cached state and the fast path is free of transcendental functions.
+                //! All samples except the rare wedge and tail samples are bit identical on all compilers and standard libraries.
                 template<
                     typename T>
                 class NormalReal
@@ -155,13 +161,17 @@ namespace alpaka
                         TGenerator & generator)
                     -> T
                     {
-                        return m_dist(generator.m_State);
+                        // long double is generated with double precision.
+                        using TReal = std::conditional_t<std::is_same<T, float>::value, float, double>;
+                        return static_cast<T>(detail::normalZiggurat<TReal>(generator));
                     }
-                    std::normal_distribution<T> m_dist;
                 };
 
                 //#############################################################################
                 //! The CPU random number uniform distribution.
+                //!
+                //! The random bits are scaled by a power of two into [0, 1) (24 bits for float, 53 bits for double).
+                //! Contrary to std::uniform_real_distribution the result is bit identical on all compilers and standard libraries.
                 template<
                     typename T>
                 class UniformReal
@@ -177,24 +187,23 @@ namespace alpaka
                         TGenerator & generator)
                     -> T
                     {
-                        return m_dist(generator.m_State);
+                        // long double is generated with double precision.
+                        using TReal = std::conditional_t<std::is_same<T, float>::value, float, double>;
+                        return static_cast<T>(detail::RealBits<TReal>::uniform(generator));
                     }
-                    std::uniform_real_distribution<T> m_dist;
                 };
 
                 //#############################################################################
-                //! The CPU random number normal distribution.
+                //! The CPU random number integer uniform distribution.
+                //!
+                //! The value is composed of the raw 32 bit draws of the generator.
                 template<
                     typename T>
                 class UniformUint
                 {
                 public:
                     //-----------------------------------------------------------------------------
-                    UniformUint() :
-                        m_dist(
-                            0,  // For signed integer: std::numeric_limits<T>::lowest()
-                            std::numeric_limits<T>::max())
-                    {}
+                    UniformUint() = default;
 
                     //-----------------------------------------------------------------------------
                     template<
@@ -203,9 +212,14 @@ namespace alpaka
                         TGenerator & generator)
                     -> T
                     {
-                        return m_dist(generator.m_State);
+                        auto value(static_cast<T>(detail::nextUint32(generator)));
+                        for(std::size_t byteCount(4u); byteCount < sizeof(T); byteCount += 4u)
+                        {
+                            // Shifting twice avoids a shift by the full width for 32 bit types in this unused branch.
+                            value = static_cast<T>(static_cast<T>((value << 16u) << 16u) | detail::nextUint32(generator));
+                        }
+                        return value;
                     }
-                    std::uniform_int_distribution<T> m_dist;
                 };
             }
         }
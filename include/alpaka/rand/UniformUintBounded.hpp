@@ -0,0 +1,87 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/rand/Traits.hpp>
+
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/Common.hpp>
+
+#include <cstdint>
+
+namespace alpaka
+{
+    namespace rand
+    {
+        namespace distribution
+        {
+            //#############################################################################
+            //! The random number integer uniform distribution in [0, bound) without modulo bias.
+            //!
+            //! It uses the multiply-shift method of Lemire (2019): the 32 bit draw is multiplied by the bound and the upper
+            //! 32 bits of the product are the result. Draws whose lower 32 bits fall below (2^32 - bound) % bound are rejected.
+            //! The threshold is computed once on construction, so drawing is free of divisions.
+            //! It works on top of the 32 bit integer uniform distribution of any accelerator.
+            template<
+                typename TUniformUint>
+            class UniformUintBounded
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                ALPAKA_FN_HOST_ACC UniformUintBounded(
+                    TUniformUint const & dist,
+                    std::uint32_t const & bound) :
+                        m_dist(dist),
+                        m_bound(bound),
+                        m_threshold((0u - bound) % bound)
+                {
+                    ALPAKA_ASSERT(bound > 0u);
+                }
+
+                //-----------------------------------------------------------------------------
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TGenerator>
+                ALPAKA_FN_HOST_ACC auto operator()(
+                    TGenerator & generator)
+                -> std::uint32_t
+                {
+                    auto product(static_cast<std::uint64_t>(m_dist(generator)) * m_bound);
+                    while(static_cast<std::uint32_t>(product) < m_threshold)
+                    {
+                        product = static_cast<std::uint64_t>(m_dist(generator)) * m_bound;
+                    }
+                    return static_cast<std::uint32_t>(product >> 32u);
+                }
+
+            private:
+                TUniformUint m_dist;
+                std::uint64_t m_bound;
+                std::uint32_t m_threshold;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return A uniform integer distribution [0, bound) without modulo bias.
+            ALPAKA_NO_HOST_ACC_WARNING
+            template<
+                typename TRand>
+            ALPAKA_FN_HOST_ACC auto createUniformUintBounded(
+                TRand const & rand,
+                std::uint32_t const & bound)
+            {
+                using Dist = decltype(createUniformUint<std::uint32_t>(rand));
+                return
+                    UniformUintBounded<Dist>(
+                        createUniformUint<std::uint32_t>(rand),
+                        bound);
+            }
+        }
+    }
+}
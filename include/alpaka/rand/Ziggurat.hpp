@@ -0,0 +1,232 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace alpaka
+{
+    namespace rand
+    {
+        namespace distribution
+        {
+            namespace cpu
+            {
+                namespace detail
+                {
+                    //-----------------------------------------------------------------------------
+                    //! \return The next 32 random bits of the generator.
+                    //!
+                    //! All CPU generators (std::mt19937, TinyMT and std::random_device) deliver 32 bits per call.
+                    template<
+                        typename TGenerator>
+                    ALPAKA_FN_HOST auto nextUint32(
+                        TGenerator & generator)
+                    -> std::uint32_t
+                    {
+                        return static_cast<std::uint32_t>(generator.m_State());
+                    }
+
+                    //#############################################################################
+                    //! The conversion of random bits to floating point numbers.
+                    //!
+                    //! Only integer operations and multiplications by powers of two are used,
+                    //! so the result is bit identical on all compilers and standard libraries.
+                    template<
+                        typename T>
+                    struct RealBits;
+
+                    //#############################################################################
+                    template<>
+                    struct RealBits<
+                        float>
+                    {
+                        //-----------------------------------------------------------------------------
+                        //! \return A uniform number in [0, 1) with 24 random bits.
+                        template<
+                            typename TGenerator>
+                        ALPAKA_FN_HOST static auto uniform(
+                            TGenerator & generator)
+                        -> float
+                        {
+                            return static_cast<float>(nextUint32(generator) >> 8u) * (1.0f / 16777216.0f);
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return A uniform number in [-1, 1) with 24 random bits. The lowest 7 bits of the same draw are returned as the layer.
+                        template<
+                            typename TGenerator>
+                        ALPAKA_FN_HOST static auto symmetric(
+                            TGenerator & generator,
+                            std::uint32_t & layer)
+                        -> float
+                        {
+                            auto const bits(nextUint32(generator));
+                            layer = bits & 0x7Fu;
+                            return static_cast<float>(static_cast<std::int32_t>(bits >> 8u) - 8388608) * (1.0f / 8388608.0f);
+                        }
+                    };
+
+                    //#############################################################################
+                    template<>
+                    struct RealBits<
+                        double>
+                    {
+                        //-----------------------------------------------------------------------------
+                        //! \return 53 random bits from two draws. The lowest 11 bits of the first draw are not part of it.
+                        template<
+                            typename TGenerator>
+                        ALPAKA_FN_HOST static auto next53(
+                            TGenerator & generator,
+                            std::uint32_t & lo)
+                        -> std::uint64_t
+                        {
+                            lo = nextUint32(generator);
+                            auto const hi(nextUint32(generator));
+                            return ((static_cast<std::uint64_t>(hi) << 32u) | lo) >> 11u;
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return A uniform number in [0, 1) with 53 random bits.
+                        template<
+                            typename TGenerator>
+                        ALPAKA_FN_HOST static auto uniform(
+                            TGenerator & generator)
+                        -> double
+                        {
+                            std::uint32_t lo;
+                            return static_cast<double>(next53(generator, lo)) * (1.0 / 9007199254740992.0);
+                        }
+
+                        //-----------------------------------------------------------------------------
+                        //! \return A uniform number in [-1, 1) with 53 random bits. 7 of the unused bits are returned as the layer.
+                        template<
+                            typename TGenerator>
+                        ALPAKA_FN_HOST static auto symmetric(
+                            TGenerator & generator,
+                            std::uint32_t & layer)
+                        -> double
+                        {
+                            std::uint32_t lo;
+                            auto const bits(next53(generator, lo));
+                            layer = lo & 0x7Fu;
+                            return static_cast<double>(static_cast<std::int64_t>(bits) - 4503599627370496) * (1.0 / 4503599627370496.0);
+                        }
+                    };
+
+                    //-----------------------------------------------------------------------------
+                    //! \return The x coordinates of the 128 layers of the normal Ziggurat of Marsaglia and Tsang.
+                    //!
+                    //! x[0] is the width of the base layer including the tail, x[1] is the tail start r = 3.442619855899 and x[128] = 0.
+                    //! The values are the ones given by the setup of Doornik (2005), stored to make them independent of std::exp and std::log.
+                    inline auto zigguratNormalX()
+                    -> double const (&)[129]
+                    {
+                        static constexpr double x[129] = {
+                        3.7130862467425505, 3.4426198558990002, 3.2230849845811416, 3.0832288582168683,
+                        2.9786962526477803, 2.8943440070215289, 2.8231253505489105, 2.7611693723871769,
+                        2.7061135731218195, 2.6564064112613597, 2.6109722484318474, 2.5690336259249378,
+                        2.5300096723888275, 2.4934545220953721, 2.4590181774118305, 2.4264206455337498,
+                        2.3954342780110625, 2.3658713701176386, 2.3375752413392368, 2.310413683698763,
+                        2.2842740596774718, 2.2590595738691985, 2.2346863955909795, 2.2110814088787034,
+                        2.1881804320760492, 2.1659267937489219, 2.1442701823603953, 2.1231657086739766,
+                        2.1025731351892385, 2.0824562379920168, 2.0627822745083084, 2.0435215366550676,
+                        2.0246469733773855, 2.0061338699634721, 1.9879595741276199, 1.9701032608543265,
+                        1.9525457295535567, 1.9352692282966228, 1.9182573008645099, 1.9014946531051511,
+                        1.884967035707759, 1.8686611409944887, 1.8525645117280911, 1.836665460258446,
+                        1.8209529965961255, 1.8054167642192285, 1.7900469825998586, 1.7748343955860695,
+                        1.7597702248995934, 1.7448461281138004, 1.7300541605637305, 1.7153867407136676,
+                        1.7008366185699169, 1.6863968467791681, 1.6720607540976009, 1.6578219209540241,
+                        1.6436741568628686, 1.6296114794706347, 1.615628095043161, 1.6017183802213781,
+                        1.5878768648905761, 1.5740982160230008, 1.5603772223661689, 1.5467087798599104,
+                        1.5330878776740433, 1.5195095847659401, 1.5059690368632033, 1.492461423781354,
+                        1.4789819769899242, 1.4655259573427108, 1.4520886428892246, 1.4386653166845635,
+                        1.4252512545140601, 1.4118417124470577, 1.3984319141310053, 1.3850170377326518,
+                        1.3715922024273426, 1.3581524543301435, 1.344692751753547, 1.3312079496656273,
+                        1.3176927832094141, 1.3041418501286168, 1.2905495919261964, 1.2769102735601556,
+                        1.2632179614546211, 1.2494664995730682, 1.2356494832633627, 1.2217602305399964,
+                        1.2077917504159497, 1.1937367078331287, 1.1795873846639882, 1.1653356361647524,
+                        1.1509728421488674, 1.1364898520131608, 1.1218769225825422, 1.107123647534036,
+                        1.0922188769072774, 1.0771506248928957, 1.0619059636948243, 1.0464709007640454,
+                        1.0308302360681956, 1.0149673952513305, 0.99886423349298359, 0.98250080351542901,
+                        0.9658550794011499, 0.94890262551130644, 0.93161619661515083, 0.91396525102303228,
+                        0.89591535258093769, 0.87742742911292337, 0.85845684319381321, 0.83895221429757738,
+                        0.81885390670035729, 0.79809206064405691, 0.77658398789475991, 0.75423066445405562,
+                        0.73091191064248884, 0.70647961133543646, 0.68074791866915463, 0.65347863873997525,
+                        0.6243585973360507, 0.59296294247144832, 0.55869217840818519, 0.52065603876206057,
+                        0.47743783729668982, 0.42654798635542351, 0.36287143109703196, 0.27232086481396467,
+                        0.0
+                        };
+                        return x;
+                    }
+
+                    //-----------------------------------------------------------------------------
+                    //! \return A standard normal distributed number generated with the Ziggurat method.
+                    //!
+                    //! About 98.8% of the numbers are taken from the fast path which only needs one draw (two for double),
+                    //! a table lookup, a multiplication and a comparison.
+                    //! Only the rare wedge and tail samples call std::exp and std::log.
+                    template<
+                        typename T,
+                        typename TGenerator>
+                    ALPAKA_FN_HOST auto normalZiggurat(
+                        TGenerator & generator)
+                    -> T
+                    {
+                        auto const & zigX(zigguratNormalX());
+                        T const r(static_cast<T>(zigX[1]));
+
+                        for(;;)
+                        {
+                            std::uint32_t layer;
+                            auto const u(RealBits<T>::symmetric(generator, layer));
+                            auto const x(u * static_cast<T>(zigX[layer]));
+
+                            // The sample lies in the rectangle completely covered by the density.
+                            if(std::abs(x) < static_cast<T>(zigX[layer + 1u]))
+                            {
+                                return x;
+                            }
+
+                            if(layer == 0u)
+                            {
+                                // Sample from the tail beyond r (Marsaglia 1964).
+                                T xt;
+                                T yt;
+                                do
+                                {
+                                    xt = std::log(static_cast<T>(1) - RealBits<T>::uniform(generator)) / r;
+                                    yt = std::log(static_cast<T>(1) - RealBits<T>::uniform(generator));
+                                }
+                                while(static_cast<T>(-2) * yt < xt * xt);
+                                return (u < static_cast<T>(0)) ? (xt - r) : (r - xt);
+                            }
+
+                            // Sample from the wedge between the rectangle and the density.
+                            auto const x0(static_cast<T>(zigX[layer]));
+                            auto const x1(static_cast<T>(zigX[layer + 1u]));
+                            auto const f0(std::exp(static_cast<T>(-0.5) * (x0 * x0 - x * x)));
+                            auto const f1(std::exp(static_cast<T>(-0.5) * (x1 * x1 - x * x)));
+                            if(f1 + RealBits<T>::uniform(generator) * (f0 - f1) < static_cast<T>(1))
+                            {
+                                return x;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,669 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+
+#include <boost/core/demangle.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// The tracing layer records every kernel, copy, set and event executed by the CPU queues.
+//
+// It has to be enabled at compile time by defining ALPAKA_TRACE_ENABLED (CMake option ALPAKA_TRACE).
+// Without it the instrumentation macros expand to nothing.
+// At run time the recording is activated either by setting the environment variable ALPAKA_TRACE_FILE
+// to the output file name or by calling alpaka::trace::enable.
+// The output is a Chrome trace event JSON file which can be loaded into Perfetto (ui.perfetto.dev) or chrome://tracing.
+namespace alpaka
+{
+    //-----------------------------------------------------------------------------
+    //! The tracing specifics.
+    namespace trace
+    {
+        namespace detail
+        {
+            //#############################################################################
+            //! A completed operation.
+            struct Record
+            {
+                char const * m_category;
+                std::string m_name;
+                std::string m_args;
+                std::uint64_t m_beginNs;
+                std::uint64_t m_endNs;
+                std::uintptr_t m_queue;
+            };
+
+            //#############################################################################
+            //! The record buffer of a single thread.
+            //!
+            //! Only the owning thread appends records. This is lock-free.
+            //! The records are stored in a linked list of fixed size chunks so that appending never moves committed records.
+            //! A single consumer (serialized by the tracer) can concurrently read all committed records and release finished chunks.
+            class ThreadBuffer final
+            {
+                static constexpr std::size_t chunkRecordCount = 512u;
+
+                //#############################################################################
+                struct Chunk
+                {
+                    std::array<Record, chunkRecordCount> m_records;
+                    std::atomic<Chunk *> m_next{nullptr};
+                };
+
+            public:
+                //-----------------------------------------------------------------------------
+                explicit ThreadBuffer(
+                    std::uint32_t threadIdx) :
+                        m_threadIdx(threadIdx),
+                        m_committed(0u),
+                        m_head(new Chunk()),
+                        m_tail(m_head),
+                        m_consumed(0u)
+                {}
+                //-----------------------------------------------------------------------------
+                ThreadBuffer(ThreadBuffer const &) = delete;
+                //-----------------------------------------------------------------------------
+                ThreadBuffer(ThreadBuffer &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ThreadBuffer const &) -> ThreadBuffer & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ThreadBuffer &&) -> ThreadBuffer & = delete;
+                //-----------------------------------------------------------------------------
+                ~ThreadBuffer()
+                {
+                    while(m_head)
+                    {
+                        Chunk * const next(m_head->m_next.load(std::memory_order_relaxed));
+                        delete m_head;
+                        m_head = next;
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Appends a record. Must only be called by the owning thread.
+                auto push(
+                    Record && record)
+                -> void
+                {
+                    std::size_t const idx(m_committed.load(std::memory_order_relaxed));
+                    std::size_t const idxInChunk(idx % chunkRecordCount);
+                    if((idx != 0u) && (idxInChunk == 0u))
+                    {
+                        Chunk * const chunk(new Chunk());
+                        m_tail->m_next.store(chunk, std::memory_order_release);
+                        m_tail = chunk;
+                    }
+                    m_tail->m_records[idxInChunk] = std::move(record);
+                    m_committed.store(idx + 1u, std::memory_order_release);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Calls the given function for all records committed since the last call and releases their memory.
+                //! Calls have to be serialized by the caller.
+                template<
+                    typename TFnObj>
+                auto consume(
+                    TFnObj && fn)
+                -> void
+                {
+                    std::size_t const committed(m_committed.load(std::memory_order_acquire));
+                    while(m_consumed < committed)
+                    {
+                        std::size_t const idxInChunk(m_consumed % chunkRecordCount);
+                        if((m_consumed != 0u) && (idxInChunk == 0u))
+                        {
+                            // The producer has already published the next chunk before committing a record into it.
+                            Chunk * const next(m_head->m_next.load(std::memory_order_acquire));
+                            delete m_head;
+                            m_head = next;
+                        }
+                        Record & record(m_head->m_records[idxInChunk]);
+                        fn(static_cast<Record const &>(record));
+                        record = Record();
+                        ++m_consumed;
+                    }
+                }
+
+                std::uint32_t const m_threadIdx;
+
+            private:
+                std::atomic<std::size_t> m_committed;
+                Chunk * m_head;
+                Chunk * m_tail;
+                std::size_t m_consumed;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! Appends the given string to the stream as quoted and escaped JSON string.
+            inline auto writeJsonString(
+                std::ostream & os,
+                std::string const & str)
+            -> void
+            {
+                os << '"';
+                for(char const c : str)
+                {
+                    switch(c)
+                    {
+                    case '"': os << "\\\""; break;
+                    case '\\': os << "\\\\"; break;
+                    case '\n': os << "\\n"; break;
+                    case '\t': os << "\\t"; break;
+                    default:
+                        if(static_cast<unsigned char>(c) >= 0x20u)
+                        {
+                            os << c;
+                        }
+                    }
+                }
+                os << '"';
+            }
+
+            //#############################################################################
+            //! The process wide trace recorder.
+            class Tracer final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \return The tracer singleton.
+                static auto get()
+                -> Tracer &
+                {
+                    static Tracer tracer;
+                    return tracer;
+                }
+
+                //-----------------------------------------------------------------------------
+                Tracer(Tracer const &) = delete;
+                //-----------------------------------------------------------------------------
+                Tracer(Tracer &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(Tracer const &) -> Tracer & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(Tracer &&) -> Tracer & = delete;
+                //-----------------------------------------------------------------------------
+                ~Tracer()
+                {
+                    disable();
+                }
+
+                //-----------------------------------------------------------------------------
+                auto isEnabled() const noexcept
+                -> bool
+                {
+                    return m_enabled.load(std::memory_order_relaxed);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Starts recording into the given file. A previously opened trace file is finalized.
+                auto enable(
+                    std::string const & fileName)
+                -> void
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+
+                    closeFile();
+
+                    m_file.open(fileName, std::ios::out | std::ios::trunc);
+                    if(!m_file)
+                    {
+                        throw std::runtime_error("Could not open the trace file '" + fileName + "'!");
+                    }
+                    m_file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+                    m_file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"alpaka\"}}";
+
+                    m_enabled.store(true, std::memory_order_relaxed);
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Stops recording, flushes the outstanding records and finalizes the trace file.
+                auto disable()
+                -> void
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+
+                    m_enabled.store(false, std::memory_order_relaxed);
+                    closeFile();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Writes all records committed up to now to the trace file.
+                auto flush()
+                -> void
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+
+                    flushRecords();
+                    if(m_file.is_open())
+                    {
+                        m_file.flush();
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The record buffer of the calling thread.
+                auto getThreadBuffer()
+                -> ThreadBuffer &
+                {
+                    thread_local std::shared_ptr<ThreadBuffer> const spThreadBuffer(registerThread());
+                    return *spThreadBuffer;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return The nanoseconds elapsed since the tracer has been created.
+                auto now() const noexcept
+                -> std::uint64_t
+                {
+                    return
+                        static_cast<std::uint64_t>(
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - m_epoch).count());
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                Tracer() :
+                        m_epoch(std::chrono::steady_clock::now()),
+                        m_enabled(false)
+                {
+                    if(char const * const fileName = std::getenv("ALPAKA_TRACE_FILE"))
+                    {
+                        if(*fileName != '\0')
+                        {
+                            enable(fileName);
+                        }
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                auto registerThread()
+                -> std::shared_ptr<ThreadBuffer>
+                {
+                    std::lock_guard<std::mutex> lk(m_mutex);
+
+                    m_vspThreadBuffers.emplace_back(
+                        std::make_shared<ThreadBuffer>(
+                            static_cast<std::uint32_t>(m_vspThreadBuffers.size())));
+                    return m_vspThreadBuffers.back();
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Writes the outstanding records. The mutex has to be locked.
+                auto flushRecords()
+                -> void
+                {
+                    for(auto && spThreadBuffer : m_vspThreadBuffers)
+                    {
+                        std::uint32_t const tid(spThreadBuffer->m_threadIdx + 1u);
+                        spThreadBuffer->consume(
+                            [&](Record const & record)
+                            {
+                                if(!m_file.is_open())
+                                {
+                                    return;
+                                }
+                                if(m_vbThreadNamed.size() <= tid)
+                                {
+                                    m_vbThreadNamed.resize(tid + 1u, false);
+                                }
+                                if(!m_vbThreadNamed[tid])
+                                {
+                                    m_file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+                                        << ",\"args\":{\"name\":\"alpaka thread " << tid << "\"}}";
+                                    m_vbThreadNamed[tid] = true;
+                                }
+                                m_file << ",\n{\"name\":";
+                                writeJsonString(m_file, record.m_name);
+                                m_file << ",\"cat\":\"" << record.m_category << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid;
+                                writeMicroseconds(",\"ts\":", record.m_beginNs);
+                                writeMicroseconds(",\"dur\":", record.m_endNs - record.m_beginNs);
+                                m_file << ",\"args\":{\"queue\":\"0x" << std::hex << record.m_queue << std::dec << '"';
+                                if(!record.m_args.empty())
+                                {
+                                    m_file << ',' << record.m_args;
+                                }
+                                m_file << "}}";
+                            });
+                    }
+                }
+
+                //-----------------------------------------------------------------------------
+                auto writeMicroseconds(
+                    char const * key,
+                    std::uint64_t ns)
+                -> void
+                {
+                    m_file << key << (ns / 1000u) << '.';
+                    auto const frac(ns % 1000u);
+                    m_file << ((frac < 100u) ? "0" : "") << ((frac < 10u) ? "0" : "") << frac;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! Flushes the outstanding records and finalizes the trace file. The mutex has to be locked.
+                auto closeFile()
+                -> void
+                {
+                    flushRecords();
+                    if(m_file.is_open())
+                    {
+                        m_file << "\n]}\n";
+                        m_file.close();
+                    }
+                    m_vbThreadNamed.clear();
+                }
+
+            private:
+                std::chrono::steady_clock::time_point const m_epoch;
+                std::atomic<bool> m_enabled;
+                std::mutex m_mutex;
+                std::ofstream m_file;
+                std::vector<std::shared_ptr<ThreadBuffer>> m_vspThreadBuffers;
+                std::vector<bool> m_vbThreadNamed;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The identifier of the queue the calling thread is currently executing tasks for.
+            inline auto currentQueue() noexcept
+            -> std::uintptr_t &
+            {
+                thread_local std::uintptr_t queue(0u);
+                return queue;
+            }
+
+            //#############################################################################
+            //! Marks the calling thread as executing tasks of the given queue during its lifetime.
+            class QueueScope final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                explicit QueueScope(
+                    void const * queue) noexcept :
+                        m_previousQueue(currentQueue())
+                {
+                    currentQueue() = reinterpret_cast<std::uintptr_t>(queue);
+                }
+                //-----------------------------------------------------------------------------
+                QueueScope(QueueScope const &) = delete;
+                //-----------------------------------------------------------------------------
+                QueueScope(QueueScope &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(QueueScope const &) -> QueueScope & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(QueueScope &&) -> QueueScope & = delete;
+                //-----------------------------------------------------------------------------
+                ~QueueScope()
+                {
+                    currentQueue() = m_previousQueue;
+                }
+
+            private:
+                std::uintptr_t const m_previousQueue;
+            };
+
+            //#############################################################################
+            //! Records the time span of its lifetime if tracing is enabled.
+            class ScopedRecord final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! \param category The record category. Has to be a string literal.
+                //! \param describe A function object returning the record name and the JSON encoded arguments.
+                //!        It is only called if tracing is enabled.
+                template<
+                    typename TDescribe>
+                ScopedRecord(
+                    char const * category,
+                    TDescribe && describe) :
+                        m_bEnabled(Tracer::get().isEnabled()),
+                        m_record()
+                {
+                    if(m_bEnabled)
+                    {
+                        auto description(describe());
+                        m_record.m_category = category;
+                        m_record.m_name = std::move(description.first);
+                        m_record.m_args = std::move(description.second);
+                        m_record.m_queue = currentQueue();
+                        m_record.m_beginNs = Tracer::get().now();
+                    }
+                }
+                //-----------------------------------------------------------------------------
+                ScopedRecord(ScopedRecord const &) = delete;
+                //-----------------------------------------------------------------------------
+                ScopedRecord(ScopedRecord &&) = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ScopedRecord const &) -> ScopedRecord & = delete;
+                //-----------------------------------------------------------------------------
+                auto operator=(ScopedRecord &&) -> ScopedRecord & = delete;
+                //-----------------------------------------------------------------------------
+                ~ScopedRecord()
+                {
+                    if(m_bEnabled)
+                    {
+                        auto & tracer(Tracer::get());
+                        m_record.m_endNs = tracer.now();
+                        tracer.getThreadBuffer().push(std::move(m_record));
+                    }
+                }
+
+            private:
+                bool const m_bEnabled;
+                Record m_record;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! Records the time span from the given begin until now if tracing is enabled.
+            //!
+            //! This is for operations which do not coincide with a scope, for example a queue waiting for an event without running a task.
+            //! \param category The record category. Has to be a string literal.
+            //! \param describe A function object returning the record name and the JSON encoded arguments.
+            //!        It is only called if tracing is enabled.
+            //! \param beginNs The begin of the span as returned by Tracer::now.
+            template<
+                typename TDescribe>
+            auto recordSpan(
+                char const * category,
+                TDescribe && describe,
+                std::uint64_t beginNs)
+            -> void
+            {
+                auto & tracer(Tracer::get());
+                if(tracer.isEnabled())
+                {
+                    auto description(describe());
+                    Record record;
+                    record.m_category = category;
+                    record.m_name = std::move(description.first);
+                    record.m_args = std::move(description.second);
+                    record.m_queue = currentQueue();
+                    record.m_beginNs = beginNs;
+                    record.m_endNs = tracer.now();
+                    tracer.getThreadBuffer().push(std::move(record));
+                }
+            }
+
+            //#############################################################################
+            //! Builds the JSON encoded arguments of a record.
+            class Args final
+            {
+            public:
+                //-----------------------------------------------------------------------------
+                //! Adds an integral argument.
+                template<
+                    typename T,
+                    std::enable_if_t<std::is_integral<T>::value, int> = 0>
+                auto add(
+                    char const * key,
+                    T const & value)
+                -> Args &
+                {
+                    writeKey(key);
+                    m_ss << value;
+                    return *this;
+                }
+                //-----------------------------------------------------------------------------
+                //! Adds an argument using its stream output operator.
+                template<
+                    typename T,
+                    std::enable_if_t<!std::is_integral<T>::value, int> = 0>
+                auto add(
+                    char const * key,
+                    T const & value)
+                -> Args &
+                {
+                    writeKey(key);
+                    std::ostringstream ss;
+                    ss << value;
+                    writeJsonString(m_ss, ss.str());
+                    return *this;
+                }
+                //-----------------------------------------------------------------------------
+                auto str() const
+                -> std::string
+                {
+                    return m_ss.str();
+                }
+
+            private:
+                //-----------------------------------------------------------------------------
+                auto writeKey(
+                    char const * key)
+                -> void
+                {
+                    if(m_ss.tellp() != std::streampos(0))
+                    {
+                        m_ss << ',';
+                    }
+                    m_ss << '"' << key << "\":";
+                }
+
+                std::ostringstream m_ss;
+            };
+
+            //-----------------------------------------------------------------------------
+            //! \return The human readable name of the given type.
+            template<
+                typename T>
+            auto getTypeName()
+            -> std::string
+            {
+                return boost::core::demangle(typeid(T).name());
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The description of a kernel execution.
+            template<
+                typename TAcc,
+                typename TKernelFnObj,
+                typename TWorkDiv>
+            auto describeKernel(
+                TWorkDiv const & workDiv)
+            -> std::pair<std::string, std::string>
+            {
+                return
+                    std::make_pair(
+                        getTypeName<TKernelFnObj>(),
+                        Args()
+                            .add("acc", getTypeName<TAcc>())
+                            .add("workDiv", workDiv)
+                            .str());
+            }
+
+            //-----------------------------------------------------------------------------
+            //! \return The description of a memory operation.
+            template<
+                typename TExtent>
+            auto describeMemOp(
+                char const * name,
+                TExtent const & extent,
+                std::size_t bytes)
+            -> std::pair<std::string, std::string>
+            {
+                return
+                    std::make_pair(
+                        std::string(name),
+                        Args()
+                            .add("extent", extent)
+                            .add("bytes", bytes)
+                            .str());
+            }
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return If the records are currently collected.
+        ALPAKA_FN_HOST inline auto isEnabled()
+        -> bool
+        {
+            return detail::Tracer::get().isEnabled();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Starts collecting records and writes them to the given Chrome trace event JSON file.
+        //! This overrides the file given by the environment variable ALPAKA_TRACE_FILE.
+        ALPAKA_FN_HOST inline auto enable(
+            std::string const & fileName)
+        -> void
+        {
+            detail::Tracer::get().enable(fileName);
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Stops collecting records and finalizes the trace file.
+        //! This happens automatically at program exit.
+        ALPAKA_FN_HOST inline auto disable()
+        -> void
+        {
+            detail::Tracer::get().disable();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Writes all records collected up to now into the trace file.
+        //! The per-thread buffers grow until they are flushed, so long running applications should call this regularly.
+        ALPAKA_FN_HOST inline auto flush()
+        -> void
+        {
+            detail::Tracer::get().flush();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Define ALPAKA_TRACE_SCOPE and ALPAKA_TRACE_QUEUE_SCOPE.
+#ifdef ALPAKA_TRACE_ENABLED
+    //! Records the remaining lifetime of the current scope.
+    //! The second argument is a function object returning a pair of the name and the JSON encoded arguments.
+    #define ALPAKA_TRACE_SCOPE(category, ...)\
+        ::alpaka::trace::detail::ScopedRecord const alpakaTraceScopedRecord(category, __VA_ARGS__)
+    //! Attributes all records of the remaining lifetime of the current scope to the given queue.
+    #define ALPAKA_TRACE_QUEUE_SCOPE(queue)\
+        ::alpaka::trace::detail::QueueScope const alpakaTraceQueueScope(queue)
+#else
+    #define ALPAKA_TRACE_SCOPE(category, ...)
+    #define ALPAKA_TRACE_QUEUE_SCOPE(queue)\
+        ::alpaka::ignore_unused(queue)
+#endif
@@ -0,0 +1,536 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/workdiv/WorkDivHelpers.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <alpaka/acc/Traits.hpp>
+#include <alpaka/dev/Traits.hpp>
+#include <alpaka/dim/Traits.hpp>
+#include <alpaka/extent/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/queue/Traits.hpp>
+#include <alpaka/wait/Traits.hpp>
+
+#include <alpaka/vec/Vec.hpp>
+
+#include <alpaka/core/Common.hpp>
+
+#include <boost/core/demangle.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// The work division autotuner times candidate work divisions of a kernel and remembers the fastest one.
+//
+// The results are keyed by the device name (the CPU name for CPU devices), the accelerator, the kernel type
+// and the extent class of the grid (the bit width of the extent in each dimension).
+// They are kept in memory and appended to a cache file, so subsequent runs of the program start with the tuned
+// work division without timing anything.
+// The cache file is given by the environment variable ALPAKA_WORKDIV_TUNE_FILE. If it is not set,
+// the file .alpaka_workdiv_tune in the home directory is used. alpaka::WorkDivTuneCache::setFileName overrides both.
+namespace alpaka
+{
+    //#############################################################################
+    //! The process wide cache of tuned work divisions.
+    //!
+    //! An entry stores the block thread extent and the thread element extent.
+    //! The grid block extent is recomputed from the actual grid element extent when the entry is used.
+    class WorkDivTuneCache final
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        //! \return The cache singleton.
+        static auto get()
+        -> WorkDivTuneCache &
+        {
+            static WorkDivTuneCache cache;
+            return cache;
+        }
+
+        //-----------------------------------------------------------------------------
+        WorkDivTuneCache(WorkDivTuneCache const &) = delete;
+        //-----------------------------------------------------------------------------
+        WorkDivTuneCache(WorkDivTuneCache &&) = delete;
+        //-----------------------------------------------------------------------------
+        auto operator=(WorkDivTuneCache const &) -> WorkDivTuneCache & = delete;
+        //-----------------------------------------------------------------------------
+        auto operator=(WorkDivTuneCache &&) -> WorkDivTuneCache & = delete;
+        //-----------------------------------------------------------------------------
+        ~WorkDivTuneCache() = default;
+
+        //-----------------------------------------------------------------------------
+        //! Drops all entries held in memory and loads the given cache file.
+        //! An empty file name keeps the results in memory only.
+        auto setFileName(
+            std::string const & fileName)
+        -> void
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+
+            m_fileName = fileName;
+            m_entries.clear();
+            load();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return The name of the cache file. It is empty if the results are kept in memory only.
+        auto getFileName() const
+        -> std::string
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+
+            return m_fileName;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \param key The key of the entry.
+        //! \param[out] extents The block thread extent followed by the thread element extent.
+        //! \return If an entry for the key exists.
+        auto find(
+            std::string const & key,
+            std::vector<std::size_t> & extents) const
+        -> bool
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+
+            auto const it(m_entries.find(key));
+            if(it == m_entries.end())
+            {
+                return false;
+            }
+            extents = it->second;
+            return true;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Stores the entry in memory and appends it to the cache file.
+        auto insert(
+            std::string const & key,
+            std::vector<std::size_t> const & extents)
+        -> void
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+
+            m_entries[key] = extents;
+
+            if(!m_fileName.empty())
+            {
+                // A cache file that can not be written only costs the tuning in the next run.
+                std::ofstream file(m_fileName, std::ios::out | std::ios::app);
+                if(file)
+                {
+                    file << key;
+                    for(auto const & extent : extents)
+                    {
+                        file << '\t' << extent;
+                    }
+                    file << '\n';
+                }
+            }
+        }
+
+    private:
+        //-----------------------------------------------------------------------------
+        WorkDivTuneCache()
+        {
+            if(char const * const fileName = std::getenv("ALPAKA_WORKDIV_TUNE_FILE"))
+            {
+                m_fileName = fileName;
+            }
+            else if(char const * const home = std::getenv("HOME"))
+            {
+                m_fileName = std::string(home) + "/.alpaka_workdiv_tune";
+            }
+            else if(char const * const userProfile = std::getenv("USERPROFILE"))
+            {
+                m_fileName = std::string(userProfile) + "\\.alpaka_workdiv_tune";
+            }
+            load();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! Reads the cache file. Later lines override earlier ones. The mutex has to be locked.
+        //!
+        //! Each line holds the four tab separated key fields followed by the tab separated extents.
+        auto load()
+        -> void
+        {
+            if(m_fileName.empty())
+            {
+                return;
+            }
+            std::ifstream file(m_fileName);
+            std::string line;
+            while(std::getline(file, line))
+            {
+                std::vector<std::string> fields;
+                std::istringstream iss(line);
+                std::string field;
+                while(std::getline(iss, field, '\t'))
+                {
+                    fields.push_back(field);
+                }
+                // The key has four fields, the extents at least two.
+                if(fields.size() < 6u)
+                {
+                    continue;
+                }
+                std::vector<std::size_t> extents;
+                try
+                {
+                    for(auto it(fields.begin() + 4); it != fields.end(); ++it)
+                    {
+                        extents.push_back(static_cast<std::size_t>(std::stoull(*it)));
+                    }
+                }
+                catch(std::exception const &)
+                {
+                    continue;
+                }
+                m_entries[fields[0] + '\t' + fields[1] + '\t' + fields[2] + '\t' + fields[3]] = extents;
+            }
+        }
+
+    private:
+        std::mutex mutable m_mutex;
+        std::string m_fileName;
+        std::map<std::string, std::vector<std::size_t>> m_entries;
+    };
+
+    namespace detail
+    {
+        //-----------------------------------------------------------------------------
+        //! \return The string with tabs and line breaks replaced so it can be used as a field of the cache file.
+        inline auto sanitizeWorkDivTuneField(
+            std::string str)
+        -> std::string
+        {
+            for(auto & c : str)
+            {
+                if((c == '\t') || (c == '\n') || (c == '\r'))
+                {
+                    c = ' ';
+                }
+            }
+            return str;
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return The extent class of the grid element extent.
+        //!
+        //! Extents with the same bit width in all dimensions share the same class and thus the same tuned work division.
+        template<
+            typename TDim,
+            typename TIdx>
+        ALPAKA_FN_HOST auto getWorkDivTuneExtentClass(
+            Vec<TDim, TIdx> const & gridElemExtent)
+        -> std::string
+        {
+            std::ostringstream oss;
+            for(typename TDim::value_type i(0u); i<TDim::value; ++i)
+            {
+                std::size_t bitWidth(0u);
+                for(auto extent(gridElemExtent[i]); extent > static_cast<TIdx>(0); extent /= static_cast<TIdx>(2))
+                {
+                    ++bitWidth;
+                }
+                oss << (i == 0u ? "" : ",") << bitWidth;
+            }
+            return oss.str();
+        }
+
+        //-----------------------------------------------------------------------------
+        //! \return The work division covering the grid element extent with the given block thread and thread element extents.
+        template<
+            typename TDim,
+            typename TIdx>
+        ALPAKA_FN_HOST auto makeWorkDivCoveringGrid(
+            Vec<TDim, TIdx> const & gridElemExtent,
+            Vec<TDim, TIdx> const & blockThreadExtent,
+            Vec<TDim, TIdx> const & threadElemExtent)
+        -> WorkDivMembers<TDim, TIdx>
+        {
+            auto gridBlockExtent(Vec<TDim, TIdx>::ones());
+            for(typename TDim::value_type i(0u); i<TDim::value; ++i)
+            {
+                auto const blockElemExtent(blockThreadExtent[i] * threadElemExtent[i]);
+                gridBlockExtent[i] = static_cast<TIdx>((gridElemExtent[i] + blockElemExtent - static_cast<TIdx>(1)) / blockElemExtent);
+            }
+            return
+                WorkDivMembers<TDim, TIdx>(
+                    gridBlockExtent,
+                    blockThreadExtent,
+                    threadElemExtent);
+        }
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \tparam TAcc The accelerator the work divisions have to be valid for.
+    //! \param dev The device the work divisions have to be valid for.
+    //! \param gridElemExtent The full extent of elements in the grid.
+    //! \return The candidate work divisions covering the grid element extent.
+    //!
+    //! For each power of two block thread count the block is shaped by subDivideGridElems once without restrictions
+    //! and once as close to equal as possible. Each of them is combined with a power of two number of elements per thread
+    //! in the innermost dimension. The grid extent is rounded up, so the kernel has to check its indices against the extent.
+    template<
+        typename TAcc,
+        typename TGridElemExtent,
+        typename TDev>
+    ALPAKA_FN_HOST auto getWorkDivCandidates(
+        TDev const & dev,
+        TGridElemExtent const & gridElemExtent)
+    -> std::vector<WorkDivMembers<Dim<TAcc>, Idx<TAcc>>>
+    {
+        static_assert(
+            Dim<TGridElemExtent>::value == Dim<TAcc>::value,
+            "The dimension of TAcc and the dimension of TGridElemExtent have to be identical!");
+        static_assert(
+            std::is_same<Idx<TGridElemExtent>, Idx<TAcc>>::value,
+            "The idx type of TAcc and the idx type of TGridElemExtent have to be identical!");
+
+        static_assert(
+            Dim<TAcc>::value > 0u,
+            "The work division can only be tuned for accelerators with at least one dimension!");
+
+        using DimAcc = Dim<TAcc>;
+        using IdxAcc = Idx<TAcc>;
+
+        auto const accDevProps(getAccDevProps<TAcc>(dev));
+        auto const extent(extent::getExtentVec(gridElemExtent));
+        constexpr auto innerDim(DimAcc::value - 1u);
+
+        std::vector<WorkDivMembers<DimAcc, IdxAcc>> candidates;
+        std::set<std::vector<IdxAcc>> shapes;
+
+        for(IdxAcc elemCount(1u);
+            (elemCount <= accDevProps.m_threadElemExtentMax[innerDim])
+            && (elemCount <= accDevProps.m_threadElemCountMax);
+            elemCount *= static_cast<IdxAcc>(2))
+        {
+            auto threadElemExtent(Vec<DimAcc, IdxAcc>::ones());
+            threadElemExtent[innerDim] = elemCount;
+
+            for(IdxAcc threadCount(1u); threadCount <= accDevProps.m_blockThreadCountMax; threadCount *= static_cast<IdxAcc>(2))
+            {
+                auto props(accDevProps);
+                props.m_blockThreadCountMax = threadCount;
+
+                for(auto const restrictions : {GridBlockExtentSubDivRestrictions::Unrestricted, GridBlockExtentSubDivRestrictions::CloseToEqualExtent})
+                {
+                    auto const workDiv(
+                        subDivideGridElems(
+                            extent,
+                            threadElemExtent,
+                            props,
+                            false,
+                            restrictions));
+                    auto const blockThreadExtent(getWorkDiv<Block, Threads>(workDiv));
+                    auto const usedThreadElemExtent(getWorkDiv<Thread, Elems>(workDiv));
+
+                    std::vector<IdxAcc> shape;
+                    for(typename DimAcc::value_type i(0u); i<DimAcc::value; ++i)
+                    {
+                        shape.push_back(blockThreadExtent[i]);
+                        shape.push_back(usedThreadElemExtent[i]);
+                    }
+                    if(shapes.insert(shape).second && isValidWorkDiv(accDevProps, workDiv))
+                    {
+                        candidates.push_back(workDiv);
+                    }
+                }
+
+                // Avoid overflowing the index type.
+                if(threadCount > std::numeric_limits<IdxAcc>::max() / static_cast<IdxAcc>(2))
+                {
+                    break;
+                }
+            }
+
+            // There is no point in more elements per thread than elements in the grid.
+            if((elemCount >= extent[innerDim]) || (elemCount > std::numeric_limits<IdxAcc>::max() / static_cast<IdxAcc>(2)))
+            {
+                break;
+            }
+        }
+
+        return candidates;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Times the kernel with each of the candidate work divisions.
+    //!
+    //! Each candidate is executed once for warm up and then repetitionCount times.
+    //! Candidates that fail to execute are skipped.
+    //! The kernel is executed many times, so it has to tolerate being run repeatedly on the same arguments.
+    //!
+    //! \param queue The queue used to execute the kernel.
+    //! \param candidates The candidate work divisions. It must not be empty.
+    //! \param repetitionCount The number of timed executions per candidate.
+    //! \param kernelFnObj The kernel function object.
+    //! \param args,... The kernel invocation arguments.
+    //! \return The fastest work division.
+    template<
+        typename TAcc,
+        typename TQueue,
+        typename TWorkDiv,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto tuneWorkDiv(
+        TQueue & queue,
+        std::vector<TWorkDiv> const & candidates,
+        std::size_t const & repetitionCount,
+        TKernelFnObj const & kernelFnObj,
+        TArgs const & ... args)
+    -> TWorkDiv
+    {
+        if(candidates.empty())
+        {
+            throw std::invalid_argument("There are no candidate work divisions to tune!");
+        }
+
+        auto best(candidates.front());
+        auto bestDuration(std::chrono::steady_clock::duration::max());
+        bool found(false);
+
+        for(auto const & candidate : candidates)
+        {
+            try
+            {
+                enqueue(queue, createTaskKernel<TAcc>(candidate, kernelFnObj, args...));
+                wait(queue);
+
+                auto const begin(std::chrono::steady_clock::now());
+                for(std::size_t r(0u); r < repetitionCount; ++r)
+                {
+                    enqueue(queue, createTaskKernel<TAcc>(candidate, kernelFnObj, args...));
+                }
+                wait(queue);
+                auto const duration(std::chrono::steady_clock::now() - begin);
+
+                if(duration < bestDuration)
+                {
+                    best = candidate;
+                    bestDuration = duration;
+                    found = true;
+                }
+            }
+            catch(std::exception const &)
+            {
+                // The candidate exceeds a limit not described by the device properties (e.g. registers or shared memory).
+            }
+        }
+
+        if(!found)
+        {
+            throw std::runtime_error("None of the candidate work divisions could be executed!");
+        }
+
+        return best;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \return The tuned work division for executing the kernel on the grid element extent.
+    //!
+    //! The first call for a device, accelerator, kernel type and extent class times the candidates given by getWorkDivCandidates
+    //! and stores the fastest one in the WorkDivTuneCache. Subsequent calls, also in later runs of the program, return it without timing.
+    //! The kernel is executed many times while tuning, so it has to tolerate being run repeatedly on the same arguments.
+    //!
+    //! \param queue The queue used to execute the kernel.
+    //! \param gridElemExtent The full extent of elements in the grid.
+    //! \param kernelFnObj The kernel function object.
+    //! \param args,... The kernel invocation arguments.
+    template<
+        typename TAcc,
+        typename TQueue,
+        typename TGridElemExtent,
+        typename TKernelFnObj,
+        typename... TArgs>
+    ALPAKA_FN_HOST auto getTunedWorkDiv(
+        TQueue & queue,
+        TGridElemExtent const & gridElemExtent,
+        TKernelFnObj const & kernelFnObj,
+        TArgs const & ... args)
+    -> WorkDivMembers<Dim<TAcc>, Idx<TAcc>>
+    {
+        using DimAcc = Dim<TAcc>;
+        using IdxAcc = Idx<TAcc>;
+
+        auto const dev(getDev(queue));
+        auto const extent(extent::getExtentVec(gridElemExtent));
+
+        auto const key(
+            detail::sanitizeWorkDivTuneField(getName(dev)) + '\t'
+            + detail::sanitizeWorkDivTuneField(getAccName<TAcc>()) + '\t'
+            + detail::sanitizeWorkDivTuneField(boost::core::demangle(typeid(TKernelFnObj).name())) + '\t'
+            + detail::getWorkDivTuneExtentClass(extent));
+
+        auto & cache(WorkDivTuneCache::get());
+
+        std::vector<std::size_t> extents;
+        if(cache.find(key, extents) && (extents.size() == 2u * DimAcc::value))
+        {
+            auto blockThreadExtent(Vec<DimAcc, IdxAcc>::ones());
+            auto threadElemExtent(Vec<DimAcc, IdxAcc>::ones());
+            for(typename DimAcc::value_type i(0u); i<DimAcc::value; ++i)
+            {
+                blockThreadExtent[i] = static_cast<IdxAcc>(extents[i]);
+                threadElemExtent[i] = static_cast<IdxAcc>(extents[DimAcc::value + i]);
+            }
+            auto workDiv(detail::makeWorkDivCoveringGrid(extent, blockThreadExtent, threadElemExtent));
+            // An entry written for other device properties is tuned again.
+            if(isValidWorkDiv<TAcc>(dev, workDiv))
+            {
+                return workDiv;
+            }
+        }
+
+        auto workDiv(
+            tuneWorkDiv<TAcc>(
+                queue,
+                getWorkDivCandidates<TAcc>(dev, extent),
+                3u,
+                kernelFnObj,
+                args...));
+
+        auto const blockThreadExtent(getWorkDiv<Block, Threads>(workDiv));
+        auto const threadElemExtent(getWorkDiv<Thread, Elems>(workDiv));
+        extents.clear();
+        for(typename DimAcc::value_type i(0u); i<DimAcc::value; ++i)
+        {
+            extents.push_back(static_cast<std::size_t>(blockThreadExtent[i]));
+        }
+        for(typename DimAcc::value_type i(0u); i<DimAcc::value; ++i)
+        {
+            extents.push_back(static_cast<std::size_t>(threadElemExtent[i]));
+        }
+        cache.insert(key, extents);
+
+        return workDiv;
+    }
+}
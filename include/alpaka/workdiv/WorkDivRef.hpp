@@ -0,0 +1,136 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/workdiv/Traits.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Concepts.hpp>
+#include <alpaka/vec/Vec.hpp>
+
+namespace alpaka
+{
+    //#############################################################################
+    //! A work division referencing the work division members of another object.
+    //!
+    //! Contrary to WorkDivMembers, creating it does not copy the extents.
+    template<
+        typename TDim,
+        typename TIdx>
+    class WorkDivRef : public concepts::Implements<ConceptWorkDiv, WorkDivRef<TDim, TIdx>>
+    {
+    public:
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST_ACC WorkDivRef(
+            WorkDivMembers<TDim, TIdx> const & workDiv) :
+                m_workDiv(workDiv)
+        {}
+        //-----------------------------------------------------------------------------
+        WorkDivRef(WorkDivRef const &) = delete;
+        //-----------------------------------------------------------------------------
+        WorkDivRef(WorkDivRef &&) = delete;
+        //-----------------------------------------------------------------------------
+        auto operator=(WorkDivRef const &) -> WorkDivRef & = delete;
+        //-----------------------------------------------------------------------------
+        auto operator=(WorkDivRef &&) -> WorkDivRef & = delete;
+        //-----------------------------------------------------------------------------
+        /*virtual*/ ~WorkDivRef() = default;
+
+    public:
+        WorkDivMembers<TDim, TIdx> const & m_workDiv;
+    };
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The WorkDivRef dimension get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct DimType<
+            WorkDivRef<TDim, TIdx>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The WorkDivRef idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct IdxType<
+            WorkDivRef<TDim, TIdx>>
+        {
+            using type = TIdx;
+        };
+
+        //#############################################################################
+        //! The WorkDivRef grid block extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetWorkDiv<
+            WorkDivRef<TDim, TIdx>,
+            origin::Grid,
+            unit::Blocks>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of blocks in each dimension of the grid.
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivRef<TDim, TIdx> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                return workDiv.m_workDiv.m_gridBlockExtent;
+            }
+        };
+
+        //#############################################################################
+        //! The WorkDivRef block thread extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetWorkDiv<
+            WorkDivRef<TDim, TIdx>,
+            origin::Block,
+            unit::Threads>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of threads in each dimension of a block.
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivRef<TDim, TIdx> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                return workDiv.m_workDiv.m_blockThreadExtent;
+            }
+        };
+
+        //#############################################################################
+        //! The WorkDivRef thread element extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx>
+        struct GetWorkDiv<
+            WorkDivRef<TDim, TIdx>,
+            origin::Thread,
+            unit::Elems>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of elements in each dimension of a thread.
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivRef<TDim, TIdx> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                return workDiv.m_workDiv.m_threadElemExtent;
+            }
+        };
+    }
+}
@@ -0,0 +1,298 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/workdiv/Traits.hpp>
+#include <alpaka/idx/Traits.hpp>
+
+#include <alpaka/vec/Vec.hpp>
+#include <alpaka/core/Assert.hpp>
+#include <alpaka/core/Common.hpp>
+#include <alpaka/core/Unused.hpp>
+
+#include <iosfwd>
+#include <type_traits>
+#include <utility>
+
+namespace alpaka
+{
+    namespace detail
+    {
+        //#############################################################################
+        //! The product of the values of an integer sequence.
+        template<
+            typename TIntegerSequence>
+        struct IntegerSequenceProduct;
+        //#############################################################################
+        template<
+            typename T>
+        struct IntegerSequenceProduct<
+            std::integer_sequence<T>>
+        {
+            static constexpr T value = static_cast<T>(1u);
+        };
+        //#############################################################################
+        template<
+            typename T,
+            T Tval,
+            T... Tvals>
+        struct IntegerSequenceProduct<
+            std::integer_sequence<T, Tval, Tvals...>>
+        {
+            static constexpr T value = static_cast<T>(Tval * IntegerSequenceProduct<std::integer_sequence<T, Tvals...>>::value);
+        };
+
+        //-----------------------------------------------------------------------------
+        //! \return The values of the integer sequence as vector.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TDim,
+            typename TIdx,
+            TIdx... Tvals>
+        ALPAKA_FN_HOST_ACC auto integerSequenceToVec(
+            std::integer_sequence<TIdx, Tvals...> const &)
+        -> Vec<TDim, TIdx>
+        {
+            static_assert(
+                TDim::value == sizeof...(Tvals),
+                "The number of values of the integer sequence has to be identical to the dimension!");
+
+            return Vec<TDim, TIdx>(Tvals...);
+        }
+    }
+
+    //#############################################################################
+    //! A work division whose block thread and thread element extents are compile time constants.
+    //!
+    //! Only the grid block extent is stored.
+    //! Kernels knowing their block and element extents can bind this type to the indices of the accelerator:
+    //! \code
+    //! WorkDiv const workDiv(acc);
+    //! auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc, workDiv));
+    //! auto const firstElemIdx(alpaka::getIdxThreadFirstElem(acc, gridThreadIdx, alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(workDiv)));
+    //! \endcode
+    //! All index computations involving the block thread and thread element extents then multiply and divide by constants.
+    //!
+    //! \tparam TBlockThreadExtent The std::integer_sequence<TIdx, ...> of the number of threads in each dimension of a block.
+    //! \tparam TThreadElemExtent The std::integer_sequence<TIdx, ...> of the number of elements in each dimension of a thread.
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TBlockThreadExtent,
+        typename TThreadElemExtent>
+    class WorkDivStatic : public concepts::Implements<ConceptWorkDiv, WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>>
+    {
+        static_assert(
+            TBlockThreadExtent::size() == TDim::value && TThreadElemExtent::size() == TDim::value,
+            "The static extents have to be of the dimension of the work division!");
+        static_assert(
+            std::is_same<typename TBlockThreadExtent::value_type, TIdx>::value && std::is_same<typename TThreadElemExtent::value_type, TIdx>::value,
+            "The values of the static extents have to be of the idx type of the work division!");
+
+    public:
+        using BlockThreadExtent = TBlockThreadExtent;
+        using ThreadElemExtent = TThreadElemExtent;
+
+        //! The number of threads in a block.
+        static constexpr TIdx blockThreadCount = detail::IntegerSequenceProduct<TBlockThreadExtent>::value;
+        //! The number of elements of a thread.
+        static constexpr TIdx threadElemCount = detail::IntegerSequenceProduct<TThreadElemExtent>::value;
+
+        //-----------------------------------------------------------------------------
+        ALPAKA_FN_HOST_ACC WorkDivStatic() = delete;
+        //-----------------------------------------------------------------------------
+        //! \param gridBlockExtent The number of blocks in each dimension of the grid.
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC explicit WorkDivStatic(
+            Vec<TDim, TIdx> const & gridBlockExtent) :
+                m_gridBlockExtent(gridBlockExtent)
+        {}
+        //-----------------------------------------------------------------------------
+        //! Creates the static work division of a kernel execution from its runtime work division, e.g. the accelerator.
+        //!
+        //! The runtime block thread and thread element extents have to be identical to the static ones.
+        ALPAKA_NO_HOST_ACC_WARNING
+        template<
+            typename TWorkDiv>
+        ALPAKA_FN_HOST_ACC explicit WorkDivStatic(
+            TWorkDiv const & other) :
+                m_gridBlockExtent(subVecEnd<TDim>(getWorkDiv<Grid, Blocks>(other)))
+        {
+            ALPAKA_ASSERT(subVecEnd<TDim>(getWorkDiv<Block, Threads>(other)) == blockThreadExtent());
+            ALPAKA_ASSERT(subVecEnd<TDim>(getWorkDiv<Thread, Elems>(other)) == threadElemExtent());
+        }
+        //-----------------------------------------------------------------------------
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC WorkDivStatic(WorkDivStatic const &) = default;
+        //-----------------------------------------------------------------------------
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC WorkDivStatic(WorkDivStatic &&) = default;
+        //-----------------------------------------------------------------------------
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC auto operator=(WorkDivStatic const &) -> WorkDivStatic & = default;
+        //-----------------------------------------------------------------------------
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC auto operator=(WorkDivStatic &&) -> WorkDivStatic & = default;
+        //-----------------------------------------------------------------------------
+        ALPAKA_NO_HOST_ACC_WARNING
+        /*virtual*/ ALPAKA_FN_HOST_ACC ~WorkDivStatic() = default;
+
+        //-----------------------------------------------------------------------------
+        //! \return The number of threads in each dimension of a block.
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC static auto blockThreadExtent()
+        -> Vec<TDim, TIdx>
+        {
+            return detail::integerSequenceToVec<TDim>(TBlockThreadExtent());
+        }
+        //-----------------------------------------------------------------------------
+        //! \return The number of elements in each dimension of a thread.
+        ALPAKA_NO_HOST_ACC_WARNING
+        ALPAKA_FN_HOST_ACC static auto threadElemExtent()
+        -> Vec<TDim, TIdx>
+        {
+            return detail::integerSequenceToVec<TDim>(TThreadElemExtent());
+        }
+
+    public:
+        Vec<TDim, TIdx> m_gridBlockExtent;
+    };
+
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TBlockThreadExtent,
+        typename TThreadElemExtent>
+    constexpr TIdx WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>::blockThreadCount;
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TBlockThreadExtent,
+        typename TThreadElemExtent>
+    constexpr TIdx WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>::threadElemCount;
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TDim,
+        typename TIdx,
+        typename TBlockThreadExtent,
+        typename TThreadElemExtent>
+    ALPAKA_FN_HOST auto operator<<(
+        std::ostream & os,
+        WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent> const & workDiv)
+    -> std::ostream &
+    {
+        return (os
+            << "{gridBlockExtent: " << workDiv.m_gridBlockExtent
+            << ", blockThreadExtent: " << workDiv.blockThreadExtent()
+            << ", threadElemExtent: " << workDiv.threadElemExtent()
+            << "}");
+    }
+
+    namespace traits
+    {
+        //#############################################################################
+        //! The WorkDivStatic dimension get trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TBlockThreadExtent,
+            typename TThreadElemExtent>
+        struct DimType<
+            WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>>
+        {
+            using type = TDim;
+        };
+
+        //#############################################################################
+        //! The WorkDivStatic idx type trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TBlockThreadExtent,
+            typename TThreadElemExtent>
+        struct IdxType<
+            WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>>
+        {
+            using type = TIdx;
+        };
+
+        //#############################################################################
+        //! The WorkDivStatic grid block extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TBlockThreadExtent,
+            typename TThreadElemExtent>
+        struct GetWorkDiv<
+            WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>,
+            origin::Grid,
+            unit::Blocks>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of blocks in each dimension of the grid.
+            ALPAKA_NO_HOST_ACC_WARNING
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                return workDiv.m_gridBlockExtent;
+            }
+        };
+
+        //#############################################################################
+        //! The WorkDivStatic block thread extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TBlockThreadExtent,
+            typename TThreadElemExtent>
+        struct GetWorkDiv<
+            WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>,
+            origin::Block,
+            unit::Threads>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of threads in each dimension of a block.
+            ALPAKA_NO_HOST_ACC_WARNING
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                alpaka::ignore_unused(workDiv);
+                return WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>::blockThreadExtent();
+            }
+        };
+
+        //#############################################################################
+        //! The WorkDivStatic thread element extent trait specialization.
+        template<
+            typename TDim,
+            typename TIdx,
+            typename TBlockThreadExtent,
+            typename TThreadElemExtent>
+        struct GetWorkDiv<
+            WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>,
+            origin::Thread,
+            unit::Elems>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The number of elements in each dimension of a thread.
+            ALPAKA_NO_HOST_ACC_WARNING
+            ALPAKA_FN_HOST_ACC static auto getWorkDiv(
+                WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent> const & workDiv)
+            -> Vec<TDim, TIdx>
+            {
+                alpaka::ignore_unused(workDiv);
+                return WorkDivStatic<TDim, TIdx, TBlockThreadExtent, TThreadElemExtent>::threadElemExtent();
+            }
+        };
+    }
+}
@@ -94,6 +94,13 @@ else
     # If the variable is not set, the backend will most probably be used by default so we install it.
     export ALPAKA_CI_INSTALL_FIBERS="ON"
 fi
+if [ ! -z "${ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE+x}" ]
+then
+    if [ "${ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE}" = "ON" ]
+    then
+        export ALPAKA_CI_INSTALL_FIBERS="ON"
+    fi
+fi
 
 
 # GCC-5.5 has broken avx512vlintrin.h in Release mode with NVCC 9.X
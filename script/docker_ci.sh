@@ -61,6 +61,10 @@ if [ ! -z "${ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE=${ALPAKA_ACC_CPU_B_SEQ_T_FIBERS_ENABLE}")
 fi
+if [ ! -z "${ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE+x}" ]
+then
+    ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE=${ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLE}")
+fi
 if [ ! -z "${ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE=${ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLE}")
@@ -69,6 +73,10 @@ if [ ! -z "${ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE=${ALPAKA_ACC_CPU_B_SEQ_T_OMP2_ENABLE}")
 fi
+if [ ! -z "${ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS+x}" ]
+then
+    ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS=${ALPAKA_OMP2_THREADS_CONCURRENT_BLOCKS}")
+fi
 if [ ! -z "${ALPAKA_ACC_ANY_BT_OMP5_ENABLE+x}" ]
 then
     ALPAKA_DOCKER_ENV_LIST+=("--env" "ALPAKA_ACC_ANY_BT_OMP5_ENABLE=${ALPAKA_ACC_ANY_BT_OMP5_ENABLE}")
@@ -71,6 +71,17 @@ namespace alpaka
                 typename TIdx>
             using AccCpuFibersIfAvailableElseInt = int;
 #endif
+#if defined(ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED)
+            template<
+                typename TDim,
+                typename TIdx>
+            using AccCpuFibersMtIfAvailableElseInt = alpaka::AccCpuFibersMt<TDim, TIdx>;
+#else
+            template<
+                typename TDim,
+                typename TIdx>
+            using AccCpuFibersMtIfAvailableElseInt = int;
+#endif
 #if defined(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED)
             template<
                 typename TDim,
@@ -178,6 +189,7 @@ namespace alpaka
                     AccCpuSerialIfAvailableElseInt<TDim, TIdx>,
                     AccCpuThreadsIfAvailableElseInt<TDim, TIdx>,
                     AccCpuFibersIfAvailableElseInt<TDim, TIdx>,
+                    AccCpuFibersMtIfAvailableElseInt<TDim, TIdx>,
                     AccCpuTbbIfAvailableElseInt<TDim, TIdx>,
                     AccCpuOmp2BlocksIfAvailableElseInt<TDim, TIdx>,
                     AccCpuOmp2ThreadsIfAvailableElseInt<TDim, TIdx>,
@@ -330,6 +330,57 @@ namespace alpaka
 #endif
             }
         };
+#ifdef ALPAKA_ACC_ANY_BT_OMP5_ENABLED
+        //#############################################################################
+        //!
+        //#############################################################################
+        template<>
+        struct Enqueue<
+            QueueOmp5NonBlocking,
+            test::EventHostManualTriggerCpu<DevOmp5>>
+        {
+            //-----------------------------------------------------------------------------
+            //
+            //-----------------------------------------------------------------------------
+            ALPAKA_FN_HOST static auto enqueue(
+                QueueOmp5NonBlocking & queue,
+                test::EventHostManualTriggerCpu<DevOmp5> & event)
+            -> void
+            {
+                ALPAKA_DEBUG_MINIMAL_LOG_SCOPE;
+
+                // Copy the shared pointer to ensure that the event implementation is alive as long as it is enqueued.
+                auto spEventImpl(event.m_spEventImpl);
+
+                // Setting the event state and enqueuing it has to be atomic.
+                std::lock_guard<std::mutex> lk(spEventImpl->m_mutex);
+
+                // The event should not yet be enqueued.
+                ALPAKA_ASSERT(spEventImpl->m_bIsReady);
+
+                // Set its state to enqueued.
+                spEventImpl->m_bIsReady = false;
+
+                // Increment the enqueue counter. This is used to skip waits for events that had already been finished and re-enqueued which would lead to deadlocks.
+                ++spEventImpl->m_enqueueCount;
+
+                auto const enqueueCount = spEventImpl->m_enqueueCount;
+
+                // Enqueue a task that only completes when the event has been triggered.
+                queue.m_spQueueImpl->enqueueTask(
+                    [spEventImpl, enqueueCount]()
+                    {
+                        std::unique_lock<std::mutex> lk2(spEventImpl->m_mutex);
+                        spEventImpl->m_conditionVariable.wait(
+                            lk2,
+                            [spEventImpl, enqueueCount]
+                            {
+                                return (enqueueCount != spEventImpl->m_enqueueCount) || spEventImpl->m_bIsReady;
+                            });
+                    });
+            }
+        };
+#endif
         //#############################################################################
         //!
         //#############################################################################
@@ -203,6 +203,69 @@ namespace alpaka
                         byte));
             }
 
+            //#############################################################################
+            //! Compares element-wise that all elements are set to the same value.
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"  // "comparing floating point with == or != is unsafe"
+#endif
+            struct VerifyElementsFilledKernel
+            {
+                ALPAKA_NO_HOST_ACC_WARNING
+                template<
+                    typename TAcc,
+                    typename TIter,
+                    typename TElem>
+                ALPAKA_FN_ACC void operator()(
+                    TAcc const & acc,
+                    bool * success,
+                    TIter const & begin,
+                    TIter const & end,
+                    TElem const & value) const
+                {
+                    alpaka::ignore_unused(acc);
+
+                    for(auto it = begin; it != end; ++it)
+                    {
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wfloat-equal" // "comparing floating point with == or != is unsafe"
+#endif
+                        ALPAKA_CHECK(*success, *it == value);
+#if BOOST_COMP_CLANG
+#pragma clang diagnostic pop
+#endif
+                    }
+                }
+            };
+#if BOOST_COMP_GNUC
+#pragma GCC diagnostic pop
+#endif
+            //-----------------------------------------------------------------------------
+            template<
+                typename TAcc,
+                typename TView>
+            ALPAKA_FN_HOST auto verifyElementsFilled(
+                TView const & view,
+                alpaka::Elem<TView> const & value)
+            -> void
+            {
+                using Dim = alpaka::Dim<TView>;
+                using Idx = alpaka::Idx<TView>;
+
+                alpaka::test::KernelExecutionFixture<TAcc> fixture(
+                    alpaka::Vec<Dim, Idx>::ones());
+
+                VerifyElementsFilledKernel verifyElementsFilled;
+
+                REQUIRE(
+                    fixture(
+                        verifyElementsFilled,
+                        alpaka::test::view::begin(view),
+                        alpaka::test::view::end(view),
+                        value));
+            }
+
             //#############################################################################
             //! Compares iterators element-wise
 #if BOOST_COMP_GNUC
@@ -341,6 +404,16 @@ namespace alpaka
                     verifyBytesSet<TAcc>(view, byte);
                 }
 
+                //-----------------------------------------------------------------------------
+                // alpaka::view::fill
+                {
+                    using Elem = alpaka::Elem<TView>;
+                    Elem const value(static_cast<Elem>(3));
+                    alpaka::view::fill(queue, view, value);
+                    alpaka::wait(queue);
+                    verifyElementsFilled<TAcc>(view, value);
+                }
+
                 //-----------------------------------------------------------------------------
                 // alpaka::view::copy
                 {
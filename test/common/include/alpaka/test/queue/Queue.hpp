@@ -88,6 +88,17 @@ namespace alpaka
                 static constexpr bool value = false;
             };
 
+#ifdef ALPAKA_ACC_ANY_BT_OMP5_ENABLED
+            //#############################################################################
+            //! The blocking queue trait specialization for a non-blocking OpenMP 5.0 queue.
+            template<>
+            struct IsBlockingQueue<
+                alpaka::QueueOmp5NonBlocking>
+            {
+                static constexpr bool value = false;
+            };
+#endif
+
 #if defined(ALPAKA_ACC_GPU_CUDA_ENABLED) || defined(ALPAKA_ACC_GPU_HIP_ENABLED)
 
             //#############################################################################
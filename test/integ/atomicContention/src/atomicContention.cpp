@@ -0,0 +1,187 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/alpaka.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <typeinfo>
+
+//#############################################################################
+//! Each thread updates a minimum and a maximum with a sequence of values.
+class AtomicMinMaxKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    //! \param extrema The minimum and maximum pairs.
+    //! \param stride The distance between the pairs of consecutive threads. All threads update the same pair if it is zero.
+    //! \param iterationCount The number of values per thread.
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename T,
+        typename TIdx>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        T * const extrema,
+        TIdx const & stride,
+        TIdx const & iterationCount) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        T * const min(&extrema[gridThreadIdx * stride]);
+        T * const max(min + 1);
+
+        for(TIdx i(0u); i < iterationCount; ++i)
+        {
+            T const value(static_cast<T>(gridThreadIdx * iterationCount + i));
+            alpaka::atomicOp<alpaka::op::Min>(acc, min, value, alpaka::hierarchy::Blocks());
+            alpaka::atomicOp<alpaka::op::Max>(acc, max, value, alpaka::hierarchy::Blocks());
+        }
+    }
+};
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<
+        alpaka::DimInt<1u>,
+        std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    //! Runs the kernel and checks the extrema.
+    //!
+    //! \return The time per atomic operation in nanoseconds.
+    template<
+        typename TAcc,
+        typename T>
+    auto measureAtomicMinMax(
+        std::size_t const & threadCount,
+        bool const & contended)
+    -> double
+    {
+        using Dim = alpaka::Dim<TAcc>;
+        using Idx = alpaka::Idx<TAcc>;
+        using DevAcc = alpaka::Dev<TAcc>;
+        using PltfAcc = alpaka::Pltf<DevAcc>;
+        using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+        auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+        auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+        QueueAcc queue(devAcc);
+
+        Idx const iterationCount(20000u);
+        // Without contention the pairs of the threads are at least a cache line apart.
+        Idx const stride(contended ? static_cast<Idx>(0u) : static_cast<Idx>(std::max(std::size_t(2u), 64u / sizeof(T))));
+        Idx const extremaCount(contended ? static_cast<Idx>(2u) : static_cast<Idx>(threadCount * stride));
+
+        auto bufHost(alpaka::allocBuf<T, Idx>(devHost, extremaCount));
+        T * const pHost(alpaka::view::getPtrNative(bufHost));
+        for(Idx i(0u); i < extremaCount; i += 2u)
+        {
+            pHost[i] = std::numeric_limits<T>::max();
+            pHost[i + 1u] = std::numeric_limits<T>::lowest();
+        }
+        auto bufAcc(alpaka::allocBuf<T, Idx>(devAcc, extremaCount));
+        alpaka::view::copy(queue, bufAcc, bufHost, extremaCount);
+
+        auto const workDiv(
+            alpaka::getValidWorkDiv<TAcc>(
+                devAcc,
+                alpaka::Vec<Dim, Idx>(static_cast<Idx>(threadCount)),
+                alpaka::Vec<Dim, Idx>::ones(),
+                false,
+                alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+        REQUIRE(static_cast<std::size_t>(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(workDiv)[0u]) == threadCount);
+
+        auto const task(
+            alpaka::createTaskKernel<TAcc>(
+                workDiv,
+                AtomicMinMaxKernel(),
+                alpaka::view::getPtrNative(bufAcc),
+                stride,
+                iterationCount));
+
+        alpaka::wait(queue);
+        auto const tpStart(std::chrono::high_resolution_clock::now());
+        alpaka::enqueue(queue, task);
+        alpaka::wait(queue);
+        auto const tpEnd(std::chrono::high_resolution_clock::now());
+
+        alpaka::view::copy(queue, bufHost, bufAcc, extremaCount);
+        alpaka::wait(queue);
+
+        // The values are small integers which are exactly representable in all tested types.
+        auto const toInt([](T const & value){return static_cast<long long>(value);});
+        if(contended)
+        {
+            REQUIRE(toInt(pHost[0u]) == 0);
+            REQUIRE(toInt(pHost[1u]) == static_cast<long long>(threadCount * iterationCount - 1u));
+        }
+        else
+        {
+            for(std::size_t t(0u); t < threadCount; ++t)
+            {
+                REQUIRE(toInt(pHost[t * stride]) == static_cast<long long>(t * iterationCount));
+                REQUIRE(toInt(pHost[t * stride + 1u]) == static_cast<long long>((t + 1u) * iterationCount - 1u));
+            }
+        }
+
+        auto const ns(std::chrono::duration_cast<std::chrono::nanoseconds>(tpEnd - tpStart).count());
+        return static_cast<double>(ns) / static_cast<double>(2u * threadCount * iterationCount);
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Prints the time per atomic min or max operation with and without contention for an increasing number of threads.
+    template<
+        typename TAcc,
+        typename T>
+    auto measureAtomicMinMaxScaling()
+    -> void
+    {
+        std::size_t const threadCountMax(std::min(std::size_t(256u), 4u * std::max(std::size_t(1u), static_cast<std::size_t>(std::thread::hardware_concurrency()))));
+
+        std::cout
+            << "atomicContention(accelerator: " << alpaka::getAccName<TAcc>()
+            << ", type: " << typeid(T).name() << ")" << std::endl
+            << std::setw(10) << "threads"
+            << std::setw(22) << "contended [ns/op]"
+            << std::setw(22) << "uncontended [ns/op]" << std::endl;
+
+        for(std::size_t threadCount(1u); threadCount <= threadCountMax; threadCount *= 2u)
+        {
+            auto const contended(measureAtomicMinMax<TAcc, T>(threadCount, true));
+            auto const uncontended(measureAtomicMinMax<TAcc, T>(threadCount, false));
+            std::cout
+                << std::setw(10) << threadCount
+                << std::setw(22) << contended
+                << std::setw(22) << uncontended << std::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "atomicContention", "[atomicContention]", TestAccs)
+{
+    using Acc = TestType;
+
+    measureAtomicMinMaxScaling<Acc, int>();
+    measureAtomicMinMaxScaling<Acc, unsigned long long>();
+    measureAtomicMinMaxScaling<Acc, float>();
+    measureAtomicMinMaxScaling<Acc, double>();
+}
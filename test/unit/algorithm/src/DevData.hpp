@@ -0,0 +1,81 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <alpaka/alpaka.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace alpaka
+{
+    namespace test
+    {
+        namespace unit
+        {
+            namespace algorithm
+            {
+                //! The one-dimensional accelerators the algorithms are tested with.
+                using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<1u>, std::size_t>;
+
+                template<
+                    typename TAcc>
+                using Queue = alpaka::test::DefaultQueue<alpaka::Dev<TAcc>>;
+
+                template<
+                    typename TAcc,
+                    typename T>
+                using DevBuf = alpaka::Buf<alpaka::Dev<TAcc>, T, alpaka::DimInt<1u>, std::size_t>;
+
+                //-----------------------------------------------------------------------------
+                //! \return A device buffer with a copy of the host data.
+                template<
+                    typename TAcc,
+                    typename T>
+                auto toDev(
+                    Queue<TAcc> & queue,
+                    std::vector<T> const & host)
+                -> DevBuf<TAcc, T>
+                {
+                    std::size_t const extent(host.size());
+                    auto buf(alpaka::allocBuf<T, std::size_t>(alpaka::getDev(queue), extent));
+                    if(extent > 0u)
+                    {
+                        alpaka::view::copy(queue, buf, host, extent);
+                    }
+                    return buf;
+                }
+
+                //-----------------------------------------------------------------------------
+                //! \return A host copy of the device buffer after all operations enqueued into the queue are finished.
+                template<
+                    typename TAcc,
+                    typename TBuf>
+                auto toHost(
+                    Queue<TAcc> & queue,
+                    TBuf const & buf)
+                -> std::vector<alpaka::Elem<TBuf>>
+                {
+                    std::size_t const extent(alpaka::extent::getExtentProduct(buf));
+                    std::vector<alpaka::Elem<TBuf>> host(extent);
+                    if(extent > 0u)
+                    {
+                        alpaka::view::copy(queue, host, buf, extent);
+                    }
+                    alpaka::wait(queue);
+                    return host;
+                }
+            }
+        }
+    }
+}
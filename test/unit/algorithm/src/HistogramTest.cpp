@@ -0,0 +1,76 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "DevData.hpp"
+
+#include <alpaka/algorithm/Histogram.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    //#############################################################################
+    //! Uses the value as bin. Negative values are ignored by the histogram.
+    struct ValueAsBin
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::int32_t const & a) const
+        -> std::int32_t
+        {
+            return a;
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Checks the histogram of values in [-2, binCount + 2) against a sequential one.
+    template<
+        typename TAcc>
+    auto testHistogram(
+        std::size_t const size,
+        std::size_t const binCount)
+    -> void
+    {
+        namespace ta = alpaka::test::unit::algorithm;
+
+        auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<TAcc>>>(0u));
+        ta::Queue<TAcc> queue(dev);
+
+        std::vector<std::int32_t> host(size);
+        std::vector<std::uint32_t> expected(binCount, 0u);
+        for(std::size_t i(0u); i < size; ++i)
+        {
+            auto const v(static_cast<std::int32_t>((i * 2654435761u) % (binCount + 4u)) - 2);
+            host[i] = v;
+            if((v >= 0) && (static_cast<std::size_t>(v) < binCount))
+            {
+                ++expected[static_cast<std::size_t>(v)];
+            }
+        }
+        auto const bufSrc(ta::toDev<TAcc>(queue, host));
+        auto bufHist(alpaka::allocBuf<std::uint32_t, std::size_t>(dev, binCount));
+
+        alpaka::algorithm::histogram<TAcc>(queue, bufSrc, bufHist, ValueAsBin());
+
+        REQUIRE(ta::toHost<TAcc>(queue, bufHist) == expected);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "histogramShouldCountTheElementsPerBin", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    // Privatized within block shared memory.
+    testHistogram<TestType>(100000u, 64u);
+    testHistogram<TestType>(3u, 1u);
+    // Too large for block shared memory.
+    testHistogram<TestType>(100000u, 5000u);
+}
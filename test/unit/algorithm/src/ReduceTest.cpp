@@ -0,0 +1,148 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "DevData.hpp"
+
+#include <alpaka/algorithm/Reduce.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    //#############################################################################
+    struct Plus
+    {
+        template<
+            typename T>
+        ALPAKA_FN_HOST_ACC auto operator()(
+            T const & a,
+            T const & b) const
+        -> T
+        {
+            return a + b;
+        }
+    };
+
+    //#############################################################################
+    struct Max
+    {
+        template<
+            typename T>
+        ALPAKA_FN_HOST_ACC auto operator()(
+            T const & a,
+            T const & b) const
+        -> T
+        {
+            return (a < b) ? b : a;
+        }
+    };
+
+    //#############################################################################
+    struct Abs
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::int32_t const & a) const
+        -> std::int64_t
+        {
+            return (a < 0) ? -static_cast<std::int64_t>(a) : static_cast<std::int64_t>(a);
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    //! \return The values -size/2, ..., size/2 scrambled so that the maximum is not at the end.
+    auto values(
+        std::size_t const size)
+    -> std::vector<std::int32_t>
+    {
+        std::vector<std::int32_t> v(size);
+        for(std::size_t i(0u); i < size; ++i)
+        {
+            v[(i * 7919u) % size] = static_cast<std::int32_t>(i) - static_cast<std::int32_t>(size / 2u);
+        }
+        return v;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "reduceShouldCombineAllElementsAndTheInitialValue", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    // Sizes with one, a few and many blocks as well as an empty source.
+    for(std::size_t const size : {0u, 1u, 7u, 1000u, 100003u})
+    {
+        auto const host(values(size));
+        auto const bufSrc(ta::toDev<Acc>(queue, host));
+        auto bufDst(alpaka::allocBuf<std::int32_t, std::size_t>(dev, static_cast<std::size_t>(1u)));
+
+        std::int32_t expectedSum(17);
+        std::int32_t expectedMax(-1000000);
+        for(auto const & v : host)
+        {
+            expectedSum += v;
+            expectedMax = (expectedMax < v) ? v : expectedMax;
+        }
+
+        alpaka::algorithm::reduce<Acc>(queue, bufSrc, bufDst, 17, Plus());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst)[0u] == expectedSum);
+
+        alpaka::algorithm::reduce<Acc>(queue, bufSrc, bufDst, -1000000, Max());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst)[0u] == expectedMax);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "transformReduceShouldReduceTheTransformedElements", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    std::size_t const size(54321u);
+    auto const host(values(size));
+    auto const bufSrc(ta::toDev<Acc>(queue, host));
+    auto bufDst(alpaka::allocBuf<std::int64_t, std::size_t>(dev, static_cast<std::size_t>(1u)));
+
+    std::int64_t expected(0);
+    for(auto const & v : host)
+    {
+        expected += Abs()(v);
+    }
+
+    alpaka::algorithm::transformReduce<Acc>(queue, bufSrc, bufDst, static_cast<std::int64_t>(0), Plus(), Abs());
+    REQUIRE(ta::toHost<Acc>(queue, bufDst)[0u] == expected);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "reduceShouldSumFloatingPointValues", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    std::size_t const size(30000u);
+    std::vector<double> const host(size, 0.25);
+    auto const bufSrc(ta::toDev<Acc>(queue, host));
+    auto bufDst(alpaka::allocBuf<double, std::size_t>(dev, static_cast<std::size_t>(1u)));
+
+    alpaka::algorithm::reduce<Acc>(queue, bufSrc, bufDst, 1.0, Plus());
+    REQUIRE(ta::toHost<Acc>(queue, bufDst)[0u] == Approx(7501.0));
+}
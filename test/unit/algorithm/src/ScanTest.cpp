@@ -0,0 +1,134 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "DevData.hpp"
+
+#include <alpaka/algorithm/Scan.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    //#############################################################################
+    struct Plus
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::uint64_t const & a,
+            std::uint64_t const & b) const
+        -> std::uint64_t
+        {
+            return a + b;
+        }
+    };
+
+    //#############################################################################
+    //! An associative but not commutative operation which reveals any reordering of the operands.
+    struct Last
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::uint64_t const & a,
+            std::uint64_t const & b) const
+        -> std::uint64_t
+        {
+            alpaka::ignore_unused(a);
+            return b;
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    auto values(
+        std::size_t const size)
+    -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> v(size);
+        for(std::size_t i(0u); i < size; ++i)
+        {
+            v[i] = (i * 2654435761u) % 1000u;
+        }
+        return v;
+    }
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TOp>
+    auto scanHost(
+        std::vector<std::uint64_t> const & src,
+        bool const bExclusive,
+        std::uint64_t const init,
+        TOp const & op)
+    -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> dst(src.size());
+        std::uint64_t running(init);
+        for(std::size_t i(0u); i < src.size(); ++i)
+        {
+            if(bExclusive)
+            {
+                dst[i] = running;
+                running = op(running, src[i]);
+            }
+            else
+            {
+                running = (i == 0u) ? src[i] : op(running, src[i]);
+                dst[i] = running;
+            }
+        }
+        return dst;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "scanShouldKeepTheOrderOfTheElements", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    for(std::size_t const size : {1u, 5u, 1000u, 77777u})
+    {
+        auto const host(values(size));
+        auto const bufSrc(ta::toDev<Acc>(queue, host));
+        auto bufDst(alpaka::allocBuf<std::uint64_t, std::size_t>(dev, size));
+
+        alpaka::algorithm::inclusiveScan<Acc>(queue, bufSrc, bufDst, Plus());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst) == scanHost(host, false, 0u, Plus()));
+
+        alpaka::algorithm::exclusiveScan<Acc>(queue, bufSrc, bufDst, 3u, Plus());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst) == scanHost(host, true, 3u, Plus()));
+
+        alpaka::algorithm::inclusiveScan<Acc>(queue, bufSrc, bufDst, Last());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst) == scanHost(host, false, 0u, Last()));
+
+        alpaka::algorithm::exclusiveScan<Acc>(queue, bufSrc, bufDst, 12345u, Last());
+        REQUIRE(ta::toHost<Acc>(queue, bufDst) == scanHost(host, true, 12345u, Last()));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "scanShouldWorkInPlace", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    std::size_t const size(33333u);
+    auto const host(values(size));
+    auto buf(ta::toDev<Acc>(queue, host));
+
+    alpaka::algorithm::exclusiveScan<Acc>(queue, buf, buf, 0u, Plus());
+    REQUIRE(ta::toHost<Acc>(queue, buf) == scanHost(host, true, 0u, Plus()));
+}
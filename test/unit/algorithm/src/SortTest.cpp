@@ -0,0 +1,143 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "DevData.hpp"
+
+#include <alpaka/algorithm/Sort.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! \return Random keys in [min, max].
+    template<
+        typename TKey>
+    auto randomKeys(
+        std::size_t const size,
+        TKey const min,
+        TKey const max)
+    -> std::vector<TKey>
+    {
+        std::mt19937_64 engine(static_cast<std::mt19937_64::result_type>(size));
+        std::conditional_t<
+            std::is_floating_point<TKey>::value,
+            std::uniform_real_distribution<TKey>,
+            std::uniform_int_distribution<std::conditional_t<(sizeof(TKey) < 2u), std::int32_t, TKey>>> dist(min, max);
+        std::vector<TKey> keys(size);
+        for(auto & key : keys)
+        {
+            key = static_cast<TKey>(dist(engine));
+        }
+        return keys;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "sortShouldSortKeysInAscendingOrder", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    auto const testSort(
+        [&queue](auto const & host)
+        {
+            auto buf(ta::toDev<Acc>(queue, host));
+            alpaka::algorithm::sort<Acc>(queue, buf);
+
+            auto expected(host);
+            std::sort(expected.begin(), expected.end());
+            REQUIRE(ta::toHost<Acc>(queue, buf) == expected);
+        });
+
+    for(std::size_t const size : {0u, 1u, 2u, 1000u, 100003u})
+    {
+        testSort(randomKeys<std::uint32_t>(size, 0u, 0xffffffffu));
+        testSort(randomKeys<std::int64_t>(size, -5000000000, 5000000000));
+        testSort(randomKeys<float>(size, -100.0f, 100.0f));
+        testSort(randomKeys<double>(size, -1.0e10, 1.0e10));
+        testSort(randomKeys<std::uint8_t>(size, 0u, 255u));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "sortByKeyShouldBeStable", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    std::size_t const size(54321u);
+    // Many equal keys.
+    auto const keys(randomKeys<std::int32_t>(size, -50, 50));
+    std::vector<std::uint64_t> values(size);
+    for(std::size_t i(0u); i < size; ++i)
+    {
+        values[i] = i;
+    }
+
+    auto bufKeys(ta::toDev<Acc>(queue, keys));
+    auto bufValues(ta::toDev<Acc>(queue, values));
+    alpaka::algorithm::sortByKey<Acc>(queue, bufKeys, bufValues);
+
+    std::vector<std::tuple<std::int32_t, std::uint64_t>> expected(size);
+    for(std::size_t i(0u); i < size; ++i)
+    {
+        expected[i] = std::make_tuple(keys[i], values[i]);
+    }
+    std::stable_sort(
+        expected.begin(),
+        expected.end(),
+        [](auto const & a, auto const & b)
+        {
+            return std::get<0u>(a) < std::get<0u>(b);
+        });
+
+    auto const resultKeys(ta::toHost<Acc>(queue, bufKeys));
+    auto const resultValues(ta::toHost<Acc>(queue, bufValues));
+    std::size_t wrongCount(0u);
+    for(std::size_t i(0u); i < size; ++i)
+    {
+        wrongCount += ((resultKeys[i] != std::get<0u>(expected[i])) || (resultValues[i] != std::get<1u>(expected[i]))) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "sortShouldSortMoreKeysThanFitIntoTheBlockCounters", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    // More elements than the block local offsets can represent if only few blocks are used.
+    std::size_t const size(64u * alpaka::algorithm::detail::radixBlockElemCountMax + 7u);
+    auto const keys(randomKeys<std::uint32_t>(size, 0u, 0xffffffffu));
+
+    auto buf(ta::toDev<Acc>(queue, keys));
+    alpaka::algorithm::sort<Acc>(queue, buf);
+
+    auto expected(keys);
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(ta::toHost<Acc>(queue, buf) == expected);
+}
@@ -0,0 +1,111 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "DevData.hpp"
+
+#include <alpaka/algorithm/Transform.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    //#############################################################################
+    struct Square
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::int32_t const & a) const
+        -> std::int64_t
+        {
+            return static_cast<std::int64_t>(a) * a;
+        }
+    };
+
+    //#############################################################################
+    struct Subtract
+    {
+        ALPAKA_FN_HOST_ACC auto operator()(
+            std::int32_t const & a,
+            std::int32_t const & b) const
+        -> std::int32_t
+        {
+            return a - b;
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    auto iota(
+        std::size_t const size,
+        std::int32_t const first)
+    -> std::vector<std::int32_t>
+    {
+        std::vector<std::int32_t> v(size);
+        for(std::size_t i(0u); i < size; ++i)
+        {
+            v[i] = first + static_cast<std::int32_t>(i);
+        }
+        return v;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "transformShouldApplyTheOperationToEachElement", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    for(std::size_t const size : {1u, 13u, 4096u, 100003u})
+    {
+        auto const host(iota(size, -1000));
+        auto const bufSrc(ta::toDev<Acc>(queue, host));
+        auto bufDst(alpaka::allocBuf<std::int64_t, std::size_t>(dev, size));
+
+        alpaka::algorithm::transform<Acc>(queue, bufSrc, bufDst, Square());
+
+        auto const result(ta::toHost<Acc>(queue, bufDst));
+        std::size_t wrongCount(0u);
+        for(std::size_t i(0u); i < size; ++i)
+        {
+            wrongCount += (result[i] != Square()(host[i])) ? 1u : 0u;
+        }
+        REQUIRE(wrongCount == 0u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "binaryTransformShouldWorkInPlace", "[algorithm]", alpaka::test::unit::algorithm::TestAccs)
+{
+    using Acc = TestType;
+    namespace ta = alpaka::test::unit::algorithm;
+
+    auto const dev(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u));
+    ta::Queue<Acc> queue(dev);
+
+    std::size_t const size(10007u);
+    auto const host0(iota(size, 5));
+    auto const host1(iota(size, 2));
+    auto buf0(ta::toDev<Acc>(queue, host0));
+    auto const buf1(ta::toDev<Acc>(queue, host1));
+
+    alpaka::algorithm::transform<Acc>(queue, buf0, buf1, buf0, Subtract());
+
+    auto const result(ta::toHost<Acc>(queue, buf0));
+    std::size_t wrongCount(0u);
+    for(std::size_t i(0u); i < size; ++i)
+    {
+        wrongCount += (result[i] != 3) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+}
@@ -0,0 +1,185 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/atomic/Traits.hpp>
+#include <alpaka/meta/Filter.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <limits>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+//! Emulates an increment by a compare-and-swap loop.
+ALPAKA_NO_HOST_ACC_WARNING
+template<
+    typename TAcc,
+    typename T,
+    std::enable_if_t<std::is_integral<T>::value, int> = 0>
+ALPAKA_FN_ACC auto incrementByCas(
+    TAcc const & acc,
+    T * const counter)
+-> void
+{
+    T old(*counter);
+    T assumed;
+    do
+    {
+        assumed = old;
+        old = alpaka::atomicOp<alpaka::op::Cas>(acc, counter, assumed, static_cast<T>(assumed + static_cast<T>(1)), alpaka::hierarchy::Blocks());
+    }
+    while(old != assumed);
+}
+
+//-----------------------------------------------------------------------------
+//! Comparing floating point values for equality is not reliable. Therefore, Cas is not used for them.
+ALPAKA_NO_HOST_ACC_WARNING
+template<
+    typename TAcc,
+    typename T,
+    std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+ALPAKA_FN_ACC auto incrementByCas(
+    TAcc const & acc,
+    T * const counter)
+-> void
+{
+    alpaka::atomicOp<alpaka::op::Add>(acc, counter, static_cast<T>(1), alpaka::hierarchy::Blocks());
+}
+
+//#############################################################################
+//! All threads of the grid concurrently update the same few memory locations.
+class AtomicContentionTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename T>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success,
+        T * const min,
+        T * const max,
+        T * const counterInc,
+        T * const counterCas) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const gridThreadExtent(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc));
+        auto const linearIdx(alpaka::mapIdx<1u>(gridThreadIdx, gridThreadExtent)[0u]);
+
+        T const value(static_cast<T>(linearIdx + 1u));
+        T const threadCount(static_cast<T>(gridThreadExtent.prod()));
+
+        // The old values are the initial values or the extrema of the values written before.
+        T const oldMin(alpaka::atomicOp<alpaka::op::Min>(acc, min, value, alpaka::hierarchy::Blocks()));
+        ALPAKA_CHECK(*success, oldMin >= static_cast<T>(1));
+        T const oldMax(alpaka::atomicOp<alpaka::op::Max>(acc, max, value, alpaka::hierarchy::Blocks()));
+        ALPAKA_CHECK(*success, oldMax <= threadCount);
+
+        // Inc only wraps around when the old value is greater or equal to the given value.
+        T const oldInc(alpaka::atomicOp<alpaka::op::Inc>(acc, counterInc, std::numeric_limits<T>::max(), alpaka::hierarchy::Blocks()));
+        ALPAKA_CHECK(*success, oldInc < threadCount);
+
+        incrementByCas(acc, counterCas);
+    }
+};
+
+//#############################################################################
+template<
+    typename TAcc>
+struct IsCpuAcc : std::is_same<alpaka::Dev<TAcc>, alpaka::DevCpu>
+{};
+
+using TestAccs = alpaka::meta::Filter<
+    alpaka::test::EnabledAccs<
+        alpaka::DimInt<1u>,
+        std::size_t>,
+    IsCpuAcc>;
+
+//-----------------------------------------------------------------------------
+template<
+    typename T,
+    std::enable_if_t<std::is_integral<T>::value, int> = 0>
+auto checkEqual(
+    T const & value,
+    T const & expected)
+-> void
+{
+    REQUIRE(value == expected);
+}
+
+//-----------------------------------------------------------------------------
+//! The tested values are small integers which are exactly representable.
+template<
+    typename T,
+    std::enable_if_t<std::is_floating_point<T>::value, int> = 0>
+auto checkEqual(
+    T const & value,
+    T const & expected)
+-> void
+{
+    REQUIRE(static_cast<long long>(value) == static_cast<long long>(expected));
+}
+
+//#############################################################################
+template<
+    typename TAcc,
+    typename T>
+struct TestAtomicContention
+{
+    //-----------------------------------------------------------------------------
+    static auto testAtomicContention(
+        std::size_t const threadCount)
+    -> void
+    {
+        using Dim = alpaka::Dim<TAcc>;
+        using Idx = alpaka::Idx<TAcc>;
+
+        alpaka::test::KernelExecutionFixture<TAcc> fixture(
+            alpaka::Vec<Dim, Idx>(static_cast<Idx>(threadCount)));
+
+        auto const devAcc(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<TAcc>>>(0u));
+        auto buf(alpaka::allocBuf<T, Idx>(devAcc, static_cast<Idx>(4u)));
+        T * const pBuf(alpaka::view::getPtrNative(buf));
+        pBuf[0] = std::numeric_limits<T>::max();
+        pBuf[1] = static_cast<T>(0);
+        pBuf[2] = static_cast<T>(0);
+        pBuf[3] = static_cast<T>(0);
+
+        AtomicContentionTestKernel kernel;
+
+        REQUIRE(fixture(kernel, &pBuf[0], &pBuf[1], &pBuf[2], &pBuf[3]));
+
+        checkEqual(pBuf[0], static_cast<T>(1));
+        checkEqual(pBuf[1], static_cast<T>(threadCount));
+        checkEqual(pBuf[2], static_cast<T>(threadCount));
+        checkEqual(pBuf[3], static_cast<T>(threadCount));
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "atomicOperationsShouldBeCorrectUnderContention", "[atomic]", TestAccs)
+{
+    using Acc = TestType;
+
+    // Scale the number of threads concurrently updating the same memory locations.
+    for(std::size_t threadCount(1u); threadCount <= 4096u; threadCount *= 8u)
+    {
+        TestAtomicContention<Acc, int>::testAtomicContention(threadCount);
+        TestAtomicContention<Acc, unsigned int>::testAtomicContention(threadCount);
+        TestAtomicContention<Acc, unsigned long long>::testAtomicContention(threadCount);
+        TestAtomicContention<Acc, float>::testAtomicContention(threadCount);
+        TestAtomicContention<Acc, double>::testAtomicContention(threadCount);
+    }
+}
@@ -8,6 +8,8 @@
  */
 
 #include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/shared/st/Traits.hpp>
+#include <alpaka/block/sync/Traits.hpp>
 
 #include <alpaka/test/acc/TestAccs.hpp>
 #include <alpaka/test/queue/Queue.hpp>
@@ -90,3 +92,108 @@ TEMPLATE_LIST_TEST_CASE( "sameNonNullAdress", "[blockSharedMemDyn]", alpaka::tes
         fixture(
             kernel));
 }
+
+//#############################################################################
+class BlockSharedMemDynLargeTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        auto const blockThreadIdx(alpaka::getIdx<alpaka::Block, alpaka::Threads>(acc));
+        auto const blockThreadExtent(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(acc));
+        auto const blockThreadIdx1d(static_cast<std::size_t>(alpaka::mapIdx<1u>(blockThreadIdx, blockThreadExtent)[0u]));
+        auto const blockThreadCount(static_cast<std::size_t>(blockThreadExtent.prod()));
+
+        auto * const mem = alpaka::block::dyn::getMem<std::uint32_t>(acc);
+        for(std::size_t i(blockThreadIdx1d); i < m_elemCount; i += blockThreadCount)
+        {
+            mem[i] = static_cast<std::uint32_t>(i);
+        }
+
+        // The static block shared memory must not overlap the dynamic one.
+        auto & a = alpaka::block::st::allocVar<std::uint32_t, __COUNTER__>(acc);
+        if(blockThreadIdx1d == 0u)
+        {
+            a = 42u;
+        }
+        alpaka::block::syncBlockThreads(acc);
+
+        for(std::size_t i(blockThreadIdx1d); i < m_elemCount; i += blockThreadCount)
+        {
+            ALPAKA_CHECK(*success, static_cast<std::uint32_t>(i) == mem[i]);
+        }
+        ALPAKA_CHECK(*success, 42u == a);
+    }
+
+    std::size_t m_elemCount;
+};
+
+namespace alpaka
+{
+    namespace traits
+    {
+        //#############################################################################
+        //! The trait for getting the size of the block shared dynamic memory for a kernel.
+        template<
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            BlockSharedMemDynLargeTestKernel,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            //! \return The size of the shared memory allocated for a block.
+            template<
+                typename TVec>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                BlockSharedMemDynLargeTestKernel const & blockSharedMemDyn,
+                TVec const & blockThreadExtent,
+                TVec const & threadElemExtent,
+                bool * success)
+            -> std::size_t
+            {
+                alpaka::ignore_unused(blockThreadExtent);
+                alpaka::ignore_unused(threadElemExtent);
+                alpaka::ignore_unused(success);
+                return blockSharedMemDyn.m_elemCount * sizeof(std::uint32_t);
+            }
+        };
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "largeSize", "[blockSharedMemDyn]", alpaka::test::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+
+    // More than the 30 KiB formerly embedded into the CPU block accelerators.
+    std::size_t const sizeBytes(256u * 1024u);
+
+    auto const devProps(alpaka::getAccDevProps<Acc>(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<Acc>>>(0u)));
+    if(devProps.m_sharedMemSizeBytes < 2u * sizeBytes)
+    {
+        return;
+    }
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::Vec<Dim, Idx>::all(static_cast<Idx>(2u)));
+
+    // Launch twice with different sizes to exercise the reuse of the memory.
+    BlockSharedMemDynLargeTestKernel kernel{sizeBytes / sizeof(std::uint32_t)};
+    REQUIRE(
+        fixture(
+            kernel));
+
+    BlockSharedMemDynLargeTestKernel kernelLarger{2u * sizeBytes / sizeof(std::uint32_t)};
+    REQUIRE(
+        fixture(
+            kernelLarger));
+}
@@ -0,0 +1,80 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/ConcurrentExecPool.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using ThreadPool = alpaka::core::detail::ConcurrentExecPool<
+        std::size_t,
+        std::thread,
+        std::promise,
+        void,
+        std::mutex,
+        std::condition_variable,
+        false>;
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "concurrentExecPoolDependencyShouldHoldBackTheFollowingTasks", "[core]")
+{
+    ThreadPool pool(1u);
+
+    std::atomic<std::size_t> counter(0u);
+    auto spDependency(pool.enqueueDependency());
+    auto future(pool.enqueueTask([&counter](){++counter;}));
+
+    // The task behind the dependency is not started.
+    REQUIRE(future.wait_for(std::chrono::milliseconds(20u)) == std::future_status::timeout);
+    REQUIRE(counter == 0u);
+
+    pool.resolveDependency(spDependency);
+    future.get();
+    REQUIRE(counter == 1u);
+
+    // Resolving it again has no effect.
+    pool.resolveDependency(spDependency);
+    pool.enqueueTask([&counter](){++counter;}).get();
+    REQUIRE(counter == 2u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "concurrentExecPoolDependencyCanBeResolvedBeforeItIsReached", "[core]")
+{
+    ThreadPool pool(1u);
+
+    std::promise<void> blocker;
+    auto blockerFuture(blocker.get_future().share());
+    pool.enqueueTask([blockerFuture](){blockerFuture.wait();});
+
+    auto spDependency(pool.enqueueDependency());
+    pool.resolveDependency(spDependency);
+    blocker.set_value();
+
+    pool.enqueueTask([](){}).get();
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "concurrentExecPoolDependencyRequiresASingleExecutor", "[core]")
+{
+    ThreadPool pool(2u);
+
+    REQUIRE_THROWS_AS(pool.enqueueDependency(), std::logic_error);
+}
@@ -0,0 +1,125 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/WorkerPool.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "workerPoolShouldCallEachWorkerIdxOnce", "[core]")
+{
+    alpaka::core::detail::WorkerPool pool(4u);
+    REQUIRE(pool.getWorkerCount() == 4u);
+
+    // Worker counts above the size of the pool are limited to it.
+    for(std::size_t const workerCount : {1u, 3u, 4u, 7u})
+    {
+        std::mutex mtx;
+        std::vector<std::size_t> callCounts(4u, 0u);
+        pool.run(
+            workerCount,
+            [&](std::size_t const workerIdx)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                ++callCounts.at(workerIdx);
+            });
+
+        for(std::size_t workerIdx(0u); workerIdx < callCounts.size(); ++workerIdx)
+        {
+            CHECK(callCounts[workerIdx] == (workerIdx < workerCount ? 1u : 0u));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "workerPoolShouldRethrowWorkerExceptions", "[core]")
+{
+    alpaka::core::detail::WorkerPool pool(4u);
+
+    std::atomic<std::size_t> callCount(0u);
+    REQUIRE_THROWS_AS(
+        pool.run(
+            4u,
+            [&callCount](std::size_t const workerIdx)
+            {
+                ++callCount;
+                if(workerIdx == 2u)
+                {
+                    throw std::runtime_error("workerPoolShouldRethrowWorkerExceptions");
+                }
+            }),
+        std::runtime_error);
+    // All workers have finished before the exception is rethrown.
+    CHECK(callCount == 4u);
+
+    // The pool is still usable.
+    callCount = 0u;
+    pool.run(
+        4u,
+        [&callCount](std::size_t const) noexcept
+        {
+            ++callCount;
+        });
+    CHECK(callCount == 4u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "workerPoolShouldExecuteJobsStartedByWorkers", "[core]")
+{
+    alpaka::core::detail::WorkerPool pool(4u);
+
+    std::atomic<std::size_t> callCount(0u);
+    pool.run(
+        4u,
+        [&pool, &callCount](std::size_t const)
+        {
+            pool.run(
+                4u,
+                [&callCount](std::size_t const) noexcept
+                {
+                    ++callCount;
+                });
+        });
+    CHECK(callCount == 16u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "workerPoolShouldExecuteJobsStartedConcurrently", "[core]")
+{
+    alpaka::core::detail::WorkerPool pool(4u);
+
+    std::size_t const jobCount(100u);
+    std::atomic<std::size_t> callCount(0u);
+    auto const runJobs(
+        [&]()
+        {
+            for(std::size_t i(0u); i < jobCount; ++i)
+            {
+                pool.run(
+                    4u,
+                    [&callCount](std::size_t const) noexcept
+                    {
+                        ++callCount;
+                    });
+            }
+        });
+
+    std::thread thread(runJobs);
+    runJobs();
+    thread.join();
+
+    CHECK(callCount == 2u * jobCount * 4u);
+}
@@ -0,0 +1,76 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of Alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/dev/DevCpu.hpp>
+#include <alpaka/dev/cpu/Topology.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <set>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "getTopology", "[dev]")
+{
+    auto const dev(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const & topology(alpaka::getTopology(dev));
+
+    REQUIRE(topology.m_logicalCoreCount >= 1u);
+    REQUIRE(topology.m_physicalCoreCount >= 1u);
+    REQUIRE(topology.m_physicalCoreCount <= topology.m_logicalCoreCount);
+    REQUIRE(topology.m_packageCount >= 1u);
+    REQUIRE(topology.m_packageCount <= topology.m_physicalCoreCount);
+
+    // Each logical core belongs to exactly one physical core.
+    REQUIRE(topology.m_coreLogicalCores.size() == topology.m_physicalCoreCount);
+    std::set<std::size_t> logicalCores;
+    std::size_t logicalCoreCount(0u);
+    for(auto const & coreLogicalCores : topology.m_coreLogicalCores)
+    {
+        REQUIRE(!coreLogicalCores.empty());
+        logicalCoreCount += coreLogicalCores.size();
+        logicalCores.insert(coreLogicalCores.begin(), coreLogicalCores.end());
+    }
+    REQUIRE(logicalCoreCount == topology.m_logicalCoreCount);
+    REQUIRE(logicalCores.size() == topology.m_logicalCoreCount);
+    REQUIRE(alpaka::cpu::getSmtWidth(topology) >= 1u);
+
+    for(auto const & cache : topology.m_caches)
+    {
+        REQUIRE(cache.m_level >= 1u);
+        REQUIRE(cache.m_sizeBytes > 0u);
+        REQUIRE(cache.m_sharingLogicalCoreCount >= 1u);
+    }
+    REQUIRE(alpaka::cpu::getCacheLineSizeBytes(topology) > 0u);
+
+    // The distance matrix is square and the local distance is the smallest one.
+    REQUIRE(!topology.m_numaDistances.empty());
+    for(std::size_t i(0u); i < topology.m_numaDistances.size(); ++i)
+    {
+        REQUIRE(topology.m_numaDistances[i].size() == topology.m_numaDistances.size());
+        for(auto const distance : topology.m_numaDistances[i])
+        {
+            REQUIRE(topology.m_numaDistances[i][i] <= distance);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "parseCpuList", "[dev]")
+{
+    REQUIRE(alpaka::cpu::detail::parseCpuList("0") == std::vector<std::size_t>{0u});
+    REQUIRE(alpaka::cpu::detail::parseCpuList("0-3,8,10-11\n") == std::vector<std::size_t>{0u, 1u, 2u, 3u, 8u, 10u, 11u});
+    REQUIRE(alpaka::cpu::detail::parseCpuList("").empty());
+
+    REQUIRE(alpaka::cpu::detail::parseSize("48K") == 48u * 1024u);
+    REQUIRE(alpaka::cpu::detail::parseSize("2048K") == 2u * 1024u * 1024u);
+    REQUIRE(alpaka::cpu::detail::parseSize("64") == 64u);
+}
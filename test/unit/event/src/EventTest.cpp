@@ -16,6 +16,9 @@
 
 #include <catch2/catch.hpp>
 
+#include <chrono>
+#include <thread>
+
 using TestQueues = alpaka::meta::Concatenate<
         alpaka::test::TestQueues
  #ifdef ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED
@@ -279,3 +282,152 @@ TEMPLATE_LIST_TEST_CASE( "waitForEventThatAlreadyFinishedShouldBeSkipped", "[eve
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "elapsedTimeBetweenEventsShouldBeMeasuredWithoutWaitingInbetween", "[event]", TestQueues)
+{
+    using DevQueue = TestType;
+    using Fixture = alpaka::test::QueueTestFixture<DevQueue>;
+    using Queue = typename Fixture::Queue;
+    using Dev = typename Fixture::Dev;
+
+    Fixture f1;
+    auto q1 = f1.m_queue;
+    alpaka::Event<Queue> e1(f1.m_dev, true, true);
+    alpaka::Event<Queue> e2(f1.m_dev, true, true);
+
+    if(!alpaka::test::IsBlockingQueue<Queue>::value
+        && alpaka::test::isEventHostManualTriggerSupported(f1.m_dev))
+    {
+        alpaka::test::EventHostManualTrigger<Dev> k1(f1.m_dev);
+
+        // q1 = [e1, k1, e2]
+        alpaka::enqueue(q1, e1);
+        alpaka::enqueue(q1, k1);
+        alpaka::enqueue(q1, e2);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100u));
+        k1.trigger();
+        alpaka::wait(q1);
+
+        REQUIRE(alpaka::getElapsedTime(e1, e2) >= 50.0);
+    }
+    else
+    {
+        alpaka::enqueue(q1, e1);
+        alpaka::enqueue(q1, e2);
+        alpaka::wait(q1);
+
+        REQUIRE(alpaka::getElapsedTime(e1, e2) >= 0.0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "queueWaitingForEventShouldBeDestructibleBeforeTheEventIsReady", "[event]", TestQueues)
+{
+    using DevQueue = TestType;
+    using Fixture = alpaka::test::QueueTestFixture<DevQueue>;
+    using Queue = typename Fixture::Queue;
+    using Dev = typename Fixture::Dev;
+
+    if(!alpaka::test::IsBlockingQueue<Queue>::value)
+    {
+        Fixture f1;
+        if(alpaka::test::isEventHostManualTriggerSupported(f1.m_dev))
+        {
+            auto q1 = f1.m_queue;
+            alpaka::test::EventHostManualTrigger<Dev> k1(f1.m_dev);
+            alpaka::Event<Queue> e1(f1.m_dev);
+
+            // q1 = [k1, e1]
+            alpaka::enqueue(q1, k1);
+            alpaka::enqueue(q1, e1);
+
+            {
+                Fixture f2;
+                auto q2 = f2.m_queue;
+
+                // q2 = [->e1]
+                alpaka::wait(q2, e1);
+                REQUIRE(!alpaka::isComplete(e1));
+
+                // q2 is destroyed while it still waits for e1.
+            }
+
+            // q1 = []
+            k1.trigger();
+            alpaka::wait(q1);
+            REQUIRE(alpaka::isComplete(e1));
+        }
+        else
+        {
+            std::cerr << "Can not execute test because CU_DEVICE_ATTRIBUTE_CAN_USE_STREAM_MEM_OPS is not supported!" << std::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "otherQueuesShouldProgressWhileAQueueWaitsForAnUnfinishedEvent", "[event]", TestQueues)
+{
+    using DevQueue = TestType;
+    using Fixture = alpaka::test::QueueTestFixture<DevQueue>;
+    using Queue = typename Fixture::Queue;
+    using Dev = typename Fixture::Dev;
+
+    if(!alpaka::test::IsBlockingQueue<Queue>::value)
+    {
+        Fixture f1;
+        if(alpaka::test::isEventHostManualTriggerSupported(f1.m_dev))
+        {
+            Fixture f2;
+            Fixture f3;
+            Fixture f4;
+            auto q1 = f1.m_queue;
+            auto q2 = f2.m_queue;
+            auto q3 = f3.m_queue;
+            auto q4 = f4.m_queue;
+            alpaka::test::EventHostManualTrigger<Dev> k1(f1.m_dev);
+            alpaka::test::EventHostManualTrigger<Dev> k4(f4.m_dev);
+            alpaka::Event<Queue> e1(f1.m_dev);
+            alpaka::Event<Queue> e2(f2.m_dev);
+            alpaka::Event<Queue> e3(f3.m_dev);
+            alpaka::Event<Queue> e4(f4.m_dev);
+
+            // q1 = [k1, e1]
+            alpaka::enqueue(q1, k1);
+            alpaka::enqueue(q1, e1);
+
+            // q2 = [->e1, e2]
+            alpaka::wait(q2, e1);
+            alpaka::enqueue(q2, e2);
+
+            // q3 = [->e2, e3]
+            alpaka::wait(q3, e2);
+            alpaka::enqueue(q3, e3);
+
+            // q4 = [k4, e4] is independent of the chain and is executed while q2 and q3 are held back.
+            alpaka::enqueue(q4, k4);
+            alpaka::enqueue(q4, e4);
+            k4.trigger();
+            alpaka::wait(q4);
+            REQUIRE(alpaka::isComplete(e4));
+
+            // Waiting for events does not release the tasks behind them.
+            std::this_thread::sleep_for(std::chrono::milliseconds(20u));
+            REQUIRE(!alpaka::isComplete(e1));
+            REQUIRE(!alpaka::isComplete(e2));
+            REQUIRE(!alpaka::isComplete(e3));
+
+            // Triggering the head of the chain releases all of it.
+            k1.trigger();
+            alpaka::wait(q3);
+            REQUIRE(alpaka::isComplete(e1));
+            REQUIRE(alpaka::isComplete(e2));
+            REQUIRE(alpaka::isComplete(e3));
+        }
+        else
+        {
+            std::cerr << "Can not execute test because CU_DEVICE_ATTRIBUTE_CAN_USE_STREAM_MEM_OPS is not supported!" << std::endl;
+        }
+    }
+}
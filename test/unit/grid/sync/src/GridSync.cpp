@@ -0,0 +1,185 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/grid/sync/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+#include <alpaka/test/Check.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+//#############################################################################
+class GridSyncTestKernel
+{
+public:
+    static const std::uint8_t stepCount = 4u;
+
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success,
+        alpaka::Idx<TAcc> * const pValues) const
+    -> void
+    {
+        using Idx = alpaka::Idx<TAcc>;
+
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        auto const gridThreadCount(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        // The neighbour is located within the next block for the last thread of each block.
+        auto const neighbourIdx((gridThreadIdx + static_cast<Idx>(1u)) % gridThreadCount);
+
+        for(auto step(static_cast<Idx>(0u)); step < static_cast<Idx>(stepCount); ++step)
+        {
+            pValues[gridThreadIdx] = gridThreadIdx + step;
+
+            // Synchronize all threads of all blocks.
+            alpaka::grid::syncGridThreads(acc);
+
+            // The values of the current step have to be visible to all threads of the grid.
+            ALPAKA_CHECK(*success, pValues[neighbourIdx] == neighbourIdx + step);
+
+            // The value must not be overwritten before all threads have read it.
+            alpaka::grid::syncGridThreads(acc);
+        }
+    }
+};
+
+namespace
+{
+    template<
+        typename TAcc>
+    using ImplementsGridSync = alpaka::concepts::ImplementsConcept<alpaka::grid::ConceptGridSync, TAcc>;
+
+    using TestAccs =
+        alpaka::meta::Filter<
+            alpaka::test::EnabledAccs<alpaka::DimInt<1u>, std::size_t>,
+            ImplementsGridSync>;
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "synchronize", "[gridSync]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    // Use as many blocks as can be resident at the same time.
+    auto const gridBlockCount(std::min(alpaka::getCooperativeGridBlockCountMax<Acc>(devAcc), static_cast<Idx>(4u)));
+    auto const blockThreadCount(std::min(alpaka::getAccDevProps<Acc>(devAcc).m_blockThreadCountMax, static_cast<Idx>(4u)));
+    REQUIRE(gridBlockCount > static_cast<Idx>(0u));
+
+    alpaka::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::Vec<Dim, Idx>(gridBlockCount),
+        alpaka::Vec<Dim, Idx>(blockThreadCount),
+        alpaka::Vec<Dim, Idx>::ones());
+
+    auto bufAccValues(alpaka::allocBuf<Idx, Idx>(devAcc, static_cast<Idx>(gridBlockCount * blockThreadCount)));
+    auto bufAccResult(alpaka::allocBuf<bool, Idx>(devAcc, static_cast<Idx>(1u)));
+    alpaka::view::set(
+        queue,
+        bufAccResult,
+        static_cast<std::uint8_t>(true),
+        bufAccResult);
+
+    alpaka::execCooperative<Acc>(
+        queue,
+        workDiv,
+        GridSyncTestKernel(),
+        alpaka::view::getPtrNative(bufAccResult),
+        alpaka::view::getPtrNative(bufAccValues));
+
+    auto bufHostResult(alpaka::allocBuf<bool, Idx>(devHost, static_cast<Idx>(1u)));
+    alpaka::view::copy(queue, bufHostResult, bufAccResult, bufAccResult);
+    alpaka::wait(queue);
+
+    REQUIRE(*alpaka::view::getPtrNative(bufHostResult));
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "cooperativeGridBlockCountMaxExceeded", "[gridSync]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+
+    alpaka::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::Vec<Dim, Idx>(alpaka::getCooperativeGridBlockCountMax<Acc>(devAcc) + static_cast<Idx>(1u)),
+        alpaka::Vec<Dim, Idx>::ones(),
+        alpaka::Vec<Dim, Idx>::ones());
+
+    bool * const success(nullptr);
+    Idx * const pValues(nullptr);
+
+    REQUIRE_THROWS_AS(
+        alpaka::createTaskKernelCooperative<Acc>(
+            workDiv,
+            GridSyncTestKernel(),
+            success,
+            pValues),
+        std::runtime_error);
+}
+
+#ifdef ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED
+//-----------------------------------------------------------------------------
+TEST_CASE( "syncGridThreadsShouldThrowOutsideOfCooperativeLaunches", "[gridSync]")
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+    using Acc = alpaka::AccCpuSerial<Dim, Idx>;
+
+    auto const devAcc(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    alpaka::QueueCpuBlocking queue(devAcc);
+
+    alpaka::WorkDivMembers<Dim, Idx> const workDiv(
+        alpaka::Vec<Dim, Idx>::ones(),
+        alpaka::Vec<Dim, Idx>::ones(),
+        alpaka::Vec<Dim, Idx>::ones());
+
+    bool success(true);
+    Idx value(0u);
+
+    // Even a single block grid may only be synchronized by a cooperative launch.
+    REQUIRE_THROWS_AS(
+        alpaka::exec<Acc>(
+            queue,
+            workDiv,
+            GridSyncTestKernel(),
+            &success,
+            &value),
+        std::logic_error);
+
+    REQUIRE_NOTHROW(
+        alpaka::execCooperative<Acc>(
+            queue,
+            workDiv,
+            GridSyncTestKernel(),
+            &success,
+            &value));
+    REQUIRE(success);
+}
+#endif
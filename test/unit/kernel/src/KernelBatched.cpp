@@ -0,0 +1,123 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+//#############################################################################
+//! Writes the batch index and the grid thread index of each thread of each problem instance.
+class KernelBatchedTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pValues) const
+    -> void
+    {
+        auto const batchIdx(alpaka::getBatchIdx(acc));
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+        auto const gridThreadCount(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        pValues[batchIdx * gridThreadCount + gridThreadIdx] = static_cast<std::uint32_t>(batchIdx * 1000u + gridThreadIdx);
+    }
+};
+
+namespace
+{
+    template<
+        typename TAcc>
+    using ImplementsIdxBatch = alpaka::concepts::ImplementsConcept<alpaka::ConceptIdxBatch, TAcc>;
+
+    using TestAccs =
+        alpaka::meta::Filter<
+            alpaka::test::EnabledAccs<alpaka::DimInt<1u>, std::size_t>,
+            ImplementsIdxBatch>;
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "execBatched", "[kernel]", TestAccs)
+{
+    using Acc = TestType;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    auto const workDiv(
+        alpaka::getValidWorkDiv<Acc>(
+            devAcc,
+            static_cast<Idx>(37u),
+            static_cast<Idx>(1u),
+            false,
+            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+    // The work division may cover more threads than requested.
+    Idx const threadCount(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(workDiv)[0u]);
+
+    for(Idx const batchCount : {static_cast<Idx>(0u), static_cast<Idx>(1u), static_cast<Idx>(23u)})
+    {
+        Idx const valueCount(batchCount * threadCount);
+        auto bufAcc(alpaka::allocBuf<std::uint32_t, Idx>(devAcc, valueCount));
+
+        alpaka::execBatched<Acc>(
+            queue,
+            workDiv,
+            batchCount,
+            KernelBatchedTestKernel(),
+            alpaka::view::getPtrNative(bufAcc));
+
+        auto bufHost(alpaka::allocBuf<std::uint32_t, Idx>(devHost, valueCount));
+        alpaka::view::copy(queue, bufHost, bufAcc, valueCount);
+        alpaka::wait(queue);
+
+        std::uint32_t const * const pHost(alpaka::view::getPtrNative(bufHost));
+        std::size_t wrongCount(0u);
+        for(Idx b(0u); b < batchCount; ++b)
+        {
+            for(Idx t(0u); t < threadCount; ++t)
+            {
+                wrongCount += (pHost[b * threadCount + t] != static_cast<std::uint32_t>(b * 1000u + t)) ? 1u : 0u;
+            }
+        }
+        REQUIRE(wrongCount == 0u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "createTaskKernelBatchedShouldThrowIfTheBlockCountExceedsTheIdxType", "[kernel]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using Vec = alpaka::Vec<Dim, Idx>;
+
+    alpaka::WorkDivMembers<Dim, Idx> const workDiv(
+        Vec(static_cast<Idx>(std::numeric_limits<Idx>::max() / 4u + 1u)),
+        Vec::ones(),
+        Vec::ones());
+
+    std::uint32_t * const pValues(nullptr);
+    CHECK_NOTHROW(alpaka::createTaskKernelBatched<Acc>(workDiv, static_cast<Idx>(3u), KernelBatchedTestKernel(), pValues));
+    CHECK_THROWS_AS(alpaka::createTaskKernelBatched<Acc>(workDiv, static_cast<Idx>(4u), KernelBatchedTestKernel(), pValues), std::runtime_error);
+}
@@ -0,0 +1,148 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/block/shared/dyn/Traits.hpp>
+#include <alpaka/block/shared/st/Traits.hpp>
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//#############################################################################
+//! Writes the linearized grid thread index of each thread through the dynamic block shared memory
+//! and the offset of a static block shared variable to the dynamic block shared memory.
+class KernelBlockSyncFreeTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pValues,
+        std::ptrdiff_t * const pOffsets) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const gridThreadExtent(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(acc));
+        auto const blockThreadIdx(alpaka::getIdx<alpaka::Block, alpaka::Threads>(acc));
+        auto const blockThreadExtent(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(acc));
+
+        auto const gridThreadIdx1d(alpaka::mapIdx<1u>(gridThreadIdx, gridThreadExtent)[0u]);
+        auto const blockThreadIdx1d(alpaka::mapIdx<1u>(blockThreadIdx, blockThreadExtent)[0u]);
+
+        // Each thread only accesses its own element, so no block synchronization is required.
+        std::uint32_t * const pShared(alpaka::block::dyn::getMem<std::uint32_t>(acc));
+        pShared[blockThreadIdx1d] = static_cast<std::uint32_t>(gridThreadIdx1d);
+        pValues[gridThreadIdx1d] = pShared[blockThreadIdx1d];
+
+        auto & sharedVar(alpaka::block::st::allocVar<std::uint32_t, __COUNTER__>(acc));
+        pOffsets[gridThreadIdx1d] = reinterpret_cast<std::uint8_t *>(&sharedVar) - reinterpret_cast<std::uint8_t *>(pShared);
+    }
+};
+
+namespace alpaka
+{
+    namespace traits
+    {
+        //#############################################################################
+        //! The kernel never synchronizes the threads of a block.
+        template<>
+        struct IsBlockSyncFree<
+            KernelBlockSyncFreeTestKernel> :
+                std::true_type
+        {};
+
+        //#############################################################################
+        //! The kernel uses one element of dynamic block shared memory per thread.
+        template<
+            typename TAcc>
+        struct BlockSharedMemDynSizeBytes<
+            KernelBlockSyncFreeTestKernel,
+            TAcc>
+        {
+            //-----------------------------------------------------------------------------
+            template<
+                typename TVec,
+                typename... TArgs>
+            ALPAKA_FN_HOST_ACC static auto getBlockSharedMemDynSizeBytes(
+                KernelBlockSyncFreeTestKernel const &,
+                TVec const & blockThreadExtent,
+                TVec const &,
+                TArgs const & ...)
+            -> std::size_t
+            {
+                return static_cast<std::size_t>(blockThreadExtent.prod()) * sizeof(std::uint32_t);
+            }
+        };
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "isBlockSyncFreeDefault", "[kernel]")
+{
+    STATIC_REQUIRE(!alpaka::isBlockSyncFree<int>());
+    STATIC_REQUIRE(alpaka::isBlockSyncFree<KernelBlockSyncFreeTestKernel>());
+}
+
+#if defined(ALPAKA_ACC_CPU_B_OMP2_T_SIMD_ENABLED)
+//-----------------------------------------------------------------------------
+TEST_CASE( "execBlockSyncFreeOmp2Simd", "[kernel]")
+{
+    using Dim = alpaka::DimInt<2u>;
+    using Idx = std::size_t;
+    using Acc = alpaka::AccCpuOmp2Simd<Dim, Idx>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+    using Vec = alpaka::Vec<Dim, Idx>;
+
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    // The block thread extent is not restricted to a single thread.
+    auto const devProps(alpaka::getAccDevProps<Acc>(devAcc));
+    REQUIRE(devProps.m_blockThreadCountMax > static_cast<Idx>(1u));
+
+    alpaka::WorkDivMembers<Dim, Idx> const workDiv(
+        Vec(static_cast<Idx>(3u), static_cast<Idx>(5u)),
+        Vec(static_cast<Idx>(4u), static_cast<Idx>(16u)),
+        Vec::ones());
+    Idx const threadCount(alpaka::getWorkDiv<alpaka::Grid, alpaka::Threads>(workDiv).prod());
+
+    auto bufValues(alpaka::allocBuf<std::uint32_t, Idx>(devAcc, threadCount));
+    auto bufOffsets(alpaka::allocBuf<std::ptrdiff_t, Idx>(devAcc, threadCount));
+
+    alpaka::exec<Acc>(
+        queue,
+        workDiv,
+        KernelBlockSyncFreeTestKernel(),
+        alpaka::view::getPtrNative(bufValues),
+        alpaka::view::getPtrNative(bufOffsets));
+    alpaka::wait(queue);
+
+    std::uint32_t const * const pValues(alpaka::view::getPtrNative(bufValues));
+    std::ptrdiff_t const * const pOffsets(alpaka::view::getPtrNative(bufOffsets));
+    std::size_t wrongCount(0u);
+    for(Idx t(0u); t < threadCount; ++t)
+    {
+        wrongCount += (pValues[t] != static_cast<std::uint32_t>(t)) ? 1u : 0u;
+        // The static block shared variable has the same position within the block shared memory of all threads.
+        wrongCount += (pOffsets[t] != pOffsets[0u]) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+}
+#endif
@@ -0,0 +1,115 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/kernel/Traits.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+//#############################################################################
+//! Counts the threads of each block within block shared memory.
+//!
+//! The result of a block is only correct if its threads synchronize with each other but not with the threads of other blocks
+//! and if each block has its own shared memory even when multiple blocks are executed concurrently.
+class KernelBlocksTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pBlockThreadCounts,
+        std::uint32_t * const pBlockIdxs) const
+    -> void
+    {
+        auto const gridBlockIdx(alpaka::getIdx<alpaka::Grid, alpaka::Blocks>(acc)[0u]);
+        auto const blockThreadIdx(alpaka::getIdx<alpaka::Block, alpaka::Threads>(acc)[0u]);
+
+        auto & blockThreadCount(alpaka::block::st::allocVar<std::uint32_t, __COUNTER__>(acc));
+        auto & blockIdx(alpaka::block::st::allocVar<std::uint32_t, __COUNTER__>(acc));
+        if(blockThreadIdx == 0u)
+        {
+            blockThreadCount = 0u;
+            blockIdx = static_cast<std::uint32_t>(gridBlockIdx);
+        }
+        alpaka::block::syncBlockThreads(acc);
+
+        alpaka::atomicOp<alpaka::op::Add>(acc, &blockThreadCount, 1u, alpaka::hierarchy::Threads());
+        alpaka::block::syncBlockThreads(acc);
+
+        if(blockThreadIdx == 0u)
+        {
+            pBlockThreadCounts[gridBlockIdx] = blockThreadCount;
+            pBlockIdxs[gridBlockIdx] = blockIdx;
+        }
+    }
+};
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<
+        alpaka::DimInt<1u>,
+        std::size_t>;
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "blocksShouldBeIndependent", "[kernel]", TestAccs)
+{
+    using Acc = TestType;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    auto const workDiv(
+        alpaka::getValidWorkDiv<Acc>(
+            devAcc,
+            static_cast<Idx>(97u * 4u),
+            static_cast<Idx>(1u),
+            false,
+            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+    Idx const blockCount(alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(workDiv)[0u]);
+    Idx const blockThreadCount(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(workDiv)[0u]);
+
+    auto bufBlockThreadCountsAcc(alpaka::allocBuf<std::uint32_t, Idx>(devAcc, blockCount));
+    auto bufBlockIdxsAcc(alpaka::allocBuf<std::uint32_t, Idx>(devAcc, blockCount));
+
+    alpaka::exec<Acc>(
+        queue,
+        workDiv,
+        KernelBlocksTestKernel(),
+        alpaka::view::getPtrNative(bufBlockThreadCountsAcc),
+        alpaka::view::getPtrNative(bufBlockIdxsAcc));
+
+    auto bufBlockThreadCountsHost(alpaka::allocBuf<std::uint32_t, Idx>(devHost, blockCount));
+    auto bufBlockIdxsHost(alpaka::allocBuf<std::uint32_t, Idx>(devHost, blockCount));
+    alpaka::view::copy(queue, bufBlockThreadCountsHost, bufBlockThreadCountsAcc, blockCount);
+    alpaka::view::copy(queue, bufBlockIdxsHost, bufBlockIdxsAcc, blockCount);
+    alpaka::wait(queue);
+
+    std::uint32_t const * const pBlockThreadCounts(alpaka::view::getPtrNative(bufBlockThreadCountsHost));
+    std::uint32_t const * const pBlockIdxs(alpaka::view::getPtrNative(bufBlockIdxsHost));
+    std::size_t wrongCount(0u);
+    for(Idx b(0u); b < blockCount; ++b)
+    {
+        wrongCount += (pBlockThreadCounts[b] != static_cast<std::uint32_t>(blockThreadCount)) ? 1u : 0u;
+        wrongCount += (pBlockIdxs[b] != static_cast<std::uint32_t>(b)) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+}
@@ -0,0 +1,130 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifdef ALPAKA_ACC_CPU_B_THREADS_T_FIBERS_ENABLED
+
+#include <alpaka/acc/AccCpuFibersMt.hpp>
+#include <alpaka/core/Unused.hpp>
+#include <alpaka/kernel/TaskKernelCpuFibersMt.hpp>
+#include <alpaka/kernel/Traits.hpp>
+#include <alpaka/pltf/PltfCpu.hpp>
+#include <alpaka/queue/QueueCpuBlocking.hpp>
+#include <alpaka/workdiv/WorkDivMembers.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+    using Acc = alpaka::AccCpuFibersMt<Dim, Idx>;
+    using Vec = alpaka::Vec<Dim, Idx>;
+    using WorkDiv = alpaka::WorkDivMembers<Dim, Idx>;
+}
+
+//#############################################################################
+//! Counts the threads executing it.
+class KernelFibersMtCountingKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::atomic<std::size_t> * const pCount) const
+    -> void
+    {
+        alpaka::ignore_unused(acc);
+
+        ++(*pCount);
+    }
+};
+
+//#############################################################################
+//! Launches a kernel from each thread and waits for it.
+class KernelFibersMtLaunchingKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        Idx const & innerBlockCount,
+        std::atomic<std::size_t> * const pCount) const
+    -> void
+    {
+        alpaka::ignore_unused(acc);
+
+        alpaka::QueueCpuBlocking queue(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+        WorkDiv const workDiv(Vec(innerBlockCount), Vec(static_cast<Idx>(1u)), Vec(static_cast<Idx>(1u)));
+        alpaka::exec<Acc>(
+            queue,
+            workDiv,
+            KernelFibersMtCountingKernel(),
+            pCount);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "fibersMtKernelsShouldBeAbleToLaunchKernels", "[kernel]")
+{
+    alpaka::QueueCpuBlocking queue(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    Idx const outerBlockCount(8u);
+    Idx const innerBlockCount(16u);
+    std::atomic<std::size_t> count(0u);
+
+    // The blocks of the inner kernels have to be executed while the outer kernel occupies the workers.
+    WorkDiv const workDiv(Vec(outerBlockCount), Vec(static_cast<Idx>(1u)), Vec(static_cast<Idx>(1u)));
+    alpaka::exec<Acc>(
+        queue,
+        workDiv,
+        KernelFibersMtLaunchingKernel(),
+        innerBlockCount,
+        &count);
+
+    CHECK(count == outerBlockCount * innerBlockCount);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "fibersMtKernelsShouldBeLaunchableConcurrently", "[kernel]")
+{
+    Idx const blockCount(64u);
+    std::size_t const launchCount(20u);
+    std::atomic<std::size_t> count(0u);
+
+    auto const launch(
+        [&]()
+        {
+            alpaka::QueueCpuBlocking queue(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+            WorkDiv const workDiv(Vec(blockCount), Vec(static_cast<Idx>(1u)), Vec(static_cast<Idx>(1u)));
+            for(std::size_t i(0u); i < launchCount; ++i)
+            {
+                alpaka::exec<Acc>(
+                    queue,
+                    workDiv,
+                    KernelFibersMtCountingKernel(),
+                    &count);
+            }
+        });
+
+    std::thread thread(launch);
+    launch();
+    thread.join();
+
+    CHECK(count == 2u * launchCount * blockCount);
+}
+
+#endif
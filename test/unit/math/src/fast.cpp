@@ -0,0 +1,183 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/math/fast/Traits.hpp>
+#include <alpaka/math/fast/FastStdLib.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+//#############################################################################
+//! Compares the approximate functions with the accurate ones.
+//!
+//! The tolerance also covers the CUDA and HIP intrinsics for the given arguments.
+class FastMathTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename FP>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success,
+        FP const arg) const
+    -> void
+    {
+        auto const close(
+            [&](FP const & approximation, FP const & reference)
+            {
+                return alpaka::math::abs(acc, approximation - reference)
+                    <= static_cast<FP>(16) * static_cast<FP>(std::numeric_limits<float>::epsilon()) * alpaka::math::abs(acc, reference)
+                    + static_cast<FP>(5e-7);
+            });
+
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::exp(acc, arg), alpaka::math::exp(acc, arg)));
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::log(acc, arg), alpaka::math::log(acc, arg)));
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::sin(acc, arg), alpaka::math::sin(acc, arg)));
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::cos(acc, arg), alpaka::math::cos(acc, arg)));
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::pow(acc, arg, static_cast<FP>(1.5)), alpaka::math::pow(acc, arg, static_cast<FP>(1.5))));
+        ALPAKA_CHECK(*success, close(alpaka::math::fast::rsqrt(acc, arg), alpaka::math::rsqrt(acc, arg)));
+    }
+};
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<
+        alpaka::DimInt<1u>,
+        std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    //! \return The error of the approximation in units of the last place of the float reference.
+    auto ulpError(
+        float const & approximation,
+        double const & reference)
+    -> double
+    {
+        int const exponent(std::max(std::ilogb(reference), std::numeric_limits<float>::min_exponent - 1));
+        return std::abs(static_cast<double>(approximation) - reference)
+            / std::ldexp(1.0, exponent - std::numeric_limits<float>::digits + 1);
+    }
+
+    //-----------------------------------------------------------------------------
+    //! \return The maximum error of the approximation over evenly spaced arguments in [first, last].
+    template<
+        typename TApproximation,
+        typename TReference,
+        typename TError>
+    auto maxError(
+        float const & first,
+        float const & last,
+        TApproximation const & approximation,
+        TReference const & reference,
+        TError const & error)
+    -> double
+    {
+        std::size_t const count(1000000u);
+        double result(0.0);
+        for(std::size_t i(0u); i <= count; ++i)
+        {
+            auto const x(static_cast<float>(
+                static_cast<double>(first)
+                + (static_cast<double>(last) - static_cast<double>(first)) * static_cast<double>(i) / static_cast<double>(count)));
+            result = std::max(result, error(approximation(x), reference(static_cast<double>(x))));
+        }
+        return result;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "fastMath", "[fastMath]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::Vec<Dim, Idx>::ones());
+
+    FastMathTestKernel kernel;
+
+    for(float const arg : {0.001f, 0.42f, 1.0f, 2.5f, 3.1f, 7.9f})
+    {
+        REQUIRE(fixture(kernel, arg)); // float
+        REQUIRE(fixture(kernel, static_cast<double>(arg))); // double
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "fastMathStdLibErrorBounds", "[fastMath]")
+{
+    alpaka::math::fast::FastStdLib const ctx;
+    float const pi(3.14159265f);
+
+    auto const exp([&](float const & x){ return alpaka::math::fast::exp(ctx, x); });
+    auto const log([&](float const & x){ return alpaka::math::fast::log(ctx, x); });
+    auto const sin([&](float const & x){ return alpaka::math::fast::sin(ctx, x); });
+    auto const cos([&](float const & x){ return alpaka::math::fast::cos(ctx, x); });
+    auto const rsqrt([&](float const & x){ return alpaka::math::fast::rsqrt(ctx, x); });
+    auto const stdExp([](double const & x){ return std::exp(x); });
+    auto const stdLog([](double const & x){ return std::log(x); });
+    auto const stdSin([](double const & x){ return std::sin(x); });
+    auto const stdCos([](double const & x){ return std::cos(x); });
+    auto const stdRsqrt([](double const & x){ return 1.0 / std::sqrt(x); });
+    auto const isPositiveInfinity([](float const & x){ return std::isinf(x) && (x > 0.0f); });
+    auto const absError([](float const & approximation, double const & reference){ return std::abs(static_cast<double>(approximation) - reference); });
+
+    CHECK(maxError(-87.3f, 88.7f, exp, stdExp, ulpError) <= 1.0);
+    CHECK(maxError(1.0e-37f, 2.0f, log, stdLog, ulpError) <= 1.0);
+    CHECK(maxError(2.0f, 3.0e38f, log, stdLog, ulpError) <= 1.0);
+    CHECK(maxError(-pi, pi, sin, stdSin, ulpError) <= 2.0);
+    CHECK(maxError(-pi, pi, cos, stdCos, ulpError) <= 2.0);
+    CHECK(maxError(-8192.0f, 8192.0f, sin, stdSin, absError) <= std::ldexp(1.0, -23));
+    CHECK(maxError(-8192.0f, 8192.0f, cos, stdCos, absError) <= std::ldexp(1.0, -23));
+    CHECK(maxError(1.2e-38f, 3.0e38f, rsqrt, stdRsqrt, ulpError) <= 3.0);
+    CHECK(maxError(0.01f, 100.0f, rsqrt, stdRsqrt, ulpError) <= 3.0);
+    CHECK(
+        maxError(
+            0.5f,
+            20.0f,
+            [&](float const & x){ return alpaka::math::fast::pow(ctx, x, 2.5f); },
+            [](double const & x){ return std::pow(x, 2.5); },
+            ulpError)
+        <= 1.0 + 2.0 * 2.5 * std::log(20.0));
+
+    // Special values.
+    float const inf(std::numeric_limits<float>::infinity());
+    float const nan(std::numeric_limits<float>::quiet_NaN());
+    CHECK(isPositiveInfinity(exp(inf)));
+    CHECK(std::fpclassify(exp(-inf)) == FP_ZERO);
+    CHECK(isPositiveInfinity(exp(100.0f)));
+    CHECK(std::fpclassify(exp(-110.0f)) == FP_ZERO);
+    CHECK(std::isnan(exp(nan)));
+    CHECK(isPositiveInfinity(-log(0.0f)));
+    CHECK(isPositiveInfinity(log(inf)));
+    CHECK(std::isnan(log(-1.0f)));
+    CHECK(std::isnan(log(nan)));
+    CHECK(std::isnan(sin(inf)));
+    CHECK(std::isnan(cos(nan)));
+    CHECK(std::signbit(sin(-0.0f)));
+    CHECK(isPositiveInfinity(rsqrt(0.0f)));
+    CHECK(std::fpclassify(rsqrt(inf)) == FP_ZERO);
+    CHECK(std::isnan(rsqrt(-1.0f)));
+
+    // The double versions are the accurate ones.
+    CHECK(alpaka::math::fast::exp(ctx, 0.42) == Approx(std::exp(0.42)).epsilon(1e-15));
+    CHECK(alpaka::math::fast::pow(ctx, 0.42, 2.5) == Approx(std::pow(0.42, 2.5)).epsilon(1e-15));
+}
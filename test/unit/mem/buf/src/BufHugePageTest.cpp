@@ -0,0 +1,139 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/alloc/AllocCpuHugePage.hpp>
+
+#include <alpaka/alpaka.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+    using Alloc = alpaka::AllocCpuHugePage<std::integral_constant<std::size_t, 64u>>;
+
+    //-----------------------------------------------------------------------------
+    //! Allocates with the given configuration and checks that the whole memory can be used.
+    auto testAlloc(
+        alpaka::HugePageConfig const & config,
+        std::size_t const sizeElems)
+    -> alpaka::HugePageMode
+    {
+        Alloc const alloc(config);
+        std::uint32_t * const ptr(alpaka::malloc<std::uint32_t>(alloc, sizeElems));
+        REQUIRE(ptr != nullptr);
+        REQUIRE((reinterpret_cast<std::uintptr_t>(ptr) % 64u) == 0u);
+
+        bool const bHuge((config.m_thresholdBytes != 0u) && (sizeElems * sizeof(std::uint32_t) >= config.m_thresholdBytes));
+        if(bHuge)
+        {
+            REQUIRE((reinterpret_cast<std::uintptr_t>(ptr) % (2u * 1024u * 1024u)) == 0u);
+        }
+        else
+        {
+            REQUIRE(alpaka::getHugePageMode(ptr) == alpaka::HugePageMode::None);
+        }
+
+        for(std::size_t i(0u); i < sizeElems; ++i)
+        {
+            ptr[i] = static_cast<std::uint32_t>(i);
+        }
+        std::size_t wrongCount(0u);
+        for(std::size_t i(0u); i < sizeElems; ++i)
+        {
+            wrongCount += (ptr[i] != static_cast<std::uint32_t>(i)) ? 1u : 0u;
+        }
+        REQUIRE(wrongCount == 0u);
+
+        auto const mode(alpaka::getHugePageMode(ptr));
+        // Any instance can free the memory.
+        alpaka::free(Alloc(config), ptr);
+        return mode;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "allocCpuHugePageShouldOnlyUseHugePagesAboveTheThreshold", "[memBuf]")
+{
+    alpaka::HugePageConfig config;
+    config.m_thresholdBytes = 1024u * 1024u;
+    config.m_bHugeTlb = false;
+    config.m_bPrefault = false;
+
+    testAlloc(config, 1024u);
+    // Not a multiple of the huge page size.
+    auto const mode(testAlloc(config, 3u * 1024u * 1024u + 5u));
+    // Transparent huge pages may be disabled in the kernel.
+    REQUIRE(mode != alpaka::HugePageMode::HugeTlb);
+
+    config.m_thresholdBytes = 0u;
+    testAlloc(config, 3u * 1024u * 1024u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "allocCpuHugePageShouldFallBackIfNoHugeTlbPagesAreReserved", "[memBuf]")
+{
+    alpaka::HugePageConfig config;
+    config.m_thresholdBytes = 1024u * 1024u;
+    config.m_bHugeTlb = true;
+    config.m_bPrefault = true;
+
+    // Whether reserved huge pages are available depends on the system, but the memory has to be usable in any case.
+    testAlloc(config, 4u * 1024u * 1024u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "bufCpuShouldReportItsHugePageMode", "[memBuf]")
+{
+    using Idx = std::size_t;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    auto const configDefault(alpaka::getHugePageConfig());
+
+    auto config(configDefault);
+    config.m_thresholdBytes = 1024u * 1024u;
+    config.m_bHugeTlb = false;
+    alpaka::setHugePageConfig(config);
+    {
+        auto bufSmall(alpaka::allocBuf<float, Idx>(devHost, static_cast<Idx>(16u)));
+        REQUIRE(alpaka::getHugePageMode(bufSmall) == alpaka::HugePageMode::None);
+
+        auto bufLarge(alpaka::allocBuf<float, Idx>(devHost, static_cast<Idx>(1024u * 1024u)));
+        REQUIRE((reinterpret_cast<std::uintptr_t>(alpaka::view::getPtrNative(bufLarge)) % (2u * 1024u * 1024u)) == 0u);
+        REQUIRE(alpaka::getHugePageMode(bufLarge) != alpaka::HugePageMode::HugeTlb);
+    }
+
+    alpaka::setHugePageConfig(configDefault);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "allocCpuHugePageShouldFreeInterleavedAllocations", "[memBuf]")
+{
+    alpaka::HugePageConfig config;
+    config.m_thresholdBytes = 1024u * 1024u;
+    config.m_bHugeTlb = true;
+    config.m_bPrefault = false;
+    Alloc const alloc(config);
+
+    // Each allocation has to be freed according to its own kind of memory, independent of the allocations made in between.
+    std::uint8_t * const pLarge(alpaka::malloc<std::uint8_t>(alloc, 4u * 1024u * 1024u));
+    std::uint8_t * const pSmall(alpaka::malloc<std::uint8_t>(alloc, 1024u));
+    REQUIRE(pLarge != nullptr);
+    REQUIRE(pSmall != nullptr);
+    REQUIRE(alpaka::getHugePageMode(pSmall) == alpaka::HugePageMode::None);
+    pLarge[0u] = 1u;
+    pSmall[0u] = 2u;
+
+    alpaka::free(alloc, pLarge);
+    alpaka::free(alloc, pSmall);
+}
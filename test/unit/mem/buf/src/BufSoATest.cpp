@@ -0,0 +1,178 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/buf/BufSoA.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+//#############################################################################
+template<
+    template<typename> class TMember>
+struct Particle
+{
+    TMember<float> x;
+    TMember<double> v;
+    TMember<std::uint8_t> type;
+
+    ALPAKA_SOA_MEMBERS(x, v, type)
+};
+
+//#############################################################################
+//! Initializes the particles through the proxy element access.
+class BufSoATestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TAccessor>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        TAccessor const particles) const
+    -> void
+    {
+        auto const i(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc)[0u]);
+
+        if(i < particles.getExtent())
+        {
+            particles[i].x = static_cast<float>(i);
+            particles[i].v = static_cast<double>(particles[i].x) * 0.5;
+            particles[i].type = static_cast<std::uint8_t>(i % 3u);
+        }
+    }
+};
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<1u>, std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAccessor>
+    auto countWrongParticles(
+        TAccessor const & particles,
+        std::size_t const firstIdx)
+    -> std::size_t
+    {
+        std::size_t wrongCount(0u);
+        for(std::size_t i(0u); i < particles.getExtent(); ++i)
+        {
+            auto const particle(particles.load(i));
+            std::size_t const idx(firstIdx + i);
+            wrongCount += (static_cast<std::size_t>(particle.x) != idx) ? 1u : 0u;
+            wrongCount += (static_cast<std::size_t>(particle.v * 2.0) != idx) ? 1u : 0u;
+            wrongCount += (particle.type != static_cast<std::uint8_t>(idx % 3u)) ? 1u : 0u;
+        }
+        return wrongCount;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "bufSoAMemberArraysAreAligned", "[memBuf]")
+{
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    std::size_t const extent(13u);
+    auto buf(alpaka::allocBufSoA<Particle, std::size_t>(devHost, extent));
+
+    REQUIRE(alpaka::extent::getWidth(buf) == extent);
+
+    constexpr std::size_t alignment(alpaka::core::vectorization::defaultAlignment);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(buf.m_ptrs.x) % alignment) == 0u);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(buf.m_ptrs.v) % alignment) == 0u);
+    REQUIRE((reinterpret_cast<std::uintptr_t>(buf.m_ptrs.type) % alignment) == 0u);
+
+    // The member arrays must not overlap.
+    REQUIRE(reinterpret_cast<std::uintptr_t>(buf.m_ptrs.x + extent) <= reinterpret_cast<std::uintptr_t>(buf.m_ptrs.v));
+    REQUIRE(reinterpret_cast<std::uintptr_t>(buf.m_ptrs.v + extent) <= reinterpret_cast<std::uintptr_t>(buf.m_ptrs.type));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "bufSoALoadStore", "[memBuf]")
+{
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto buf(alpaka::allocBufSoA<Particle, std::size_t>(devHost, static_cast<std::size_t>(4u)));
+    auto const particles(alpaka::view::getAccessor(buf));
+
+    particles.store(2u, Particle<alpaka::soa::Value>{1.5f, 2.5, 7u});
+    REQUIRE(buf.m_ptrs.x[2u] == Approx(1.5f));
+    REQUIRE(buf.m_ptrs.v[2u] == Approx(2.5));
+    REQUIRE(buf.m_ptrs.type[2u] == 7u);
+
+    particles[2u].x += 1.0f;
+    Particle<alpaka::soa::Value> const particle(particles.load(2u));
+    REQUIRE(particle.x == Approx(2.5f));
+
+    // An accessor to a const buffer is read-only.
+    auto const & bufConst(buf);
+    auto const particlesConst(alpaka::view::getAccessor(bufConst));
+    static_assert(
+        std::is_same<decltype(particlesConst[0u].x), float const &>::value,
+        "The accessor to a const buffer has to be read-only!");
+    REQUIRE(particlesConst[2u].type == 7u);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "bufSoAKernelWriteAndCopy", "[memBuf]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    Idx const extent(97u);
+    auto bufAcc(alpaka::allocBufSoA<Particle, Idx>(devAcc, extent));
+
+    auto const workDiv(
+        alpaka::getValidWorkDiv<Acc>(
+            devAcc,
+            alpaka::Vec<Dim, Idx>(extent),
+            alpaka::Vec<Dim, Idx>::ones(),
+            false,
+            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+    alpaka::exec<Acc>(
+        queue,
+        workDiv,
+        BufSoATestKernel(),
+        alpaka::view::getAccessor(bufAcc));
+
+    // Copy the whole container to the host.
+    auto bufHost(alpaka::allocBufSoA<Particle, Idx>(devHost, extent));
+    alpaka::view::copy(queue, bufHost, bufAcc, extent);
+    alpaka::wait(queue);
+    REQUIRE(countWrongParticles(alpaka::view::getAccessor(bufHost), 0u) == 0u);
+
+    // Copy a part of the container through a sub-view.
+    Idx const subViewOffset(10u);
+    Idx const subViewExtent(20u);
+    alpaka::view::ViewSubViewSoA<alpaka::DevCpu, Particle, Idx> subView(bufHost, subViewExtent, subViewOffset);
+    REQUIRE(countWrongParticles(alpaka::view::getAccessor(subView), subViewOffset) == 0u);
+
+    auto bufHostPart(alpaka::allocBufSoA<Particle, Idx>(devHost, subViewExtent));
+    alpaka::view::copy(queue, bufHostPart, subView, subViewExtent);
+    alpaka::wait(queue);
+    REQUIRE(countWrongParticles(alpaka::view::getAccessor(bufHostPart), subViewOffset) == 0u);
+
+    // Copying parts of whole containers requires sub-views.
+    REQUIRE_THROWS_AS(
+        alpaka::view::createTaskCopy(bufHostPart, bufHost, subViewExtent),
+        std::runtime_error);
+}
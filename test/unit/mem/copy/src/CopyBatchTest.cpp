@@ -0,0 +1,163 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/view/CopyBatch.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<2u>, std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    //! Gathers square tiles of a host buffer into a device buffer with a batch and copies them back with a second batch.
+    template<
+        typename TAcc>
+    auto testCopyBatchTiles(
+        std::size_t const tileSize,
+        std::size_t const tileCount)
+    -> void
+    {
+        using Dim = alpaka::Dim<TAcc>;
+        using Idx = alpaka::Idx<TAcc>;
+        using Vec = alpaka::Vec<Dim, Idx>;
+        using Elem = std::uint32_t;
+        using Region = alpaka::view::CopyRegion<Dim, Idx>;
+        using DevAcc = alpaka::Dev<TAcc>;
+        using PltfAcc = alpaka::Pltf<DevAcc>;
+        using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+        auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+        auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+        QueueAcc queue(devAcc);
+
+        // The source contains a grid of tileCount x tileCount tiles separated by a border of one element.
+        Idx const srcSize(static_cast<Idx>(tileCount * (tileSize + 1u) + 1u));
+        Vec const srcExtent(srcSize, srcSize);
+        auto bufSrc(alpaka::allocBuf<Elem, Idx>(devHost, srcExtent));
+        auto const accessorSrc(alpaka::view::getAccessor(bufSrc));
+        alpaka::meta::ndLoopIncIdx(
+            srcExtent,
+            [&](Vec const & idx)
+            {
+                accessorSrc(idx) = static_cast<Elem>(idx[0u] * srcSize + idx[1u]);
+            });
+
+        // The destination stores the tiles next to each other in a single row without a border.
+        Vec const tileExtent(static_cast<Idx>(tileSize), static_cast<Idx>(tileSize));
+        Vec const dstExtent(static_cast<Idx>(tileSize), static_cast<Idx>(tileSize * tileCount * tileCount));
+        auto bufAcc(alpaka::allocBuf<Elem, Idx>(devAcc, dstExtent));
+
+        std::vector<Region> regionsGather;
+        for(std::size_t ty(0u); ty < tileCount; ++ty)
+        {
+            for(std::size_t tx(0u); tx < tileCount; ++tx)
+            {
+                Vec const dstOffset(static_cast<Idx>(0u), static_cast<Idx>((ty * tileCount + tx) * tileSize));
+                Vec const srcOffset(static_cast<Idx>(ty * (tileSize + 1u) + 1u), static_cast<Idx>(tx * (tileSize + 1u) + 1u));
+                regionsGather.push_back(Region{dstOffset, srcOffset, tileExtent});
+            }
+        }
+        alpaka::view::copyBatch(queue, bufAcc, bufSrc, regionsGather);
+
+        // Scatter the tiles back into a zeroed buffer of the source extent.
+        auto bufDst(alpaka::allocBuf<Elem, Idx>(devHost, srcExtent));
+        alpaka::view::set(queue, bufDst, static_cast<std::uint8_t>(0u), srcExtent);
+        std::vector<Region> regionsScatter;
+        for(auto const & region : regionsGather)
+        {
+            regionsScatter.push_back(Region{region.m_srcOffset, region.m_dstOffset, region.m_extent});
+        }
+        alpaka::view::copyBatch(queue, bufDst, bufAcc, regionsScatter);
+        alpaka::wait(queue);
+
+        auto const accessorDst(alpaka::view::getAccessor(bufDst));
+        std::size_t wrongCount(0u);
+        alpaka::meta::ndLoopIncIdx(
+            srcExtent,
+            [&](Vec const & idx)
+            {
+                bool const isBorder(((idx[0u] % static_cast<Idx>(tileSize + 1u)) == 0u) || ((idx[1u] % static_cast<Idx>(tileSize + 1u)) == 0u));
+                Elem const expected(isBorder ? 0u : static_cast<Elem>(idx[0u] * srcSize + idx[1u]));
+                wrongCount += (accessorDst(idx) != expected) ? 1u : 0u;
+            });
+        REQUIRE(wrongCount == 0u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "copyBatchSmallTiles", "[memCopy]", TestAccs)
+{
+    testCopyBatchTiles<TestType>(3u, 5u);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "copyBatchLargeTiles", "[memCopy]", TestAccs)
+{
+    // Large enough for the host copies to be distributed across threads.
+    testCopyBatchTiles<TestType>(96u, 8u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "copyBatchEmpty", "[memCopy]")
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+    using Elem = std::uint32_t;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    alpaka::QueueCpuBlocking queue(devHost);
+
+    Idx const extent(4u);
+    auto bufSrc(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    auto bufDst(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    alpaka::view::set(queue, bufSrc, static_cast<std::uint8_t>(1u), extent);
+    alpaka::view::set(queue, bufDst, static_cast<std::uint8_t>(0u), extent);
+
+    std::vector<alpaka::view::CopyRegion<Dim, Idx>> const regions;
+    alpaka::view::copyBatch(queue, bufDst, bufSrc, regions);
+    alpaka::wait(queue);
+
+    Elem const * const pDst(alpaka::view::getPtrNative(bufDst));
+    for(Idx i(0u); i < extent; ++i)
+    {
+        CHECK(pDst[i] == 0u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "copyBatchShouldThrowForRegionsExceedingTheViews", "[memCopy]")
+{
+    using Dim = alpaka::DimInt<2u>;
+    using Idx = std::size_t;
+    using Vec = alpaka::Vec<Dim, Idx>;
+    using Region = alpaka::view::CopyRegion<Dim, Idx>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    Vec const extent(static_cast<Idx>(4u), static_cast<Idx>(8u));
+    auto bufSrc(alpaka::allocBuf<float, Idx>(devHost, extent));
+    auto bufDst(alpaka::allocBuf<float, Idx>(devHost, extent));
+
+    Vec const regionExtent(static_cast<Idx>(2u), static_cast<Idx>(4u));
+    std::vector<Region> const regionsValid{Region{Vec(static_cast<Idx>(2u), static_cast<Idx>(4u)), Vec::zeros(), regionExtent}};
+    std::vector<Region> const regionsDstExceeding{Region{Vec(static_cast<Idx>(3u), static_cast<Idx>(0u)), Vec::zeros(), regionExtent}};
+    std::vector<Region> const regionsSrcExceeding{Region{Vec::zeros(), Vec(static_cast<Idx>(0u), static_cast<Idx>(5u)), regionExtent}};
+
+    CHECK_NOTHROW(alpaka::view::createTaskCopyBatch(bufDst, bufSrc, regionsValid));
+    CHECK_THROWS_AS(alpaka::view::createTaskCopyBatch(bufDst, bufSrc, regionsDstExceeding), std::runtime_error);
+    CHECK_THROWS_AS(alpaka::view::createTaskCopyBatch(bufDst, bufSrc, regionsSrcExceeding), std::runtime_error);
+}
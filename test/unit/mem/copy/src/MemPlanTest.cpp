@@ -0,0 +1,135 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/buf/cpu/MemPlan.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+
+namespace
+{
+    using Dim = alpaka::DimInt<3u>;
+    using Idx = std::size_t;
+    using Vec = alpaka::Vec<Dim, Idx>;
+
+    //-----------------------------------------------------------------------------
+    auto vec3(
+        std::size_t const z,
+        std::size_t const y,
+        std::size_t const x)
+    -> Vec
+    {
+        return Vec(z, y, x);
+    }
+
+    //-----------------------------------------------------------------------------
+    auto isInside(
+        Vec const & idx,
+        Vec const & offset,
+        Vec const & extent)
+    -> bool
+    {
+        for(std::size_t d(0u); d < Dim::value; ++d)
+        {
+            if((idx[d] < offset[d]) || (idx[d] >= offset[d] + extent[d]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "memPlanCpuCollapsesContiguousDimensions", "[memCopy]")
+{
+    using Plan = alpaka::view::detail::MemPlanCpu<Dim>;
+
+    // A whole unpadded buffer is a single bulk row.
+    Vec const pitchDense(vec3(4u * 5u * 6u * 4u, 5u * 6u * 4u, 6u * 4u));
+    Plan const planDense(vec3(4u, 5u, 6u), 4u, pitchDense, pitchDense);
+    REQUIRE(planDense.isBulk());
+    REQUIRE(planDense.getRowBytes() == 4u * 5u * 6u * 4u);
+    REQUIRE(planDense.getRowCount() == 1u);
+
+    // Padded rows can not be merged but the planes are contiguous with respect to the rows.
+    Vec const pitchPadded(vec3(4u * 5u * 32u, 5u * 32u, 32u));
+    Plan const planPadded(vec3(4u, 5u, 6u), 4u, pitchPadded, pitchPadded);
+    REQUIRE(!planPadded.isBulk());
+    REQUIRE(planPadded.getRowBytes() == 24u);
+    REQUIRE(planPadded.getOuterDimCount() == 1u);
+    REQUIRE(planPadded.getRowCount() == 20u);
+
+    // A copy between a padded and a dense buffer keeps the rows but drops the dimension of extent one.
+    Plan const planMixed(vec3(1u, 5u, 6u), 4u, pitchDense, pitchPadded);
+    REQUIRE(planMixed.getRowBytes() == 24u);
+    REQUIRE(planMixed.getOuterDimCount() == 1u);
+    REQUIRE(planMixed.getRowCount() == 5u);
+
+    // Empty regions have no rows.
+    Plan const planEmpty(vec3(4u, 0u, 6u), 4u, pitchDense, pitchDense);
+    REQUIRE(planEmpty.getRowCount() == 0u);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "memPlanCpuCopyAndSetNarrowSubViews", "[memCopy]")
+{
+    using Elem = std::uint16_t;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    alpaka::QueueCpuBlocking queue(devHost);
+
+    Vec const extent(vec3(6u, 7u, 9u));
+    auto bufSrc(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    auto bufDst(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    Elem * const pSrc(alpaka::view::getPtrNative(bufSrc));
+    Elem * const pDst(alpaka::view::getPtrNative(bufDst));
+    auto const elemCount(extent.prod());
+    for(std::size_t i(0u); i < elemCount; ++i)
+    {
+        pSrc[i] = static_cast<Elem>(i);
+    }
+
+    // Sub-views with innermost extents of one, two and three elements exercise the fixed size and the generic row copies.
+    for(std::size_t width(1u); width <= 3u; ++width)
+    {
+        alpaka::view::set(queue, bufDst, static_cast<std::uint8_t>(0xffu), extent);
+
+        Vec const subExtent(vec3(4u, 5u, width));
+        Vec const offset(vec3(1u, 2u, 3u));
+        alpaka::view::ViewSubView<alpaka::DevCpu, Elem, Dim, Idx> subSrc(bufSrc, subExtent, offset);
+        alpaka::view::ViewSubView<alpaka::DevCpu, Elem, Dim, Idx> subDst(bufDst, subExtent, offset);
+        alpaka::view::copy(queue, subDst, subSrc, subExtent);
+
+        std::size_t wrongCount(0u);
+        alpaka::meta::ndLoopIncIdx(
+            extent,
+            [&](Vec const & idx)
+            {
+                auto const i((idx[0u] * extent[1u] + idx[1u]) * extent[2u] + idx[2u]);
+                Elem const expected(isInside(idx, offset, subExtent) ? pSrc[i] : static_cast<Elem>(0xffffu));
+                wrongCount += (pDst[i] != expected) ? 1u : 0u;
+            });
+        REQUIRE(wrongCount == 0u);
+
+        alpaka::view::set(queue, subDst, static_cast<std::uint8_t>(0u), subExtent);
+        alpaka::meta::ndLoopIncIdx(
+            extent,
+            [&](Vec const & idx)
+            {
+                auto const i((idx[0u] * extent[1u] + idx[1u]) * extent[2u] + idx[2u]);
+                Elem const expected(isInside(idx, offset, subExtent) ? static_cast<Elem>(0u) : static_cast<Elem>(0xffffu));
+                wrongCount += (pDst[i] != expected) ? 1u : 0u;
+            });
+        REQUIRE(wrongCount == 0u);
+    }
+}
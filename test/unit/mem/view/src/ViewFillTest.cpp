@@ -0,0 +1,207 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/buf/FillKernel.hpp>
+#include <alpaka/mem/buf/SetKernel.hpp>
+#include <alpaka/mem/view/ViewSubView.hpp>
+#include <alpaka/meta/Filter.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+    using Vec2 = alpaka::Vec<alpaka::DimInt<2u>, std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    auto vec2(
+        std::size_t const y,
+        std::size_t const x)
+    -> Vec2
+    {
+        return Vec2(y, x);
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Fills the whole 2D host buffer with zero and the region [offset, offset + extent) with the given value by the given function.
+    //! Afterwards it is checked that exactly the region has been filled.
+    template<
+        typename TElem,
+        typename TFnFill>
+    auto testFill2d(
+        alpaka::Vec<alpaka::DimInt<2u>, std::size_t> const & extentBuf,
+        alpaka::Vec<alpaka::DimInt<2u>, std::size_t> const & offset,
+        alpaka::Vec<alpaka::DimInt<2u>, std::size_t> const & extent,
+        TElem const & value,
+        TFnFill const & fnFill)
+    -> void
+    {
+        using Dim = alpaka::DimInt<2u>;
+        using Idx = std::size_t;
+
+        auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+        alpaka::test::DefaultQueue<alpaka::DevCpu> queue(devHost);
+
+        auto buf(alpaka::allocBuf<TElem, Idx>(devHost, extentBuf));
+        alpaka::view::fill(queue, buf, static_cast<TElem>(0));
+
+        alpaka::view::ViewSubView<alpaka::DevCpu, TElem, Dim, Idx> subView(buf, extent, offset);
+        fnFill(queue, subView, value);
+        alpaka::wait(queue);
+
+        auto const pitchBytes(alpaka::view::getPitchBytes<1u>(buf));
+        auto const pBytes(reinterpret_cast<std::uint8_t const *>(alpaka::view::getPtrNative(buf)));
+        for(Idx y(0u); y < extentBuf[0u]; ++y)
+        {
+            TElem const * const pRow(static_cast<TElem const *>(static_cast<void const *>(pBytes + y * pitchBytes)));
+            for(Idx x(0u); x < extentBuf[1u]; ++x)
+            {
+                bool const bInside(
+                    (y >= offset[0u]) && (y < offset[0u] + extent[0u])
+                    && (x >= offset[1u]) && (x < offset[1u] + extent[1u]));
+                REQUIRE(pRow[x] == (bInside ? value : static_cast<TElem>(0)));
+            }
+        }
+    }
+
+    //#############################################################################
+    template<
+        typename TAcc>
+    struct IsCpuAcc : std::is_same<alpaka::Dev<TAcc>, alpaka::DevCpu>
+    {};
+
+    using CpuTestAccs = alpaka::meta::Filter<
+        alpaka::test::EnabledAccs<
+            alpaka::DimInt<2u>,
+            std::size_t>,
+        IsCpuAcc>;
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_TEST_CASE( "fillShouldOnlyFillTheGivenRegionOfPitchedViews", "[memView]", std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, std::int64_t)
+{
+    auto const fnFill(
+        [](alpaka::test::DefaultQueue<alpaka::DevCpu> & queue, auto & view, TestType const & value)
+        {
+            alpaka::view::fill(queue, view, value);
+        });
+
+    TestType const value(static_cast<TestType>(0x5a));
+
+    // Odd offsets and extents require a prologue and an epilogue for each row.
+    testFill2d(vec2(7u, 129u), vec2(1u, 3u), vec2(5u, 101u), value, fnFill);
+    testFill2d(vec2(3u, 17u), vec2(0u, 0u), vec2(3u, 17u), value, fnFill);
+    testFill2d(vec2(3u, 17u), vec2(1u, 16u), vec2(1u, 1u), value, fnFill);
+    testFill2d(vec2(3u, 17u), vec2(1u, 5u), vec2(0u, 0u), value, fnFill);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "fillShouldHandleLargeBuffers", "[memView]")
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+    using Elem = std::uint16_t;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    alpaka::test::DefaultQueue<alpaka::DevCpu> queue(devHost);
+
+    // Larger than the threshold for non-temporal stores.
+    Idx const extent(48u * 1024u * 1024u / sizeof(Elem) + 3u);
+    auto buf(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    alpaka::view::fill(queue, buf, static_cast<Elem>(1));
+
+    // An unaligned sub view leaving out the first and last element.
+    alpaka::view::ViewSubView<alpaka::DevCpu, Elem, Dim, Idx> subView(buf, extent - 2u, static_cast<Idx>(1u));
+    alpaka::view::fill(queue, subView, static_cast<Elem>(0xabcd));
+    alpaka::wait(queue);
+
+    Elem const * const pBuf(alpaka::view::getPtrNative(buf));
+    REQUIRE(pBuf[0u] == static_cast<Elem>(1));
+    REQUIRE(pBuf[extent - 1u] == static_cast<Elem>(1));
+    std::size_t wrongCount(0u);
+    for(Idx i(1u); i < extent - 1u; ++i)
+    {
+        wrongCount += (pBuf[i] != static_cast<Elem>(0xabcd)) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "memFillKernelShouldOnlyFillTheGivenRegion", "[memView]", CpuTestAccs)
+{
+    using Acc = TestType;
+    using Idx = alpaka::Idx<Acc>;
+    using Elem = std::uint32_t;
+
+    auto const fnFill(
+        [](alpaka::test::DefaultQueue<alpaka::DevCpu> & queue, auto & view, Elem const & value)
+        {
+            auto const extent(alpaka::extent::getExtentVec(view));
+            auto elementsPerThread(Vec2::ones());
+            // Multiple vectors per thread with a prologue and an epilogue for unaligned ranges.
+            elementsPerThread[1u] = static_cast<Idx>(alpaka::view::MemFillKernel::getElemsPerThread<Elem>());
+            auto const workDiv(
+                alpaka::getValidWorkDiv<Acc>(
+                    alpaka::getDev(view),
+                    extent,
+                    elementsPerThread,
+                    false,
+                    alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+            alpaka::exec<Acc>(
+                queue,
+                workDiv,
+                alpaka::view::MemFillKernel(),
+                value,
+                alpaka::view::getPtrNative(view),
+                extent,
+                alpaka::view::getPitchBytesVec(view));
+        });
+
+    Elem const value(0x12345678u);
+    testFill2d(vec2(7u, 129u), vec2(1u, 3u), vec2(5u, 101u), value, fnFill);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "memSetKernelShouldOnlySetTheGivenRegion", "[memView]", CpuTestAccs)
+{
+    using Acc = TestType;
+    using Idx = alpaka::Idx<Acc>;
+    using Elem = std::uint8_t;
+
+    auto const fnSet(
+        [](alpaka::test::DefaultQueue<alpaka::DevCpu> & queue, auto & view, Elem const & value)
+        {
+            auto const extent(alpaka::extent::getExtentVec(view));
+            auto elementsPerThread(Vec2::ones());
+            elementsPerThread[1u] = static_cast<Idx>(11u);
+            auto const workDiv(
+                alpaka::getValidWorkDiv<Acc>(
+                    alpaka::getDev(view),
+                    extent,
+                    elementsPerThread,
+                    false,
+                    alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+            alpaka::exec<Acc>(
+                queue,
+                workDiv,
+                alpaka::view::MemSetKernel(),
+                value,
+                alpaka::view::getPtrNative(view),
+                extent,
+                alpaka::view::getPitchBytesVec(view));
+        });
+
+    // The word stores of the set kernel must not write beyond the unaligned region.
+    testFill2d(vec2(7u, 129u), vec2(1u, 3u), vec2(5u, 101u), static_cast<Elem>(0xa5u), fnSet);
+}
@@ -0,0 +1,241 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/mem/view/ViewLayout.hpp>
+#include <alpaka/mem/view/ViewSubView.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+//#############################################################################
+//! Writes a value derived from the index into each element of the accessor.
+class ViewLayoutTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TAccessor>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        TAccessor const accessor) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const & extent(accessor.getExtent());
+
+        if((gridThreadIdx[0u] < extent[0u]) && (gridThreadIdx[1u] < extent[1u]))
+        {
+            accessor(gridThreadIdx[0u], gridThreadIdx[1u]) = static_cast<std::uint32_t>(gridThreadIdx[0u] * 1000u + gridThreadIdx[1u]);
+        }
+    }
+};
+
+namespace
+{
+    using Layouts =
+        std::tuple<
+            alpaka::view::layout::RowMajor,
+            alpaka::view::layout::ColMajor,
+            alpaka::view::layout::Tiled<2u, 4u>,
+            alpaka::view::layout::Morton>;
+
+    using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<2u>, std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    auto vec2(
+        std::size_t const y,
+        std::size_t const x)
+    -> alpaka::Vec<alpaka::DimInt<2u>, std::size_t>
+    {
+        return alpaka::Vec<alpaka::DimInt<2u>, std::size_t>(y, x);
+    }
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TMapping,
+        typename TIdx>
+    auto checkMappingIsInjective(
+        TMapping const & mapping,
+        alpaka::Vec<alpaka::DimInt<2u>, TIdx> const & extent)
+    -> void
+    {
+        std::vector<bool> used(static_cast<std::size_t>(mapping.getElemCount()), false);
+        std::size_t collisionCount(0u);
+        alpaka::meta::ndLoopIncIdx(
+            extent,
+            [&](alpaka::Vec<alpaka::DimInt<2u>, TIdx> const & idx)
+            {
+                auto const offset(static_cast<std::size_t>(mapping(idx)));
+                REQUIRE(offset < used.size());
+                collisionCount += used[offset] ? 1u : 0u;
+                used[offset] = true;
+            });
+        REQUIRE(collisionCount == 0u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "layoutMappingIsInjective", "[memView]", Layouts)
+{
+    using Dim = alpaka::DimInt<2u>;
+    using Idx = std::size_t;
+    using Mapping = typename TestType::template Mapping<Dim, Idx>;
+
+    for(auto const & extent : {vec2(5u, 7u), vec2(8u, 8u), vec2(1u, 13u), vec2(3u, 1000u)})
+    {
+        checkMappingIsInjective(Mapping(extent), extent);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "layoutMappingOffsets", "[memView]")
+{
+    using Dim = alpaka::DimInt<2u>;
+    using Idx = std::size_t;
+    using Vec = alpaka::Vec<Dim, Idx>;
+    Vec const extent(vec2(5u, 7u));
+
+    alpaka::view::layout::RowMajor::Mapping<Dim, Idx> const rowMajor(extent, vec2(8u, 1u));
+    REQUIRE(rowMajor(vec2(2u, 3u)) == 19u);
+    REQUIRE(rowMajor.getElemCount() == 40u);
+
+    alpaka::view::layout::ColMajor::Mapping<Dim, Idx> const colMajor(extent);
+    REQUIRE(colMajor(vec2(2u, 3u)) == 17u);
+    REQUIRE(colMajor.getElemCount() == 35u);
+
+    alpaka::view::layout::Tiled<2u, 4u>::Mapping<Dim, Idx> const tiled(extent);
+    // The index (3, 5) is the element (1, 1) of the tile (1, 1) in a grid of 3x2 tiles.
+    REQUIRE(tiled(vec2(3u, 5u)) == 3u * 8u + 5u);
+    REQUIRE(tiled.getElemCount() == 48u);
+
+    alpaka::view::layout::Morton::Mapping<Dim, Idx> const morton(extent);
+    REQUIRE(morton(vec2(0u, 1u)) == 1u);
+    REQUIRE(morton(vec2(1u, 0u)) == 2u);
+    REQUIRE(morton(vec2(3u, 5u)) == 0x1bu);
+    REQUIRE(morton.getElemCount() == 64u);
+
+    // Each dimension is padded separately. The bits of the longer dimension follow each other once the shorter one has none left.
+    alpaka::view::layout::Morton::Mapping<Dim, Idx> const mortonElongated(vec2(3u, 1000u));
+    REQUIRE(mortonElongated(vec2(1u, 3u)) == 0x7u);
+    REQUIRE(mortonElongated(vec2(2u, 8u)) == 0x28u);
+    REQUIRE(mortonElongated.getElemCount() == 4u * 1024u);
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "viewLayoutKernelWriteAndCopy", "[memView]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using Vec = alpaka::Vec<Dim, Idx>;
+    using Elem = std::uint32_t;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    Vec const extent(static_cast<Idx>(6u), static_cast<Idx>(11u));
+    auto const workDiv(
+        alpaka::getValidWorkDiv<Acc>(
+            devAcc,
+            extent,
+            Vec::ones(),
+            false,
+            alpaka::GridBlockExtentSubDivRestrictions::Unrestricted));
+
+    auto const fnTest(
+        [&](auto layout)
+        {
+            using Layout = decltype(layout);
+
+            auto viewAcc(alpaka::view::allocBufLayout<Elem, Idx, Layout>(devAcc, extent));
+            alpaka::exec<Acc>(
+                queue,
+                workDiv,
+                ViewLayoutTestKernel(),
+                alpaka::view::getAccessor(viewAcc));
+
+            // Copy the storage to the host and convert it into a plain row-major buffer.
+            auto viewHost(alpaka::view::allocBufLayout<Elem, Idx, Layout>(devHost, extent));
+            alpaka::view::copy(queue, viewHost, viewAcc, extent);
+            auto bufHost(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+            alpaka::view::copy(queue, bufHost, viewHost, extent);
+            alpaka::wait(queue);
+
+            auto const accessorHost(alpaka::view::getAccessor(bufHost));
+            std::size_t wrongCount(0u);
+            alpaka::meta::ndLoopIncIdx(
+                extent,
+                [&](Vec const & idx)
+                {
+                    wrongCount += (accessorHost(idx) != static_cast<Elem>(idx[0u] * 1000u + idx[1u])) ? 1u : 0u;
+                });
+            REQUIRE(wrongCount == 0u);
+
+            // Convert the plain buffer back into the layout.
+            auto viewHost2(alpaka::view::allocBufLayout<Elem, Idx, Layout>(devHost, extent));
+            alpaka::view::copy(queue, viewHost2, bufHost, extent);
+            alpaka::wait(queue);
+
+            auto const accessorHost2(alpaka::view::getAccessor(viewHost2));
+            alpaka::meta::ndLoopIncIdx(
+                extent,
+                [&](Vec const & idx)
+                {
+                    wrongCount += (accessorHost2(idx) != static_cast<Elem>(idx[0u] * 1000u + idx[1u])) ? 1u : 0u;
+                });
+            REQUIRE(wrongCount == 0u);
+        });
+
+    fnTest(alpaka::view::layout::RowMajor());
+    fnTest(alpaka::view::layout::ColMajor());
+    fnTest(alpaka::view::layout::Tiled<2u, 4u>());
+    fnTest(alpaka::view::layout::Morton());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "accessorOfSubView", "[memView]")
+{
+    using Dim = alpaka::DimInt<2u>;
+    using Idx = std::size_t;
+    using Vec = alpaka::Vec<Dim, Idx>;
+    using Elem = float;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    Vec const extent(vec2(7u, 9u));
+    auto buf(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+    Vec const subViewExtent(vec2(3u, 4u));
+    Vec const subViewOffset(vec2(2u, 3u));
+    alpaka::view::ViewSubView<alpaka::DevCpu, Elem, Dim, Idx> subView(buf, subViewExtent, subViewOffset);
+
+    auto const accessor(alpaka::view::getAccessor(subView));
+    REQUIRE(accessor.getExtent() == subViewExtent);
+    accessor(1u, 2u) = 42.0f;
+
+    auto const & bufConst(buf);
+    auto const accessorBuf(alpaka::view::getAccessor(bufConst));
+    Elem const value(accessorBuf(subViewOffset + vec2(1u, 2u)));
+    REQUIRE(value == Approx(42.0f));
+
+    Elem const * const pBuf(alpaka::view::getPtrNative(bufConst));
+    auto const rowPitchElems(alpaka::view::getPitchBytes<1u>(buf) / sizeof(Elem));
+    REQUIRE(&accessorBuf(3u, 5u) == pBuf + 3u * rowPitchElems + 5u);
+}
@@ -0,0 +1,270 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/core/BoostPredef.hpp>
+
+#if BOOST_OS_UNIX || BOOST_OS_MACOS
+
+#include <alpaka/mem/buf/BufMmap.hpp>
+#include <alpaka/mem/view/ViewMmap.hpp>
+#include <alpaka/meta/Filter.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+#include <alpaka/test/mem/view/ViewTest.hpp>
+#include <alpaka/test/Extent.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if BOOST_COMP_GNUC
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align" // "cast from 'std::uint8_t*' to 'Elem*' increases required alignment of target type"
+#endif
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Writes a header of headerBytes bytes followed by the values 0, 1, 2, ... into the file.
+    template<
+        typename TElem>
+    auto writeIotaFile(
+        std::string const & fileName,
+        std::size_t const headerBytes,
+        std::size_t const elemCount)
+    -> void
+    {
+        std::vector<TElem> v(elemCount);
+        std::iota(v.begin(), v.end(), static_cast<TElem>(0));
+
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        std::vector<char> const header(headerBytes, 'h');
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(reinterpret_cast<char const *>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(TElem)));
+    }
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TElem>
+    auto readFile(
+        std::string const & fileName,
+        std::size_t const headerBytes,
+        std::size_t const elemCount)
+    -> std::vector<TElem>
+    {
+        std::vector<TElem> v(elemCount);
+        std::ifstream file(fileName, std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(headerBytes));
+        file.read(reinterpret_cast<char *>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(TElem)));
+        return v;
+    }
+}
+
+//#############################################################################
+template<
+    typename TAcc>
+struct IsCpuAcc : std::is_same<alpaka::Dev<TAcc>, alpaka::DevCpu>
+{};
+
+using CpuTestAccs = alpaka::meta::Filter<
+    alpaka::test::TestAccs,
+    IsCpuAcc>;
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "viewMmapImmutableTest", "[memView]", alpaka::test::TestAccs)
+{
+    using Dim = alpaka::Dim<TestType>;
+    using Idx = alpaka::Idx<TestType>;
+    using Elem = std::uint32_t;
+
+    std::string const fileName("viewMmapImmutableTest.bin");
+    // The offset is intentionally not page aligned.
+    std::size_t const headerBytes(4u);
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const extent(alpaka::createVecFromIndexedFn<Dim, alpaka::test::CreateVecWithIdx<Idx>::template ForExtentBuf>());
+    writeIotaFile<Elem>(fileName, headerBytes, static_cast<std::size_t>(extent.prod()));
+
+    {
+        // A view of const elements maps the file read-only.
+        alpaka::view::ViewMmap<Elem const, Dim, Idx> view(
+            devHost,
+            fileName,
+            extent,
+            alpaka::view::MmapSharing::Shared,
+            alpaka::view::MmapAdvice::Sequential,
+            headerBytes);
+        static_assert(
+            std::is_same<decltype(alpaka::view::getPtrNative(view)), Elem const *>::value,
+            "A read-only view must not give access to mutable elements.");
+
+        alpaka::test::view::testViewImmutable<Elem const>(
+            view,
+            devHost,
+            extent,
+            alpaka::Vec<Dim, Idx>::zeros());
+
+        // Copy the mapped file to the accelerator and back.
+        auto const devAcc(alpaka::getDevByIdx<alpaka::Pltf<alpaka::Dev<TestType>>>(0u));
+        alpaka::test::DefaultQueue<alpaka::Dev<TestType>> queue(devAcc);
+
+        auto bufAcc(alpaka::allocBuf<Elem, Idx>(devAcc, extent));
+        auto bufHost(alpaka::allocBuf<Elem, Idx>(devHost, extent));
+        alpaka::view::copy(queue, bufAcc, view, extent);
+        alpaka::view::copy(queue, bufHost, bufAcc, extent);
+        alpaka::wait(queue);
+
+        Elem const * const pHost(alpaka::view::getPtrNative(bufHost));
+        Elem const * const pView(alpaka::view::getPtrNative(view));
+        auto const pitchHost(alpaka::view::getPitchBytes<Dim::value - 1u>(bufHost));
+        auto const rowExtent(extent[Dim::value - 1u]);
+        auto const rowCount(extent.prod() / rowExtent);
+        for(Idx row(0); row < rowCount; ++row)
+        {
+            auto const pRowHost(reinterpret_cast<Elem const *>(reinterpret_cast<std::uint8_t const *>(pHost) + row * pitchHost));
+            for(Idx i(0); i < rowExtent; ++i)
+            {
+                REQUIRE(pRowHost[i] == pView[row * rowExtent + i]);
+                REQUIRE(pRowHost[i] == static_cast<Elem>(row * rowExtent + i));
+            }
+        }
+    }
+
+    std::remove(fileName.c_str());
+}
+#if BOOST_COMP_GNUC
+    #pragma GCC diagnostic pop
+#endif
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "viewMmapMutableTest", "[memView]", CpuTestAccs)
+{
+    using Dim = alpaka::Dim<TestType>;
+    using Idx = alpaka::Idx<TestType>;
+    using Elem = std::uint32_t;
+
+    std::string const fileName("viewMmapMutableTest.bin");
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const extent(alpaka::createVecFromIndexedFn<Dim, alpaka::test::CreateVecWithIdx<Idx>::template ForExtentBuf>());
+    auto const elemCount(static_cast<std::size_t>(extent.prod()));
+    writeIotaFile<Elem>(fileName, 0u, elemCount);
+
+    {
+        // Private mappings must never write back to the file.
+        alpaka::view::ViewMmap<Elem, Dim, Idx> view(
+            devHost,
+            fileName,
+            extent,
+            alpaka::view::MmapSharing::Private);
+
+        alpaka::test::DefaultQueue<alpaka::DevCpu> queue(devHost);
+        alpaka::test::view::testViewMutable<TestType>(queue, view);
+    }
+
+    auto const v(readFile<Elem>(fileName, 0u, elemCount));
+    for(std::size_t i(0u); i < elemCount; ++i)
+    {
+        REQUIRE(v[i] == static_cast<Elem>(i));
+    }
+
+    std::remove(fileName.c_str());
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "bufMmapShouldWriteBackToTheFile", "[memView]", CpuTestAccs)
+{
+    using Dim = alpaka::Dim<TestType>;
+    using Idx = alpaka::Idx<TestType>;
+    using Elem = std::uint32_t;
+
+    std::string const fileName("bufMmapShouldWriteBackToTheFile.bin");
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const extent(alpaka::createVecFromIndexedFn<Dim, alpaka::test::CreateVecWithIdx<Idx>::template ForExtentBuf>());
+    auto const elemCount(static_cast<std::size_t>(extent.prod()));
+
+    {
+        auto buf(alpaka::allocBufMmap<Elem, Idx>(devHost, fileName, extent, alpaka::view::MmapAdvice::WillNeed));
+
+        alpaka::test::DefaultQueue<alpaka::DevCpu> queue(devHost);
+        alpaka::test::view::iotaFillView(queue, buf);
+    }
+
+    auto const v(readFile<Elem>(fileName, 0u, elemCount));
+    for(std::size_t i(0u); i < elemCount; ++i)
+    {
+        REQUIRE(v[i] == static_cast<Elem>(i));
+    }
+
+    std::remove(fileName.c_str());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "viewMmapShouldThrowIfTheFileIsTooSmall", "[memView]")
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+
+    std::string const fileName("viewMmapShouldThrowIfTheFileIsTooSmall.bin");
+    writeIotaFile<std::uint32_t>(fileName, 0u, 4u);
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    REQUIRE_THROWS_AS(
+        (alpaka::view::ViewMmap<std::uint32_t, Dim, Idx>(devHost, fileName, alpaka::Vec<Dim, Idx>(static_cast<Idx>(5u)))),
+        std::runtime_error);
+    REQUIRE_THROWS_AS(
+        (alpaka::view::ViewMmap<std::uint32_t, Dim, Idx>(devHost, "viewMmapFileDoesNotExist.bin", alpaka::Vec<Dim, Idx>(static_cast<Idx>(1u)))),
+        std::runtime_error);
+
+    std::remove(fileName.c_str());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "viewMmapShouldThrowIfTheOffsetIsMisaligned", "[memView]")
+{
+    using Dim = alpaka::DimInt<1u>;
+    using Idx = std::size_t;
+
+    std::string const fileName("viewMmapShouldThrowIfTheOffsetIsMisaligned.bin");
+    writeIotaFile<std::uint32_t>(fileName, 2u, 4u);
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+
+    REQUIRE_THROWS_AS(
+        (alpaka::view::ViewMmap<std::uint32_t const, Dim, Idx>(
+            devHost,
+            fileName,
+            alpaka::Vec<Dim, Idx>(static_cast<Idx>(4u)),
+            alpaka::view::MmapSharing::Shared,
+            alpaka::view::MmapAdvice::Normal,
+            2u)),
+        std::invalid_argument);
+
+    // Byte sized elements can start anywhere.
+    alpaka::view::ViewMmap<std::uint8_t const, Dim, Idx> const view(
+        devHost,
+        fileName,
+        alpaka::Vec<Dim, Idx>(static_cast<Idx>(16u)),
+        alpaka::view::MmapSharing::Shared,
+        alpaka::view::MmapAdvice::Normal,
+        2u);
+    REQUIRE(alpaka::view::getPtrNative(view)[0u] == static_cast<std::uint8_t>(0u));
+
+    std::remove(fileName.c_str());
+}
+
+#endif
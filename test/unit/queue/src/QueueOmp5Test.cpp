@@ -0,0 +1,105 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifdef ALPAKA_ACC_ANY_BT_OMP5_ENABLED
+
+#include <alpaka/queue/QueueOmp5NonBlocking.hpp>
+#include <alpaka/pltf/PltfOmp5.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "queueOmp5NonBlockingShouldNotBlockTheEnqueuingThread", "[queue]")
+{
+    auto const dev(alpaka::getDevByIdx<alpaka::PltfOmp5>(0u));
+    alpaka::QueueOmp5NonBlocking queue(dev);
+
+    std::promise<void> promise;
+    auto future(promise.get_future().share());
+    std::atomic<bool> bExecuted(false);
+    alpaka::enqueue(
+        queue,
+        [future, &bExecuted]()
+        {
+            future.wait();
+            bExecuted = true;
+        });
+
+    // The task can only finish after the promise is set by this thread.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20u));
+    CHECK(!bExecuted);
+    CHECK(!alpaka::empty(queue));
+
+    promise.set_value();
+    alpaka::wait(queue);
+    CHECK(bExecuted);
+    CHECK(alpaka::empty(queue));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "queueOmp5NonBlockingShouldExecuteTasksInOrder", "[queue]")
+{
+    auto const dev(alpaka::getDevByIdx<alpaka::PltfOmp5>(0u));
+    alpaka::QueueOmp5NonBlocking queue(dev);
+
+    std::size_t const taskCount(100u);
+    std::vector<std::size_t> order;
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        alpaka::enqueue(
+            queue,
+            [i, &order]()
+            {
+                order.push_back(i);
+            });
+    }
+    alpaka::wait(queue);
+
+    REQUIRE(order.size() == taskCount);
+    for(std::size_t i(0u); i < taskCount; ++i)
+    {
+        CHECK(order[i] == i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "queueOmp5NonBlockingShouldRethrowTaskExceptionsOnWait", "[queue]")
+{
+    auto const dev(alpaka::getDevByIdx<alpaka::PltfOmp5>(0u));
+    alpaka::QueueOmp5NonBlocking queue(dev);
+
+    bool bExecutedAfter(false);
+    alpaka::enqueue(
+        queue,
+        []()
+        {
+            throw std::runtime_error("queueOmp5NonBlockingShouldRethrowTaskExceptionsOnWait");
+        });
+    alpaka::enqueue(
+        queue,
+        [&bExecutedAfter]() noexcept
+        {
+            bExecutedAfter = true;
+        });
+
+    REQUIRE_THROWS_AS(alpaka::wait(queue), std::runtime_error);
+    // The tasks after the failed one are still executed.
+    CHECK(bExecutedAfter);
+    // The exception is only reported once.
+    REQUIRE_NOTHROW(alpaka::wait(queue));
+}
+
+#endif
@@ -0,0 +1,138 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/rand/RandStdLib.hpp>
+#include <alpaka/rand/UniformUintBounded.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+    // The first draws of TinyMT seeded with 42.
+    constexpr std::array<std::uint32_t, 3u> tinyMtDraws{{3630158251u, 2160809637u, 20066871u}};
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename T,
+        typename TGenerator>
+    auto checkNormalMoments(
+        TGenerator & generator)
+    -> void
+    {
+        alpaka::rand::distribution::cpu::NormalReal<T> dist;
+
+        std::size_t const count(1000000u);
+        double sum(0.0);
+        double sumSquares(0.0);
+        std::size_t tailCount(0u);
+        for(std::size_t i(0u); i < count; ++i)
+        {
+            auto const x(static_cast<double>(dist(generator)));
+            REQUIRE(std::isfinite(x));
+            sum += x;
+            sumSquares += x * x;
+            tailCount += (std::abs(x) > 3.442619855899) ? 1u : 0u;
+        }
+        double const mean(sum / static_cast<double>(count));
+        double const variance(sumSquares / static_cast<double>(count) - mean * mean);
+
+        CHECK(std::abs(mean) < 0.005);
+        CHECK(std::abs(variance - 1.0) < 0.01);
+        // P(|x| > r) = 5.76e-4, so the tail sampling is exercised.
+        CHECK(tailCount > 400u);
+        CHECK(tailCount < 760u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "uniformUintCpuIsReproducible", "[rand]")
+{
+    alpaka::rand::generator::cpu::TinyMersenneTwister generator32(42u);
+    alpaka::rand::distribution::cpu::UniformUint<std::uint32_t> dist32;
+    for(auto const draw : tinyMtDraws)
+    {
+        REQUIRE(dist32(generator32) == draw);
+    }
+
+    alpaka::rand::generator::cpu::TinyMersenneTwister generator64(42u);
+    alpaka::rand::distribution::cpu::UniformUint<std::uint64_t> dist64;
+    REQUIRE(dist64(generator64) == ((static_cast<std::uint64_t>(tinyMtDraws[0u]) << 32u) | tinyMtDraws[1u]));
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "uniformRealCpuIsReproducible", "[rand]")
+{
+    {
+        alpaka::rand::generator::cpu::TinyMersenneTwister generator(42u);
+        alpaka::rand::distribution::cpu::UniformReal<float> dist;
+        auto const r(dist(generator));
+        REQUIRE(0.0f <= r);
+        REQUIRE(1.0f > r);
+        // The value is the upper 24 bits of the draw scaled by 2^-24.
+        REQUIRE(static_cast<std::uint32_t>(r * 16777216.0f) == (tinyMtDraws[0u] >> 8u));
+    }
+    {
+        alpaka::rand::generator::cpu::TinyMersenneTwister generator(42u);
+        alpaka::rand::distribution::cpu::UniformReal<double> dist;
+        auto const r(dist(generator));
+        REQUIRE(0.0 <= r);
+        REQUIRE(1.0 > r);
+        // The value is the upper 53 bits of two draws scaled by 2^-53.
+        REQUIRE(
+            static_cast<std::uint64_t>(r * 9007199254740992.0)
+            == (((static_cast<std::uint64_t>(tinyMtDraws[1u]) << 32u) | tinyMtDraws[0u]) >> 11u));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "normalRealCpuMoments", "[rand]")
+{
+    alpaka::rand::generator::cpu::TinyMersenneTwister tinyMt(12345u, 6789u);
+    checkNormalMoments<float>(tinyMt);
+    checkNormalMoments<double>(tinyMt);
+
+    alpaka::rand::generator::cpu::MersenneTwister mt(12345u, 6789u);
+    checkNormalMoments<float>(mt);
+    checkNormalMoments<double>(mt);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "uniformUintBoundedCpu", "[rand]")
+{
+    alpaka::rand::generator::cpu::TinyMersenneTwister generator(12345u, 6789u);
+    alpaka::rand::distribution::cpu::UniformUint<std::uint32_t> const dist;
+
+    for(std::uint32_t const bound : {1u, 7u, 2147483649u, 4294967295u})
+    {
+        alpaka::rand::distribution::UniformUintBounded<alpaka::rand::distribution::cpu::UniformUint<std::uint32_t>> bounded(dist, bound);
+        for(std::size_t i(0u); i < 10000u; ++i)
+        {
+            REQUIRE(bounded(generator) < bound);
+        }
+    }
+
+    // Each of the values is drawn with the same frequency.
+    alpaka::rand::distribution::UniformUintBounded<alpaka::rand::distribution::cpu::UniformUint<std::uint32_t>> bounded(dist, 6u);
+    std::array<std::size_t, 6u> histogram{};
+    std::size_t const count(600000u);
+    for(std::size_t i(0u); i < count; ++i)
+    {
+        ++histogram[bounded(generator)];
+    }
+    for(auto const bin : histogram)
+    {
+        CHECK(bin > 98000u);
+        CHECK(bin < 102000u);
+    }
+}
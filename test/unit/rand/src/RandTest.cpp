@@ -8,6 +8,7 @@
  */
 
 #include <alpaka/rand/Traits.hpp>
+#include <alpaka/rand/UniformUintBounded.hpp>
 
 #include <alpaka/test/acc/TestAccs.hpp>
 #include <alpaka/test/KernelExecutionFixture.hpp>
@@ -67,6 +68,12 @@ class RandTestKernel
             auto const r = dist(gen);
             alpaka::ignore_unused(r);
         }
+
+        {
+            auto dist(alpaka::rand::distribution::createUniformUintBounded(acc, 10u));
+            auto const r = dist(gen);
+            ALPAKA_CHECK(*success, 10u > r);
+        }
     }
 
 public:
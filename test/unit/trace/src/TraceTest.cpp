@@ -0,0 +1,199 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/trace/Trace.hpp>
+
+#include <alpaka/event/EventCpu.hpp>
+#include <alpaka/queue/QueueCpuNonBlocking.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/event/EventHostManualTrigger.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    auto readFile(
+        std::string const & fileName)
+    -> std::string
+    {
+        std::ifstream file(fileName);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    //-----------------------------------------------------------------------------
+    auto countOccurrences(
+        std::string const & str,
+        std::string const & sub)
+    -> std::size_t
+    {
+        std::size_t count(0u);
+        for(auto pos(str.find(sub)); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+        {
+            ++count;
+        }
+        return count;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("traceShouldWriteRecordsOfAllThreads", "[trace]")
+{
+    std::string const fileName("traceShouldWriteRecordsOfAllThreads.json");
+
+    alpaka::trace::enable(fileName);
+    REQUIRE(alpaka::trace::isEnabled());
+
+    std::size_t const threadCount(4u);
+    // More records than fit into a single chunk of a thread buffer.
+    std::size_t const recordCount(1000u);
+
+    std::vector<std::thread> threads;
+    for(std::size_t t(0u); t < threadCount; ++t)
+    {
+        threads.emplace_back(
+            [recordCount]()
+            {
+                for(std::size_t i(0u); i < recordCount; ++i)
+                {
+                    ALPAKA_TRACE_SCOPE(
+                        "test",
+                        [](){return std::make_pair(std::string("record \"quoted\""), alpaka::trace::detail::Args().add("value", 42).str());});
+                }
+            });
+    }
+    // Flushing concurrently to the producers must not lose records.
+    alpaka::trace::flush();
+    for(auto && thread : threads)
+    {
+        thread.join();
+    }
+
+    alpaka::trace::disable();
+    REQUIRE(!alpaka::trace::isEnabled());
+
+    std::string const trace(readFile(fileName));
+
+    REQUIRE(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") == 0u);
+    REQUIRE(trace.rfind("]}") == trace.size() - 3u);
+    REQUIRE(countOccurrences(trace, "\"cat\":\"test\"") == threadCount * recordCount);
+    REQUIRE(countOccurrences(trace, "\"name\":\"record \\\"quoted\\\"\"") == threadCount * recordCount);
+    REQUIRE(countOccurrences(trace, "\"value\":42") == threadCount * recordCount);
+    REQUIRE(countOccurrences(trace, "\"name\":\"thread_name\"") >= threadCount);
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("traceShouldNotRecordWhenDisabled", "[trace]")
+{
+    std::string const fileName("traceShouldNotRecordWhenDisabled.json");
+
+    alpaka::trace::enable(fileName);
+    alpaka::trace::disable();
+    {
+        ALPAKA_TRACE_SCOPE(
+            "test",
+            [](){return std::make_pair(std::string("record"), std::string());});
+    }
+    alpaka::trace::enable(fileName);
+    alpaka::trace::disable();
+
+    REQUIRE(countOccurrences(readFile(fileName), "\"cat\":\"test\"") == 0u);
+}
+
+//-----------------------------------------------------------------------------
+struct TraceTestKernel
+{
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        alpaka::ignore_unused(acc);
+        alpaka::ignore_unused(success);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "traceShouldRecordQueueTasks", "[trace]", alpaka::test::TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+
+    std::string const fileName("traceShouldRecordQueueTasks.json");
+
+    alpaka::trace::enable(fileName);
+
+    alpaka::test::KernelExecutionFixture<Acc> fixture(
+        alpaka::Vec<Dim, Idx>::ones());
+
+    TraceTestKernel kernel;
+
+    REQUIRE(fixture(kernel));
+
+    alpaka::trace::disable();
+
+    std::string const trace(readFile(fileName));
+
+    // Only the tasks executed by the CPU queues are recorded.
+    if(std::is_same<alpaka::Dev<Acc>, alpaka::DevCpu>::value)
+    {
+        REQUIRE(countOccurrences(trace, "\"cat\":\"kernel\"") == 1u);
+        REQUIRE(countOccurrences(trace, "\"name\":\"TraceTestKernel\"") == 1u);
+        REQUIRE(countOccurrences(trace, "\"cat\":\"set\"") == 1u);
+        REQUIRE(countOccurrences(trace, "\"cat\":\"copy\"") == 1u);
+        REQUIRE(countOccurrences(trace, "\"bytes\":1") == 2u);
+        REQUIRE(countOccurrences(trace, "\"workDiv\":") == 1u);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE("traceShouldRecordCrossQueueEventWaits", "[trace]")
+{
+    std::string const fileName("traceShouldRecordCrossQueueEventWaits.json");
+
+    alpaka::trace::enable(fileName);
+    {
+        auto const dev(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+        alpaka::QueueCpuNonBlocking q1(dev);
+        alpaka::QueueCpuNonBlocking q2(dev);
+        alpaka::test::EventHostManualTrigger<alpaka::DevCpu> k1(dev);
+        alpaka::EventCpu e1(dev);
+
+        // q1 = [k1, e1]
+        alpaka::enqueue(q1, k1);
+        alpaka::enqueue(q1, e1);
+
+        // q2 = [->e1]
+        alpaka::wait(q2, e1);
+
+        k1.trigger();
+        alpaka::wait(q1);
+        alpaka::wait(q2);
+    }
+    alpaka::trace::disable();
+
+    std::string const trace(readFile(fileName));
+
+    REQUIRE(countOccurrences(trace, "\"name\":\"wait\"") == 1u);
+}
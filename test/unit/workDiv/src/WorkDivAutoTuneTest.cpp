@@ -0,0 +1,173 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/workdiv/WorkDivAutoTune.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/queue/Queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+//#############################################################################
+//! Writes the linear index of each element of a 2D extent.
+class WorkDivAutoTuneTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc,
+        typename TIdx>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        std::uint32_t * const pValues,
+        alpaka::Vec<alpaka::DimInt<2u>, TIdx> const & extent) const
+    -> void
+    {
+        auto const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        auto const threadElemExtent(alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(acc));
+
+        for(TIdx y(0u); y < threadElemExtent[0u]; ++y)
+        {
+            for(TIdx x(0u); x < threadElemExtent[1u]; ++x)
+            {
+                auto const row(gridThreadIdx[0u] * threadElemExtent[0u] + y);
+                auto const col(gridThreadIdx[1u] * threadElemExtent[1u] + x);
+                // The tuned grid may cover more elements than the extent.
+                if((row < extent[0u]) && (col < extent[1u]))
+                {
+                    pValues[row * extent[1u] + col] = static_cast<std::uint32_t>(row * extent[1u] + col);
+                }
+            }
+        }
+    }
+};
+
+namespace alpaka
+{
+    namespace traits
+    {
+        //#############################################################################
+        //! The kernel never synchronizes the threads of a block.
+        template<>
+        struct IsBlockSyncFree<
+            WorkDivAutoTuneTestKernel> :
+                std::true_type
+        {};
+    }
+}
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<2u>, std::size_t>;
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "getWorkDivCandidates", "[workDiv]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    alpaka::Vec<Dim, Idx> const extent(static_cast<Idx>(37u), static_cast<Idx>(300u));
+
+    auto const candidates(alpaka::getWorkDivCandidates<Acc>(devAcc, extent));
+    REQUIRE(!candidates.empty());
+    for(auto const & candidate : candidates)
+    {
+        REQUIRE(alpaka::isValidWorkDiv<Acc>(devAcc, candidate));
+        auto const gridElemExtent(alpaka::getWorkDiv<alpaka::Grid, alpaka::Elems>(candidate));
+        REQUIRE(gridElemExtent[0u] >= extent[0u]);
+        REQUIRE(gridElemExtent[1u] >= extent[1u]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "getTunedWorkDiv", "[workDiv]", TestAccs)
+{
+    using Acc = TestType;
+    using Dim = alpaka::Dim<Acc>;
+    using Idx = alpaka::Idx<Acc>;
+    using DevAcc = alpaka::Dev<Acc>;
+    using PltfAcc = alpaka::Pltf<DevAcc>;
+    using QueueAcc = alpaka::test::DefaultQueue<DevAcc>;
+
+    auto const devHost(alpaka::getDevByIdx<alpaka::PltfCpu>(0u));
+    auto const devAcc(alpaka::getDevByIdx<PltfAcc>(0u));
+    QueueAcc queue(devAcc);
+
+    std::string const fileName("workDivAutoTuneTest.txt");
+    std::remove(fileName.c_str());
+    auto & cache(alpaka::WorkDivTuneCache::get());
+    cache.setFileName(fileName);
+
+    alpaka::Vec<Dim, Idx> const extent(static_cast<Idx>(37u), static_cast<Idx>(300u));
+    Idx const valueCount(extent.prod());
+    auto bufAcc(alpaka::allocBuf<std::uint32_t, Idx>(devAcc, valueCount));
+    auto const pAcc(alpaka::view::getPtrNative(bufAcc));
+
+    WorkDivAutoTuneTestKernel kernel;
+    auto const workDiv(alpaka::getTunedWorkDiv<Acc>(queue, extent, kernel, pAcc, extent));
+    REQUIRE(alpaka::isValidWorkDiv<Acc>(devAcc, workDiv));
+
+    // The tuned work division computes the correct result.
+    alpaka::view::set(queue, bufAcc, static_cast<std::uint8_t>(0u), valueCount);
+    alpaka::enqueue(queue, alpaka::createTaskKernel<Acc>(workDiv, kernel, pAcc, extent));
+    auto bufHost(alpaka::allocBuf<std::uint32_t, Idx>(devHost, valueCount));
+    alpaka::view::copy(queue, bufHost, bufAcc, valueCount);
+    alpaka::wait(queue);
+
+    std::uint32_t const * const pHost(alpaka::view::getPtrNative(bufHost));
+    std::size_t wrongCount(0u);
+    for(Idx i(0u); i < valueCount; ++i)
+    {
+        wrongCount += (pHost[i] != static_cast<std::uint32_t>(i)) ? 1u : 0u;
+    }
+    REQUIRE(wrongCount == 0u);
+
+    auto const requireSameWorkDiv(
+        [&](alpaka::WorkDivMembers<Dim, Idx> const & other)
+        {
+            REQUIRE(alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(other) == alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(workDiv));
+            REQUIRE(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(other) == alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(workDiv));
+            REQUIRE(alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(other) == alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(workDiv));
+        });
+
+    // The second query is answered from memory.
+    requireSameWorkDiv(alpaka::getTunedWorkDiv<Acc>(queue, extent, kernel, pAcc, extent));
+
+    // A new run is answered from the cache file.
+    cache.setFileName(fileName);
+    requireSameWorkDiv(alpaka::getTunedWorkDiv<Acc>(queue, extent, kernel, pAcc, extent));
+
+    cache.setFileName("");
+    std::remove(fileName.c_str());
+}
+
+//-----------------------------------------------------------------------------
+TEST_CASE( "getWorkDivTuneExtentClass", "[workDiv]")
+{
+    auto const extentClass(
+        [](std::size_t const & rows, std::size_t const & cols)
+        {
+            return alpaka::detail::getWorkDivTuneExtentClass(alpaka::Vec<alpaka::DimInt<2u>, std::size_t>(rows, cols));
+        });
+
+    REQUIRE(extentClass(1u, 300u) == "1,9");
+    REQUIRE(extentClass(37u, 511u) == "6,9");
+    REQUIRE(extentClass(32u, 512u) == "6,10");
+}
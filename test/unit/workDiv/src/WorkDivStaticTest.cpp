@@ -0,0 +1,126 @@
+/* Copyright 2020 Benjamin Worpitz
+ *
+ * This file is part of alpaka.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <alpaka/workdiv/WorkDivStatic.hpp>
+
+#include <alpaka/test/acc/TestAccs.hpp>
+#include <alpaka/test/KernelExecutionFixture.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <utility>
+
+//#############################################################################
+//! Compares the indices and extents computed with the static work division to the ones of the accelerator.
+template<
+    typename TWorkDiv>
+class WorkDivStaticTestKernel
+{
+public:
+    //-----------------------------------------------------------------------------
+    ALPAKA_NO_HOST_ACC_WARNING
+    template<
+        typename TAcc>
+    ALPAKA_FN_ACC auto operator()(
+        TAcc const & acc,
+        bool * success) const
+    -> void
+    {
+        using Vec = alpaka::Vec<alpaka::Dim<TAcc>, alpaka::Idx<TAcc>>;
+
+        TWorkDiv const workDiv(acc);
+
+        Vec const gridBlockExtent(alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(acc));
+        Vec const blockThreadExtent(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(acc));
+        Vec const threadElemExtent(alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(acc));
+        Vec const gridElemExtent(alpaka::getWorkDiv<alpaka::Grid, alpaka::Elems>(acc));
+
+        Vec const gridBlockExtentStatic(alpaka::getWorkDiv<alpaka::Grid, alpaka::Blocks>(workDiv));
+        Vec const blockThreadExtentStatic(alpaka::getWorkDiv<alpaka::Block, alpaka::Threads>(workDiv));
+        Vec const threadElemExtentStatic(alpaka::getWorkDiv<alpaka::Thread, alpaka::Elems>(workDiv));
+        Vec const gridElemExtentStatic(alpaka::getWorkDiv<alpaka::Grid, alpaka::Elems>(workDiv));
+
+        ALPAKA_CHECK(*success, gridBlockExtentStatic == gridBlockExtent);
+        ALPAKA_CHECK(*success, blockThreadExtentStatic == blockThreadExtent);
+        ALPAKA_CHECK(*success, threadElemExtentStatic == threadElemExtent);
+        ALPAKA_CHECK(*success, gridElemExtentStatic == gridElemExtent);
+        ALPAKA_CHECK(*success, TWorkDiv::blockThreadCount == blockThreadExtent.prod());
+        ALPAKA_CHECK(*success, TWorkDiv::threadElemCount == threadElemExtent.prod());
+
+        // The indices computed with the static extents.
+        Vec const gridThreadIdxStatic(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc, workDiv));
+        Vec const threadFirstElemIdxStatic(alpaka::getIdxThreadFirstElem(acc, gridThreadIdxStatic, threadElemExtentStatic));
+        Vec const gridThreadIdx(alpaka::getIdx<alpaka::Grid, alpaka::Threads>(acc));
+        Vec const threadFirstElemIdx(alpaka::getIdxThreadFirstElem(acc));
+        ALPAKA_CHECK(*success, gridThreadIdxStatic == gridThreadIdx);
+        ALPAKA_CHECK(*success, threadFirstElemIdxStatic == threadFirstElemIdx);
+
+        Vec const blockThreadIdx(alpaka::getIdx<alpaka::Block, alpaka::Threads>(acc));
+        auto const blockThreadIdx1dStatic(alpaka::mapIdx<1u>(blockThreadIdx, typename TWorkDiv::BlockThreadExtent()));
+        auto const blockThreadIdx1d(alpaka::mapIdx<1u>(blockThreadIdx, blockThreadExtent));
+        Vec const blockThreadIdxNdStatic(alpaka::mapIdx<alpaka::Dim<TAcc>::value>(blockThreadIdx1dStatic, typename TWorkDiv::BlockThreadExtent()));
+        ALPAKA_CHECK(*success, blockThreadIdx1dStatic == blockThreadIdx1d);
+        ALPAKA_CHECK(*success, blockThreadIdxNdStatic == blockThreadIdx);
+    }
+};
+
+namespace
+{
+    using TestAccs = alpaka::test::EnabledAccs<alpaka::DimInt<2u>, std::size_t>;
+
+    //-----------------------------------------------------------------------------
+    template<
+        typename TAcc,
+        typename TBlockThreadExtent>
+    auto testWorkDivStatic()
+    -> void
+    {
+        using Dim = alpaka::Dim<TAcc>;
+        using Idx = alpaka::Idx<TAcc>;
+        using WorkDiv = alpaka::WorkDivStatic<Dim, Idx, TBlockThreadExtent, std::integer_sequence<Idx, 1u, 3u>>;
+
+        WorkDiv const workDiv(alpaka::Vec<Dim, Idx>(static_cast<Idx>(3u), static_cast<Idx>(2u)));
+
+        alpaka::WorkDivMembers<Dim, Idx> const workDivMembers(workDiv);
+        REQUIRE(workDivMembers.m_gridBlockExtent == workDiv.m_gridBlockExtent);
+        REQUIRE(workDivMembers.m_blockThreadExtent == WorkDiv::blockThreadExtent());
+        REQUIRE(workDivMembers.m_threadElemExtent == WorkDiv::threadElemExtent());
+
+        alpaka::test::KernelExecutionFixture<TAcc> fixture(workDivMembers);
+
+        WorkDivStaticTestKernel<WorkDiv> kernel;
+
+        REQUIRE(
+            fixture(
+                kernel));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEMPLATE_LIST_TEST_CASE( "workDivStatic", "[workDiv]", TestAccs)
+{
+    using Acc = TestType;
+    using Idx = alpaka::Idx<Acc>;
+    using Dev = alpaka::Dev<Acc>;
+    using Pltf = alpaka::Pltf<Dev>;
+
+    Dev const dev(alpaka::getDevByIdx<Pltf>(0u));
+    auto const accDevProps(alpaka::getAccDevProps<Acc>(dev));
+
+    if((accDevProps.m_blockThreadCountMax >= static_cast<Idx>(8u))
+        && (accDevProps.m_blockThreadExtentMax[0u] >= static_cast<Idx>(2u))
+        && (accDevProps.m_blockThreadExtentMax[1u] >= static_cast<Idx>(4u)))
+    {
+        testWorkDivStatic<Acc, std::integer_sequence<Idx, 2u, 4u>>();
+    }
+    else
+    {
+        testWorkDivStatic<Acc, std::integer_sequence<Idx, 1u, 1u>>();
+    }
+}